@@ -33,10 +33,37 @@ namespace arm_gemm {
 template<typename Top, typename Tret>
 using UniqueGemmCommon = std::unique_ptr<GemmCommon<Top, Tret> >;
 
+// Implementation methods the dispatchers can choose from.  A pretransposed
+// B is stored block sparse if it turns out sparse enough when pretransposed;
+// GEMM_BLOCK_SPARSE stores it so whatever its density.
+enum class GemmMethod
+{
+    DEFAULT,
+    GEMV_PRETRANSPOSED,
+    GEMV_NATIVE_TRANSPOSED,
+    GEMM_NATIVE,
+    GEMM_INTERLEAVED,
+    GEMM_INTERLEAVED_BATCHED,
+    GEMM_BLOCK_SPARSE
+};
+
+// Optional overrides of the heuristics used by the dispatchers, e.g. as
+// measured by a tuner.  A method which doesn't apply to the problem (or
+// isn't available for the data type) is ignored.  Block sizes of 0 keep
+// the cache size based defaults; other values are rounded to what the
+// kernel needs.
+struct GemmConfig
+{
+    GemmMethod   method           = GemmMethod::DEFAULT;
+    unsigned int inner_block_size = 0; // K block of blocked implementations.
+    unsigned int outer_block_size = 0; // N block of blocked implementations.
+};
+
 template<typename Top, typename Tret>
 UniqueGemmCommon<Top, Tret> gemm(const CPUInfo &ci,
                                  const unsigned int M, const unsigned int N, const unsigned int K,
                                  const unsigned int nbatches, const unsigned int nmulti,
                                  const bool trA, const bool trB, const Tret alpha, const Tret beta,
-                                 const int maxthreads, const bool pretransposed_hint);
+                                 const int maxthreads, const bool pretransposed_hint,
+                                 const GemmConfig *cfg = nullptr);
 } // namespace arm_gemm
@@ -24,9 +24,97 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 namespace arm_gemm {
 
+// Activation applied by the output stage of the GEMMs: ReLU clamps the
+// results to [0, +inf), BoundedReLU to [lower_bound, upper_bound].
+struct Activation {
+    enum class Type {
+        None,
+        ReLU,
+        BoundedReLU
+    };
+
+    Type  type;
+    float upper_bound;
+    float lower_bound;
+
+    Activation(Type type=Type::None, float upper_bound=0.0f, float lower_bound=0.0f) :
+        type(type), upper_bound(upper_bound), lower_bound(lower_bound) { }
+};
+
+// Requantization applied by the output stage of the integer GEMMs: the
+// offset contributions and bias are added to the int32 results, which are
+// then scaled by a fixed point multiplier and shift, offset, clamped to
+// [minval, maxval] and written as uint8 to 'output' instead of C.
+//
+// The offset contributions are a_offset * col_sums[x] + b_offset *
+// row_sums[y] + a_offset * b_offset * K, where col_sums are the sums of the
+// columns of B and row_sums the sums of the rows of A (per batch).  Sums
+// whose offset is 0 aren't read and can be nullptr, as can the bias.
+struct Requantize32 {
+    uint8_t       *output=nullptr;
+    int            ldo=0;
+    int            output_batch_stride=0;
+    const int32_t *bias=nullptr;
+    const int32_t *row_sums=nullptr;
+    int            row_sums_batch_stride=0;
+    const int32_t *col_sums=nullptr;
+    int32_t        a_offset=0;
+    int32_t        b_offset=0;
+    int32_t        result_offset=0;
+    int32_t        result_multiplier=0;
+    int32_t        result_shift=0;
+    int32_t        minval=0;
+    int32_t        maxval=255;
+};
+
+// Convolution performed by reading A (optional): rather than an im2col
+// matrix, row m of A is gathered from the input feature map at the output
+// position (m % output_width, m / output_width) as the GEMM prepares it,
+// so the im2col matrix is never materialised.  A is then the first element
+// of the input, with A_batch_stride between the batches.
+//
+// K is ordered (channel, kernel_y, kernel_x), like the columns of an im2col
+// matrix.  Strides are in elements, so any data layout can be described;
+// positions in the padding read as zero.
+struct ConvolutionParameters {
+    int input_width=0;
+    int input_height=0;
+    int input_channels=0;
+    int input_stride_x=0;
+    int input_stride_y=0;
+    int input_stride_c=0;
+    int kernel_width=0;
+    int kernel_height=0;
+    int output_width=0;
+    int stride_x=1;
+    int stride_y=1;
+    int padding_left=0;
+    int padding_top=0;
+};
+
+// Phases of the GEMMs reported to a ProfileSink.
+enum class ProfilePhase {
+    PrepareA,   // Interleaving blocks of A (units: bytes).
+    PrepareB,   // Transposing blocks of B, including the pretranspose (units: bytes).
+    Kernel,     // Running the kernel (units: multiply-accumulates).
+    Merge,      // Merging the results into C, with the output stage (units: bytes).
+    NumPhases
+};
+
+// Receiver of the time spent by a GEMM in each phase (optional).  The
+// threads executing the GEMM call record() concurrently, once per block
+// they have processed, so it must be thread safe.
+class ProfileSink {
+public:
+    virtual void record(ProfilePhase phase, uint64_t time_ns, uint64_t units) = 0;
+
+    virtual ~ProfileSink() { }
+};
+
 // Abstract class for the GEMM/GEMV functions.
 //
 // GEMM implementations may be "native" (never require any input
@@ -48,6 +136,10 @@ protected:
     int _ldc=0;
     int _C_batch_stride=0;
     int _C_multi_stride=0;
+    const Tr *_bias=nullptr;
+    int _bias_multi_stride=0;
+    Activation _act{};
+    ProfileSink *_profiler=nullptr;
 
 public:
     /* Pass in the pointers to the arrays to be operated on and their
@@ -70,6 +162,37 @@ public:
         _C_multi_stride = C_multi_stride;
     }
 
+    /* Output stage (optional): add a per-column bias and apply an
+     * activation to the results as they are written, rather than in
+     * separate passes over C.  The bias must remain allocated for the
+     * duration of any execute calls; nullptr disables it.  */
+    virtual void set_output_stage(const Tr *bias, const int bias_multi_stride, const Activation &act) {
+        _bias = bias;
+        _bias_multi_stride = bias_multi_stride;
+        _act = act;
+    }
+
+    /* Requantizing output stage (optional): write the requantized results
+     * to a uint8 output rather than C (see Requantize32).  Returns false if
+     * the implementation doesn't support it.  It changes how the GEMM is
+     * blocked, so it must first be called before querying the working space
+     * or pretransposed B sizes; later calls can update the pointers.  */
+    virtual bool set_requantize_stage(const Requantize32 &) { return false; }
+
+    /* Convolution (optional): gather the rows of A from an input feature
+     * map (see ConvolutionParameters).  Returns false if the implementation
+     * doesn't support it.  Like the requantizing stage it must be called
+     * before querying the working space size.  */
+    virtual bool set_convolution_parameters(const ConvolutionParameters &) { return false; }
+
+    /* Profiling (optional): report the time spent in each phase to a
+     * sink, which must remain allocated for the duration of any execute or
+     * pretranspose calls.  nullptr (the default) disables profiling, which
+     * then costs a test per block.  */
+    virtual void set_profiler(ProfileSink *profiler) {
+        _profiler = profiler;
+    }
+
     /* For threading, we divide the work into some number of units and work
      * out internally what unit corresponds to what work.  This returns the
      * total number of units.  */
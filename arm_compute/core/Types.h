@@ -1136,6 +1136,16 @@ private:
     GEMMReshapeInfo _reshape_info;
 };
 
+/** GEMMLowp output stage requantizing the S32 results to QASYMM8, as done by @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint */
+struct GEMMLowpOutputStageInfo
+{
+    int32_t result_fixedpoint_multiplier{ 0 }; /**< Fixed point value the results are multiplied by */
+    int32_t result_shift{ 0 };                 /**< Number of bits to shift right the results after the fixed point multiplication */
+    int32_t result_offset_after_shift{ 0 };    /**< Offset added to the results after the shift */
+    int32_t min{ 0 };                          /**< Min value the results are clamped to, if different from @p max */
+    int32_t max{ 0 };                          /**< Max value the results are clamped to, if different from @p min */
+};
+
 /** Winograd information */
 struct WinogradInfo
 {
@@ -1219,9 +1229,10 @@ struct IOFormatInfo
 /** Available ConvolutionMethod*/
 enum class ConvolutionMethod
 {
-    GEMM,    /**< Convolution using GEMM */
-    DIRECT,  /**< Direct convolution */
-    WINOGRAD /**< Convolution using Winograd */
+    GEMM,         /**< Convolution using GEMM */
+    DIRECT,       /**< Direct convolution */
+    WINOGRAD,     /**< Convolution using Winograd */
+    IMPLICIT_GEMM /**< Convolution using GEMM, gathering the rows of the im2col matrix on the fly rather than materialising it */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_TYPES_H__ */
@@ -28,12 +28,14 @@
 #include "arm_compute/graph/Edge.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphSerializer.h"
 #include "arm_compute/graph/IDeviceBackend.h"
 #include "arm_compute/graph/IGraphMutator.h"
 #include "arm_compute/graph/IGraphPrinter.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/INodeVisitor.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/MemoryPlan.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/TensorDescriptor.h"
 #include "arm_compute/graph/TypePrinter.h"
@@ -26,6 +26,7 @@
 
 #include "arm_compute/graph/Types.h"
 
+#include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 
 #include <map>
@@ -42,6 +43,7 @@ struct MemoryManagerContext
     std::shared_ptr<arm_compute::IMemoryManager> intra_mm    = { nullptr };             /**< Intra-function memory manager */
     std::shared_ptr<arm_compute::IMemoryManager> cross_mm    = { nullptr };             /**< Cross-function memory manager */
     std::shared_ptr<arm_compute::IMemoryGroup>   cross_group = { nullptr };             /**< Cross-function memory group */
+    std::shared_ptr<arm_compute::IAllocator>     allocator   = { nullptr };             /**< Allocator of the memory managers specific to the context, nullptr if they use the backend's one */
 };
 
 /** Graph context **/
@@ -28,6 +28,7 @@
 #include "arm_compute/graph/Workload.h"
 
 #include <map>
+#include <vector>
 
 namespace arm_compute
 {
@@ -72,6 +73,33 @@ public:
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Executes a graph on consecutive requests
+     *
+     * The input accessors are called to fetch each request and the output accessors to consume its results.
+     * If the graph has been finalized with @ref GraphConfig::num_pipeline_stages greater than 1,
+     * the requests overlap in the pipeline stages, otherwise they are executed one after the other.
+     *
+     * @param[in] graph        Graph to execute
+     * @param[in] num_requests Number of requests to execute
+     */
+    void execute_graph(Graph &graph, unsigned int num_requests);
+    /** Returns the occupancy of the pipeline stages of a graph during its last execution
+     *
+     * @param[in] graph Graph to inspect
+     *
+     * @return Fraction of the execution time each stage was busy. Empty if the graph is not pipelined.
+     */
+    std::vector<float> pipeline_stage_occupancy(Graph &graph) const;
+    /** Returns the memory plan of a finalized graph
+     *
+     * The plan lists the lifetime and placement of the transition buffers,
+     * the auxiliary memory of each function and the peak footprints.
+     *
+     * @param[in] graph Graph to inspect
+     *
+     * @return Memory plan of the graph
+     */
+    const MemoryPlan &memory_plan(const Graph &graph) const;
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_GRAPH_SERIALIZER_H__
+#define __ARM_COMPUTE_GRAPH_GRAPH_SERIALIZER_H__
+
+#include "arm_compute/graph/Types.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declaration
+class Graph;
+
+/** Graph serializer class
+ *
+ * Saves a graph in a single binary file holding its nodes, the descriptors of its input and constant tensors,
+ * and the data of its constants, and builds graphs back from such files.
+ * The files hold the version of their format and save enumerations as codes independent of their declaration order.
+ *
+ * The file is read through a private mapping. Deserialized constants whose backend tensors have the layout
+ * they were saved in are backed by the mapping instead of being allocated and copied.
+ */
+class GraphSerializer final
+{
+public:
+    /** Alignment of the constant data in the file */
+    static constexpr size_t data_alignment = 64;
+    /** Serializes a graph
+     *
+     * @note The graph must not have been finalized. Its nodes are saved in ID order, so each node must come after the nodes producing its inputs.
+     * @note The accessors of the constants are called to read their data, the ones of the input and output nodes are not saved.
+     *
+     * @param[in] g        Graph to serialize
+     * @param[in] filename File to write the graph to
+     */
+    static void serialize(Graph &g, const std::string &filename);
+    /** Deserializes a graph
+     *
+     * @note The accessors of the input and output nodes must be set before the graph is finalized
+     *
+     * @param[in] g        Graph to add the nodes to
+     * @param[in] filename File to read the graph from
+     * @param[in] target   Target of the nodes
+     */
+    static void deserialize(Graph &g, const std::string &filename, Target target);
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_GRAPH_SERIALIZER_H__ */
@@ -56,6 +56,11 @@ public:
      * @param[in] ctx Graph context
      */
     virtual void setup_backend_context(GraphContext &ctx) = 0;
+    /** Completes the setup of the given graph context once the first run of its graph is done
+     *
+     * @param[in] ctx Graph context
+     */
+    virtual void complete_backend_context(GraphContext &ctx) = 0;
     /** Checks if an instantiated backend is actually supported
      *
      * @return True if the backend is supported else false
@@ -100,6 +105,13 @@ public:
      * @return An error status
      */
     virtual Status validate_node(INode &node) = 0;
+    /** Gets the data layout preference of a node
+     *
+     * @param[in] node The node to query
+     *
+     * @return The data layout hint of the node
+     */
+    virtual DataLayoutHint data_layout_hint(INode &node) = 0;
     /** Create a backend memory manager given its affinity
      *
      * @param[in] affinity Memory Manager affinity
@@ -30,6 +30,9 @@
 
 namespace arm_compute
 {
+// Forward declarations
+class IMemoryRegion;
+
 namespace graph
 {
 /** Tensor accessor interface */
@@ -45,6 +48,19 @@ public:
      * @return True if access is successful else false
      */
     virtual bool access_tensor(ITensor &tensor) = 0;
+    /** Gets memory already holding the tensor data, which the tensor can be backed with instead of being allocated and filled
+     *
+     * @note The tensor is still accessed once backed with the memory
+     *
+     * @param[in] info Info of the backend tensor
+     *
+     * @return The memory to import, nullptr if the tensor data must be copied
+     */
+    virtual std::shared_ptr<IMemoryRegion> importable_memory(const ITensorInfo &info)
+    {
+        ARM_COMPUTE_UNUSED(info);
+        return nullptr;
+    }
 };
 
 using ITensorAccessorUPtr = std::unique_ptr<ITensorAccessor>;
@@ -27,10 +27,13 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/graph/Types.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 // Forward declarations
 class IMemoryGroup;
+class IMemoryRegion;
 
 namespace graph
 {
@@ -44,6 +47,13 @@ public:
     virtual void allocate() = 0;
     /** Allocates backend memory for the handle */
     virtual void free() = 0;
+    /** Backs the handle with existing memory instead of allocating it
+     *
+     * @param[in] memory Memory to import
+     *
+     * @return True if the memory has been imported, false if the handle must be allocated
+     */
+    virtual bool import_memory(std::shared_ptr<IMemoryRegion> memory) = 0;
     /** Set backend tensor to be managed by a memory group
      *
      * @param[in] mg Memory group
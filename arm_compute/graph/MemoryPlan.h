@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_MEMORYPLAN_H__
+#define __ARM_COMPUTE_GRAPH_MEMORYPLAN_H__
+
+#include "arm_compute/graph/Types.h"
+
+#include "arm_compute/runtime/Types.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Memory plan of a transition buffer: a tensor linking two nodes */
+struct TransitionMemoryPlan
+{
+    std::vector<TensorID> tensors{};                            /**< Graph tensors backed by the buffer, sub-tensors included */
+    Target                target{ Target::UNSPECIFIED };        /**< Target of the buffer */
+    size_t                size{ 0 };                            /**< Size in bytes */
+    unsigned int          start{ 0 };                           /**< Lifetime step at which the buffer is first used */
+    unsigned int          end{ 0 };                             /**< Lifetime step at which the buffer is last used */
+    MappingType           mapping_type{ MappingType::OFFSETS }; /**< Type of the mapping */
+    size_t                mapping{ 0 };                         /**< Offset in the transition memory, or blob index, depending on the mapping type */
+};
+
+/** Memory plan of the auxiliary buffers of the function of a node */
+struct FunctionMemoryPlan
+{
+    NodeID node{ EmptyNodeID }; /**< Node the function is bound to */
+    size_t size{ 0 };           /**< Size in bytes of the auxiliary buffers */
+};
+
+/** Memory plan of a graph
+ *
+ * A lifetime step is a task of the workload, or a segment of concurrent branches.
+ */
+struct MemoryPlan
+{
+    std::vector<TransitionMemoryPlan> transitions{};        /**< Managed transition buffers */
+    std::vector<FunctionMemoryPlan>   functions{};          /**< Functions that require auxiliary buffers */
+    std::vector<std::vector<NodeID>>  steps{};              /**< Nodes executed at each lifetime step */
+    size_t                            transition_peak{ 0 }; /**< Size in bytes of the memory backing the transition buffers */
+    unsigned int                      peak_step{ 0 };       /**< Lifetime step with the most transition memory in use */
+    size_t                            peak_step_size{ 0 };  /**< Transition memory in use at the peak step, in bytes */
+    size_t                            function_peak{ 0 };   /**< Largest auxiliary memory required by a function, in bytes */
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_MEMORYPLAN_H__ */
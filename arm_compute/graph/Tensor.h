@@ -82,6 +82,11 @@ public:
      * @return Backend tensor accessor
      */
     ITensorAccessor *accessor();
+    /** Extracts the backend tensor accessor, leaving the tensor without one
+     *
+     * @return The accessor of the tensor, nullptr if it had none
+     */
+    std::unique_ptr<ITensorAccessor> extract_accessor();
     /** Calls accessor on tensor
      *
      * @return True if the accessor was called else false
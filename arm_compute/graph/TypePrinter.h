@@ -288,6 +288,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const ConvolutionMethod &m
         case ConvolutionMethod::WINOGRAD:
             os << "WINOGRAD";
             break;
+        case ConvolutionMethod::IMPLICIT_GEMM:
+            os << "IMPLICIT_GEMM";
+            break;
         default:
             ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
     }
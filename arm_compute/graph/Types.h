@@ -74,10 +74,17 @@ class TensorDescriptor;
 /** Graph configuration structure */
 struct GraphConfig
 {
-    bool use_function_memory_manager{ true };   /**< Use a memory manager to manage per-funcion auxilary memory */
-    bool use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
-    bool use_tuner{ false };                    /**< Use a tuner in tunable backends */
-    int  num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
+    bool         use_function_memory_manager{ true };   /**< Use a memory manager to manage per-funcion auxilary memory */
+    bool         use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
+    bool         use_tuner{ false };                    /**< Use a tuner in tunable backends */
+    bool         use_huge_pages{ false };               /**< Back the large allocations of the graph's memory managers with transparent huge pages (NEON backend, memory leased from the arena excluded) */
+    bool         use_memory_arena{ false };             /**< Lease auxiliary memory from an arena shared by all graphs (NEON backend) */
+    bool         use_frozen_memory{ false };            /**< Bind memory once so that steady-state execution neither locks nor allocates (takes precedence over the memory arena) */
+    int          num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
+    unsigned int max_concurrent_branches{ 1 };          /**< Maximum number of independent branches to execute concurrently (thread capable backends), if 1 the nodes are executed one after the other. */
+    unsigned int num_pipeline_stages{ 1 };              /**< Number of stages to pipeline consecutive requests in (thread capable backends), if 1 the requests are executed one after the other. Takes precedence over max_concurrent_branches. */
+    bool         share_packed_weights{ false };         /**< Share the packed weights between the graphs built from the same model (NEON backend), implied by packed_weights_file */
+    std::string  packed_weights_file{};                 /**< File caching the weights packed by the first run (NEON backend), mapped by later processes instead of packing them again. Empty to disable */
 };
 
 /**< Device target types */
@@ -100,10 +107,11 @@ enum class EltwiseOperation
 /** Supported Convolution layer methods */
 enum class ConvolutionMethod
 {
-    DEFAULT, /**< Default approach using internal heuristics */
-    GEMM,    /**< GEMM based convolution */
-    DIRECT,  /**< Deep direct convolution */
-    WINOGRAD /**< Winograd based convolution */
+    DEFAULT,      /**< Default approach using internal heuristics */
+    GEMM,         /**< GEMM based convolution */
+    DIRECT,       /**< Deep direct convolution */
+    WINOGRAD,     /**< Winograd based convolution */
+    IMPLICIT_GEMM /**< GEMM based convolution without im2col matrix */
 };
 
 /** Supported Depthwise Convolution layer methods */
@@ -133,6 +141,7 @@ enum class NodeType
     FlattenLayer,
     FullyConnectedLayer,
     NormalizationLayer,
+    PermuteLayer,
     PoolingLayer,
     ReshapeLayer,
     ScaleLayer,
@@ -167,6 +176,13 @@ struct NodeParams
     std::string name;   /**< Node name */
     Target      target; /**< Node target */
 };
+
+/** Data layout preference of a node on a backend */
+struct DataLayoutHint
+{
+    bool supports_nhwc{ false }; /**< True if the backend can execute the node in NHWC */
+    int  nhwc_gain{ 0 };         /**< Estimated number of tensor passes saved by executing the node in NHWC, negative if NHWC is slower */
+};
 } // namespace graph
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_GRAPH_TYPES_H__ */
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_GRAPH_WORKLOAD_H__
 
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/MemoryPlan.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
 
@@ -42,6 +43,12 @@ class INode;
 class Tensor;
 class Graph;
 
+namespace detail
+{
+class ParallelBranchExecutor;
+class PipelineExecutor;
+} // namespace detail
+
 struct ExecutionTask;
 
 void execute_task(ExecutionTask &task);
@@ -79,14 +86,27 @@ struct ExecutionTask
     void prepare();
 };
 
+/** Execution segment
+ *
+ * Contiguous range of tasks of a workload split in branches which don't depend on each other
+ */
+struct ExecutionSegment
+{
+    std::vector<std::vector<unsigned int>> branches = {}; /**< Indices of the tasks of each branch, in execution order */
+};
+
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};          /**< Input handles */
-    std::vector<Tensor *>      outputs = {};          /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};          /**< Execution workload */
-    Graph                     *graph   = { nullptr }; /**< Graph bound to the workload */
-    GraphContext              *ctx     = { nullptr }; /**< Graph execution context */
+    std::vector<Tensor *>                           inputs            = {};          /**< Input handles */
+    std::vector<Tensor *>                           outputs           = {};          /**< Output handles */
+    std::vector<ExecutionTask>                      tasks             = {};          /**< Execution workload */
+    std::vector<ExecutionSegment>                   segments          = {};          /**< Execution segments, if empty the tasks are executed in order */
+    std::shared_ptr<detail::ParallelBranchExecutor> branch_executor   = { nullptr }; /**< Executor of the branches of the segments */
+    std::shared_ptr<detail::PipelineExecutor>       pipeline_executor = { nullptr }; /**< Executor of the pipeline stages, if null the requests are executed one after the other */
+    MemoryPlan                                      memory_plan       = {};          /**< Memory plan of the workload */
+    Graph                                          *graph             = { nullptr }; /**< Graph bound to the workload */
+    GraphContext                                   *ctx               = { nullptr }; /**< Graph execution context */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -25,5 +25,6 @@
 #define __ARM_COMPUTE_GRAPH_ALGORITHMS_H__
 
 #include "arm_compute/graph/algorithms/BFS.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
 
 #endif /* __ARM_COMPUTE_GRAPH_ALGORITHMS_H__ */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_ALGORITHM_TOPOLOGICAL_SORT_H__
+#define __ARM_COMPUTE_GRAPH_ALGORITHM_TOPOLOGICAL_SORT_H__
+
+#include "arm_compute/graph/Graph.h"
+
+#include <set>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Topological sort of the nodes of a graph
+ *
+ * Among the nodes whose producers are all sorted, the one with the smallest ID comes first:
+ * the order is the order of the IDs as long as the nodes are added after their producers,
+ * and the nodes inserted by the mutating passes run as soon as their inputs are computed.
+ *
+ * @param g Graph to sort
+ *
+ * @return A vector with the node ids in topological order
+ */
+inline std::vector<NodeID> topological_sort(const Graph &g)
+{
+    std::vector<NodeID> sorted_nodes;
+
+    // Count the producers of each node and find the nodes without any
+    std::vector<size_t> num_pending_inputs(g.nodes().size(), 0);
+    std::set<NodeID>    ready_nodes;
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr)
+        {
+            for(auto &eid : node->input_edges())
+            {
+                if(eid != EmptyEdgeID && g.edge(eid) != nullptr)
+                {
+                    ++num_pending_inputs[node->id()];
+                }
+            }
+            if(num_pending_inputs[node->id()] == 0)
+            {
+                ready_nodes.insert(node->id());
+            }
+        }
+    }
+
+    // Sort the ready node with the smallest ID and release its consumers
+    while(!ready_nodes.empty())
+    {
+        const NodeID nid = *ready_nodes.begin();
+        ready_nodes.erase(ready_nodes.begin());
+        sorted_nodes.push_back(nid);
+
+        for(auto &eid : g.node(nid)->output_edges())
+        {
+            const Edge *e = g.edge(eid);
+            ARM_COMPUTE_ERROR_ON(e == nullptr);
+            if(--num_pending_inputs[e->consumer_id()] == 0)
+            {
+                ready_nodes.insert(e->consumer_id());
+            }
+        }
+    }
+
+    return sorted_nodes;
+}
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_ALGORITHM_TOPOLOGICAL_SORT_H__ */
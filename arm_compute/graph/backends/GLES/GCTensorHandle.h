@@ -53,6 +53,7 @@ public:
     // Inherited overridden methods
     void allocate() override;
     void free() override;
+    bool import_memory(std::shared_ptr<IMemoryRegion> memory) override;
     void manage(IMemoryGroup *mg) override;
     void map(bool blocking) override;
     void                        unmap() override;
@@ -27,6 +27,11 @@
 #include "arm_compute/graph/IDeviceBackend.h"
 
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/MemoryArena.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+#include "arm_compute/runtime/NEON/NEPackedWeightsCache.h"
+
+#include <string>
 
 namespace arm_compute
 {
@@ -39,20 +44,33 @@ class NEDeviceBackend final : public IDeviceBackend
 {
 public:
     NEDeviceBackend();
+    /** Destructor */
+    ~NEDeviceBackend();
+    /** Switchs on or off the GEMM tuning
+     *
+     * @param[in] enable_tuning Enables tuning if true else false
+     */
+    void set_kernel_tuning(bool enable_tuning);
 
     // Inherited overridden methods
     void initialize_backend() override;
     void setup_backend_context(GraphContext &ctx) override;
+    void complete_backend_context(GraphContext &ctx) override;
     bool                           is_backend_supported() override;
     IAllocator                    *backend_allocator() override;
     std::unique_ptr<ITensorHandle> create_tensor(const Tensor &tensor) override;
     std::unique_ptr<ITensorHandle> create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) override;
     std::unique_ptr<arm_compute::IFunction> configure_node(INode &node, GraphContext &ctx) override;
     Status validate_node(INode &node) override;
+    DataLayoutHint data_layout_hint(INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) override;
 
 private:
-    Allocator _allocator; /**< NEON backend allocator */
+    NEGEMMTuner          _gemm_tuner;         /**< Assembly GEMM tuner */
+    NEPackedWeightsCache _weights_cache;      /**< Cache of the packed weights */
+    std::string          _weights_cache_file; /**< File the packed weights cache was loaded from */
+    Allocator            _allocator;          /**< NEON backend allocator */
+    MemoryArena          _arena;              /**< Memory arena shared by the graphs that request it */
 };
 } // namespace backends
 } // namespace graph
@@ -24,6 +24,8 @@
 #ifndef __ARM_COMPUTE_GRAPH_NENODEVALIDATOR_H__
 #define __ARM_COMPUTE_GRAPH_NENODEVALIDATOR_H__
 
+#include "arm_compute/graph/Types.h"
+
 #include "arm_compute/core/Error.h"
 
 namespace arm_compute
@@ -45,6 +47,15 @@ public:
      * @return An error status
      */
     static Status validate(INode *node);
+    /** Gets the data layout preference of a node
+     *
+     * @note Checks if the node can run on NHWC tensors and estimates the tensor passes it would save
+     *
+     * @param[in] node Node to query
+     *
+     * @return The data layout hint of the node
+     */
+    static DataLayoutHint data_layout_hint(INode *node);
 };
 } // namespace backends
 } // namespace graph
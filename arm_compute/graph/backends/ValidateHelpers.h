@@ -54,16 +54,17 @@ inline arm_compute::ITensorInfo *get_backing_tensor_info(arm_compute::graph::Ten
 
 /** Validates a Convolution layer node
  *
- * @tparam ConvolutionLayer          Default Convolution layer function type
- * @tparam DirectConvolutionLayer    Direct Convolution layer function type
- * @tparam GEMMConvolutionLayer      GEMM Convolution layer function type
- * @tparam WinogradConvolutionLayer  Winograd Convolution layer function type
+ * @tparam ConvolutionLayer             Default Convolution layer function type
+ * @tparam DirectConvolutionLayer       Direct Convolution layer function type
+ * @tparam GEMMConvolutionLayer         GEMM Convolution layer function type
+ * @tparam WinogradConvolutionLayer     Winograd Convolution layer function type
+ * @tparam ImplicitGEMMConvolutionLayer Implicit GEMM Convolution layer function type, the default one on backends without such convolution
  *
  * @param[in] node Node to validate
  *
  * @return Status
  */
-template <typename ConvolutionLayer, typename DirectConvolutionLayer, typename GEMMConvolutionLayer, typename WinogradConvolutionLayer>
+template <typename ConvolutionLayer, typename DirectConvolutionLayer, typename GEMMConvolutionLayer, typename WinogradConvolutionLayer, typename ImplicitGEMMConvolutionLayer>
 Status validate_convolution_layer(ConvolutionLayerNode &node)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating ConvolutionLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
@@ -81,24 +82,30 @@ Status validate_convolution_layer(ConvolutionLayerNode &node)
         biases->set_data_type(DataType::S32);
     }
 
-    const PadStrideInfo     conv_info      = node.convolution_info();
-    const ConvolutionMethod conv_algorithm = node.convolution_method();
+    const PadStrideInfo       conv_info      = node.convolution_info();
+    const ConvolutionMethod   conv_algorithm = node.convolution_method();
+    const ActivationLayerInfo fused_act      = node.fused_activation();
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.num_groups() != 1, "Grouped convolutions must be split into a convolution per group");
 
     // Validate function
     Status status{};
     switch(conv_algorithm)
     {
         case ConvolutionMethod::DIRECT:
-            status = DirectConvolutionLayer::validate(input, weights, biases, output, conv_info);
+            status = DirectConvolutionLayer::validate(input, weights, biases, output, conv_info, fused_act);
             break;
         case ConvolutionMethod::GEMM:
-            status = GEMMConvolutionLayer::validate(input, weights, biases, output, conv_info);
+            status = GEMMConvolutionLayer::validate(input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act);
             break;
         case ConvolutionMethod::WINOGRAD:
-            status = WinogradConvolutionLayer::validate(input, weights, biases, output, conv_info /*, fast_math*/);
+            status = WinogradConvolutionLayer::validate(input, weights, biases, output, conv_info, fused_act /*, fast_math*/);
+            break;
+        case ConvolutionMethod::IMPLICIT_GEMM:
+            status = ImplicitGEMMConvolutionLayer::validate(input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act);
             break;
         case ConvolutionMethod::DEFAULT:
-            status = ConvolutionLayer::validate(input, weights, biases, output, conv_info);
+            status = ConvolutionLayer::validate(input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act);
             break;
         default:
             break;
@@ -107,7 +114,7 @@ Status validate_convolution_layer(ConvolutionLayerNode &node)
     // If validation fails try the Default approach
     if(!bool(status))
     {
-        status = ConvolutionLayer::validate(input, weights, biases, output, conv_info /*, fast_math*/);
+        status = ConvolutionLayer::validate(input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act /*, fast_math*/);
         if(bool(status))
         {
             ARM_COMPUTE_LOG_GRAPH_INFO("Switched ConvolutionLayer method of node with ID : "
@@ -119,6 +126,31 @@ Status validate_convolution_layer(ConvolutionLayerNode &node)
     return status;
 }
 
+/** Validates a grouped Convolution layer node
+ *
+ * @tparam GroupedConvolutionLayer Grouped Convolution layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename GroupedConvolutionLayer>
+Status validate_grouped_convolution_layer(ConvolutionLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating grouped ConvolutionLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *output  = get_backing_tensor_info(node.output(0));
+
+    // Validate function
+    return GroupedConvolutionLayer::validate(input, weights, biases, output, node.convolution_info(), node.num_groups(), node.fused_activation());
+}
+
 /** Validates a Depthwise Convolution layer node
  *
  * @tparam DepthwiseConvolutionLayer    Default Depthwise Convolution layer type
@@ -26,19 +26,29 @@
 
 #include "arm_compute/graph/Types.h"
 
+#include <memory>
+#include <vector>
+
 namespace arm_compute
 {
+// Forward declarations
+class IScheduler;
+
 namespace graph
 {
 // Forward declarations
 class Graph;
 class GraphContext;
 class ExecutionWorkload;
+struct ExecutionSegment;
 class Tensor;
 class INode;
 
 namespace detail
 {
+// Forward declarations
+class ParallelBranchExecutor;
+
 /** Initializes the available backends **/
 void default_initialize_backends();
 /** Validates all nodes
@@ -46,7 +56,9 @@ void default_initialize_backends();
  * @param[in] g Graph to validate
  */
 void validate_all_nodes(Graph &g);
-/** Configures all nodes of a graph
+/** Configures all tensors of a graph
+ *
+ * @note Tensors which already have a backend handle are left untouched
  *
  * @param[in] g Graph to configure
  */
@@ -61,7 +73,14 @@ void allocate_all_input_tensors(INode &node);
  * @param[in] node Node to allocate the output tensor of
  */
 void allocate_all_output_tensors(INode &node);
+/** Backs the output tensor of a const node with the memory its accessor holds the data in, else allocates it
+ *
+ * @param[in] node Const node to allocate the output tensor of
+ */
+void import_or_allocate_const_tensor(INode &node);
 /** Allocates const tensor of a given graph
+ *
+ * @note Const tensors are backed with the memory their accessors hold the data in when possible
  *
  * @param[in] g Graph to allocate the tensors
  */
@@ -73,12 +92,17 @@ void allocate_const_tensors(Graph &g);
 void allocate_all_tensors(Graph &g);
 /** Configures all nodes of graph
  *
- * @param[in] g   Graph to configure the nodes
- * @param[in] ctx Graph context to use
+ * The functions split their kernels for the number of threads of the scheduler they are configured with,
+ * so each node must be configured with the scheduler it will be executed on.
+ *
+ * @param[in] g               Graph to configure the nodes
+ * @param[in] ctx             Graph context to use
+ * @param[in] node_schedulers (Optional) Scheduler to configure each node with, indexed by node ID.
+ *                            The nodes without a scheduler are configured with the scheduler of the calling thread.
  *
  * @return The execution workload
  */
-ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx);
+ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<IScheduler *> &node_schedulers = {});
 /** Release the memory of all unused const nodes
  *
  * @param[in] g Graph to release the memory from
@@ -104,6 +128,40 @@ void call_all_input_node_accessors(ExecutionWorkload &workload);
  * @param[in] workload Workload to execute
  */
 void call_all_output_node_accessors(ExecutionWorkload &workload);
+/** Splits the compute nodes of a graph in segments of independent branches
+ *
+ * Consecutive nodes which don't depend on each other are grouped in parallel segments,
+ * whose branches are executed concurrently by a @ref ParallelBranchExecutor.
+ *
+ * @note Must be called before the nodes are configured, so that the nodes of each branch can be configured with the scheduler of their branch.
+ * @note Returns no segment if the library is not built with cppthreads=1 or if the graph has no independent branches
+ *
+ * @param[in] g                       Graph to split
+ * @param[in] max_concurrent_branches Maximum number of branches to execute concurrently
+ *
+ * @return The segments of the graph, holding node IDs
+ */
+std::vector<ExecutionSegment> split_execution_segments(Graph &g, unsigned int max_concurrent_branches);
+/** Sets the execution segments of a configured workload
+ *
+ * The nodes of the segments which didn't create a task are dropped. The branches of the parallel segments
+ * are kept in place, even if empty, as their index selects the scheduler they are executed with.
+ *
+ * @param[in, out] workload        Workload to split
+ * @param[in]      node_segments   Segments of the graph of the workload returned by @ref split_execution_segments
+ * @param[in]      branch_executor Executor of the branches of the parallel segments
+ */
+void configure_execution_segments(ExecutionWorkload &workload, const std::vector<ExecutionSegment> &node_segments, std::shared_ptr<ParallelBranchExecutor> branch_executor);
+/** Freezes the pool managers of the memory managers of a graph context
+ *
+ * The memory groups bind to their pool on their first acquisition and stay bound,
+ * so that later executions neither lock nor update the memory mappings.
+ *
+ * @note The memory managers must be finalized and use a single pool
+ *
+ * @param[in] ctx Graph context
+ */
+void freeze_memory_managers(GraphContext &ctx);
 /** Prepares all tasks for execution
  *
  * @param[in] workload Workload to prepare
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_DETAIL_PARALLEL_BRANCH_EXECUTOR_H__
+#define __ARM_COMPUTE_GRAPH_DETAIL_PARALLEL_BRANCH_EXECUTOR_H__
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class CPPScheduler;
+class IScheduler;
+
+namespace graph
+{
+// Forward declarations
+struct ExecutionSegment;
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Pool of threads executing the branches of an execution segment concurrently
+ *
+ * Each thread owns a @ref CPPScheduler which is used by the functions of the branches it executes,
+ * so that the threads of the process are shared between the concurrent branches.
+ *
+ * @note Only available when the library is built with cppthreads=1
+ */
+class ParallelBranchExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @note The schedulers of the branches take the assembly GEMM settings of the scheduler of the calling thread.
+     *
+     * @param[in] num_branches Maximum number of branches to execute concurrently. Must be greater than 0.
+     * @param[in] num_threads  Total number of threads to share between the concurrent branches.
+     *                         If 0 the maximum number of threads supported by C++11 will be used.
+     */
+    ParallelBranchExecutor(unsigned int num_branches, unsigned int num_threads);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ParallelBranchExecutor(const ParallelBranchExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ParallelBranchExecutor &operator=(const ParallelBranchExecutor &) = delete;
+    /** Destructor: joins the threads */
+    ~ParallelBranchExecutor();
+    /** Executes the branches of a segment and waits for them to complete
+     *
+     * The i-th branch is executed by the thread i % num_branches(), the branches assigned
+     * to the same thread are executed in order.
+     *
+     * @note If a task throws, the first exception is rethrown once all the branches have completed.
+     *
+     * @param[in] workload Workload the segment belongs to
+     * @param[in] segment  Segment to execute
+     */
+    void run(ExecutionWorkload &workload, const ExecutionSegment &segment);
+    /** Returns the scheduler each node of the parallel segments is executed with
+     *
+     * The nodes must be configured with these schedulers, as the functions split their kernels for the number of threads
+     * of the scheduler they are configured with.
+     *
+     * @param[in] segments  Segments holding node IDs
+     * @param[in] num_nodes Number of nodes of the graph
+     *
+     * @return The scheduler of each node, indexed by node ID. nullptr for the nodes executed by the calling thread.
+     */
+    std::vector<IScheduler *> node_schedulers(const std::vector<ExecutionSegment> &segments, size_t num_nodes) const;
+    /** Returns the maximum number of branches executed concurrently
+     *
+     * @return Number of branch threads
+     */
+    unsigned int num_branches() const;
+
+private:
+    /** Main loop of a branch thread
+     *
+     * @param[in] id Index of the thread
+     */
+    void worker_loop(unsigned int id);
+
+    std::vector<std::unique_ptr<CPPScheduler>>                  _schedulers;
+    std::vector<std::vector<const std::vector<unsigned int> *>> _jobs;
+    std::vector<std::thread>                                    _threads;
+    ExecutionWorkload                                          *_workload;
+    std::mutex                                                  _mtx;
+    std::condition_variable                                     _work_cv;
+    std::condition_variable                                     _done_cv;
+    unsigned int                                                _generation;
+    unsigned int                                                _pending;
+    bool                                                        _exit;
+    std::exception_ptr                                          _exception;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_DETAIL_PARALLEL_BRANCH_EXECUTOR_H__ */
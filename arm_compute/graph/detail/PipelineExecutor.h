@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_DETAIL_PIPELINE_EXECUTOR_H__
+#define __ARM_COMPUTE_GRAPH_DETAIL_PIPELINE_EXECUTOR_H__
+
+#include "arm_compute/graph/Types.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class CPPScheduler;
+class IMemoryRegion;
+class IScheduler;
+
+namespace graph
+{
+// Forward declarations
+class Graph;
+class ITensorHandle;
+class Tensor;
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Tensor crossing the boundary between two pipeline stages */
+struct PipelineTransfer
+{
+    Tensor      *src            = { nullptr }; /**< Tensor written by the producer stage */
+    Tensor      *dst            = { nullptr }; /**< Tensor read by the consumer stage, backed by the buffers of the source tensor */
+    unsigned int producer_stage = { 0 };       /**< Index of the producer stage */
+    unsigned int consumer_stage = { 0 };       /**< Index of the consumer stage */
+};
+
+/** Partition of a graph in pipeline stages */
+struct PipelineStages
+{
+    unsigned int                  num_stages  = { 1 }; /**< Number of stages */
+    std::vector<unsigned int>     node_stages = {};    /**< Stage of each node, indexed by node ID */
+    std::vector<PipelineTransfer> transfers   = {};    /**< Tensors crossing the stage boundaries */
+};
+
+/** Splits a graph in pipeline stages of similar estimated cost
+ *
+ * The nodes are kept in execution order and cut in contiguous stages.
+ * Each tensor produced in a stage and consumed in a later one gets a separate tensor for the consumer stage,
+ * so that the two stages never access the same tensor object.
+ * Boundaries crossed by sub-tensors, in-place tensors or graph outputs are not considered.
+ *
+ * @note Must be called after the tensor handles have been created and before the nodes are configured.
+ * @note Returns a single stage if the library is not built with cppthreads=1
+ *
+ * @param[in, out] g          Graph to split
+ * @param[in]      num_stages Requested number of stages. Fewer stages are created if the graph doesn't have enough valid boundaries.
+ *
+ * @return The stages of the graph
+ */
+PipelineStages configure_pipeline_stages(Graph &g, unsigned int num_stages);
+
+/** Executes consecutive requests of a workload in pipeline
+ *
+ * Each stage runs on its own thread and owns a @ref CPPScheduler, the threads of the process
+ * being shared between the stages. While stage i processes request k, stage i - 1 can process request k + 1.
+ * The stage threads are created once and wait for the requests of the next run between two runs.
+ *
+ * Tensors crossing a stage boundary are backed by a ring of buffers: the producer stage writes request k
+ * to the k-th buffer of the ring, which the consumer stages then read in place.
+ *
+ * The input accessors are called by the first stage and the output accessors by the last stage, once per request.
+ *
+ * @note Only available when the library is built with cppthreads=1
+ */
+class PipelineExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @note The schedulers of the stages take the assembly GEMM settings of the scheduler of the calling thread.
+     *
+     * @param[in] stages      Stages of the graph to execute
+     * @param[in] num_threads Total number of threads to share between the stages. If 0 the maximum number of threads supported by C++11 will be used.
+     */
+    PipelineExecutor(PipelineStages stages, unsigned int num_threads);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    PipelineExecutor(const PipelineExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    PipelineExecutor &operator=(const PipelineExecutor &) = delete;
+    /** Destructor: joins the threads */
+    ~PipelineExecutor();
+    /** Returns the scheduler each node is executed with
+     *
+     * The nodes must be configured with these schedulers, as the functions split their kernels for the number of threads
+     * of the scheduler they are configured with.
+     *
+     * @return The scheduler of each node, indexed by node ID
+     */
+    std::vector<IScheduler *> node_schedulers() const;
+    /** Assigns the tasks of a workload to the stages and backs the tensors crossing the stage boundaries with the buffer rings
+     *
+     * @note Must be called after the nodes are configured and before the tensors are allocated.
+     *
+     * @param[in] workload Configured workload
+     */
+    void configure(const ExecutionWorkload &workload);
+    /** Executes a number of requests and waits for them to complete
+     *
+     * @note If a task or an accessor throws, the pipeline is stopped and the first exception is rethrown.
+     *
+     * @param[in] workload     Workload to execute
+     * @param[in] num_requests Number of requests to execute
+     */
+    void run(ExecutionWorkload &workload, unsigned int num_requests);
+    /** Returns the number of stages of the pipeline
+     *
+     * @return Number of stages
+     */
+    unsigned int num_stages() const;
+    /** Returns the occupancy of each stage during the last call to @ref run
+     *
+     * @return Fraction of the execution time each stage spent running tasks and accessors
+     */
+    std::vector<float> occupancy() const;
+
+private:
+    /** Main loop of a stage thread
+     *
+     * @param[in] stage Index of the stage
+     */
+    void worker_loop(unsigned int stage);
+    /** Executes the requests of a run in a stage
+     *
+     * @param[in] workload     Workload to execute
+     * @param[in] stage        Index of the stage
+     * @param[in] num_requests Number of requests to execute
+     */
+    void stage_loop(ExecutionWorkload &workload, unsigned int stage, unsigned int num_requests);
+
+    /** Ring of buffers backing a tensor crossing stage boundaries */
+    struct TransferBuffers
+    {
+        ITensorHandle                              *src             = { nullptr }; /**< Handle written by the producer stage */
+        std::vector<ITensorHandle *>                dsts            = {};          /**< Handles read by the consumer stages */
+        std::vector<unsigned int>                   consumer_stages = {};          /**< Index of the consumer stage of each handle */
+        unsigned int                                producer_stage  = { 0 };       /**< Index of the producer stage */
+        std::vector<std::shared_ptr<IMemoryRegion>> buffers         = {};          /**< One buffer per request in flight */
+    };
+
+    PipelineStages                             _stages;
+    std::vector<std::vector<unsigned int>>     _stage_tasks;
+    std::vector<TransferBuffers>               _transfer_buffers;
+    std::vector<std::unique_ptr<CPPScheduler>> _schedulers;
+    std::vector<std::thread>                   _threads;
+    ExecutionWorkload                         *_workload;
+    unsigned int                               _num_requests;
+    unsigned int                               _generation;
+    unsigned int                               _pending;
+    bool                                       _exit;
+    std::vector<unsigned int>                  _done;
+    std::vector<double>                        _busy_time;
+    double                                     _total_time;
+    bool                                       _abort;
+    std::exception_ptr                         _exception;
+    mutable std::mutex                         _mtx;
+    std::condition_variable                    _cv;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_DETAIL_PIPELINE_EXECUTOR_H__ */
@@ -67,6 +67,23 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Executes the stream on consecutive requests
+     *
+     * @note The requests overlap if the stream has been finalized with @ref GraphConfig::num_pipeline_stages greater than 1
+     *
+     * @param[in] num_requests Number of requests to execute
+     */
+    void run(unsigned int num_requests);
+    /** Returns the occupancy of the pipeline stages during the last execution
+     *
+     * @return Fraction of the execution time each stage was busy. Empty if the stream is not pipelined.
+     */
+    std::vector<float> pipeline_stage_occupancy();
+    /** Returns the memory plan of the finalized stream
+     *
+     * @return Memory plan
+     */
+    const MemoryPlan &memory_plan() const;
 
     // Inherited overridden methods
     void add_layer(ILayer &layer) override;
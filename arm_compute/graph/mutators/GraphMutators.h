@@ -24,6 +24,8 @@
 #ifndef __ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H__
 #define __ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H__
 
+#include "arm_compute/graph/mutators/BatchNormalizationFoldingMutator.h"
+#include "arm_compute/graph/mutators/DataLayoutMutator.h"
 #include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
@@ -37,6 +37,27 @@ namespace detail
  * @param[in] g Graph to perform operation fusion on
  */
 void fuse_batch_norm_with_activation(Graph &g);
+/** Fused convolution with activation
+ *
+ * @note Only convolutions running on NEON with non quantized outputs are fused
+ *
+ * @param[in] g Graph to perform operation fusion on
+ */
+void fuse_convolution_with_activation(Graph &g);
+/** Fused depthwise convolution with activation
+ *
+ * @note Only depthwise convolutions running on NEON with non quantized outputs are fused
+ *
+ * @param[in] g Graph to perform operation fusion on
+ */
+void fuse_depthwise_convolution_with_activation(Graph &g);
+/** Fused fully connected layer with activation
+ *
+ * @note Only fully connected layers running on NEON with non quantized outputs are fused
+ *
+ * @param[in] g Graph to perform operation fusion on
+ */
+void fuse_fully_connected_with_activation(Graph &g);
 } // namespace detail
 
 /** Mutation pass to fuss nodes */
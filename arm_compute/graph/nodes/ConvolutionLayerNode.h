@@ -37,11 +37,12 @@ public:
     /** Constructor
      *
      * @param[in] info           Convolution layer attributes
+     * @param[in] num_groups     (Optional) Number of groups the input and output channels are split in
      * @param[in] method         (Optional) Convolution method to use
      * @param[in] fast_math_hint (Optional) Fast math hint
      * @param[in] out_quant_info (Optional) Output quantization info
      */
-    ConvolutionLayerNode(PadStrideInfo info, ConvolutionMethod method = ConvolutionMethod::DEFAULT, FastMathHint fast_math_hint = FastMathHint::DISABLED,
+    ConvolutionLayerNode(PadStrideInfo info, unsigned int num_groups = 1, ConvolutionMethod method = ConvolutionMethod::DEFAULT, FastMathHint fast_math_hint = FastMathHint::DISABLED,
                          QuantizationInfo out_quant_info = QuantizationInfo());
     /** Sets the convolution layer method to use
      *
@@ -71,6 +72,21 @@ public:
      * @return Convolution information
      */
     PadStrideInfo convolution_info() const;
+    /** Number of groups accessor
+     *
+     * @return Number of groups of the convolution
+     */
+    unsigned int num_groups() const;
+    /** Returns fused activation
+     *
+     * @return Fused activation
+     */
+    ActivationLayerInfo fused_activation() const;
+    /** Sets fused activation
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_fused_activation(ActivationLayerInfo fused_activation);
     /** Computes convolution output descriptor
      *
      * @param[in] input_descriptor   Input descriptor
@@ -90,10 +106,12 @@ public:
     void accept(INodeVisitor &v) override;
 
 private:
-    PadStrideInfo     _info;
-    ConvolutionMethod _method;
-    FastMathHint      _fast_math_hint;
-    QuantizationInfo  _out_quant_info;
+    PadStrideInfo       _info;
+    unsigned int        _num_groups;
+    ConvolutionMethod   _method;
+    FastMathHint        _fast_math_hint;
+    QuantizationInfo    _out_quant_info;
+    ActivationLayerInfo _fused_activation;
 };
 } // namespace graph
 } // namespace arm_compute
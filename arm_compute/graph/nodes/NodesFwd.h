@@ -42,6 +42,7 @@ class FullyConnectedLayerNode;
 class InputNode;
 class NormalizationLayerNode;
 class OutputNode;
+class PermuteLayerNode;
 class PoolingLayerNode;
 class ReshapeLayerNode;
 class SoftmaxLayerNode;
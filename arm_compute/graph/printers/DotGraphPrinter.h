@@ -27,6 +27,7 @@
 #include "arm_compute/graph/IGraphPrinter.h"
 
 #include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/MemoryPlan.h"
 
 #include <string>
 
@@ -56,6 +57,7 @@ public:
     void visit(DepthConcatenateLayerNode &n) override;
     void visit(DepthwiseConvolutionLayerNode &n) override;
     void visit(EltwiseLayerNode &n) override;
+    void visit(FullyConnectedLayerNode &n) override;
     void visit(NormalizationLayerNode &n) override;
     void visit(PoolingLayerNode &n) override;
     void default_visit() override;
@@ -68,6 +70,16 @@ private:
 class DotGraphPrinter final : public IGraphPrinter
 {
 public:
+    /** Constructor
+     *
+     * @note memory_plan should outlive the printer
+     *
+     * @param[in] memory_plan (Optional) Memory plan of the graph. If given, nodes are annotated with
+     *                        the auxiliary memory of their function and edges with the lifetime and
+     *                        placement of their transition buffer.
+     */
+    DotGraphPrinter(const MemoryPlan *memory_plan = nullptr);
+
     // Inherited methods overridden
     void print(const Graph &g, std::ostream &os) override;
 
@@ -98,7 +110,8 @@ private:
     void print_edges(const Graph &g, std::ostream &os);
 
 private:
-    DotGraphVisitor _dot_node_visitor = {};
+    DotGraphVisitor   _dot_node_visitor = {};
+    const MemoryPlan *_memory_plan;
 };
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_JSONMEMORYPLANPRINTER_H__
+#define __ARM_COMPUTE_GRAPH_JSONMEMORYPLANPRINTER_H__
+
+#include "arm_compute/graph/IGraphPrinter.h"
+
+#include "arm_compute/graph/MemoryPlan.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Prints the memory plan of a graph in JSON format */
+class JsonMemoryPlanPrinter final : public IGraphPrinter
+{
+public:
+    /** Constructor
+     *
+     * @note memory_plan should outlive the printer
+     *
+     * @param[in] memory_plan Memory plan of the graph to print
+     */
+    JsonMemoryPlanPrinter(const MemoryPlan &memory_plan);
+
+    // Inherited methods overridden
+    void print(const Graph &g, std::ostream &os) override;
+
+private:
+    const MemoryPlan &_memory_plan;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_JSONMEMORYPLANPRINTER_H__ */
@@ -25,5 +25,6 @@
 #define __ARM_COMPUTE_GRAPH_PRINTERS_H__
 
 #include "arm_compute/graph/printers/DotGraphPrinter.h"
+#include "arm_compute/graph/printers/JsonMemoryPlanPrinter.h"
 
 #endif /* __ARM_COMPUTE_GRAPH_PRINTERS_H__ */
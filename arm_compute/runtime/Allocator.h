@@ -27,22 +27,60 @@
 #include "arm_compute/runtime/IAllocator.h"
 
 #include "arm_compute/runtime/IMemoryRegion.h"
+#include "arm_compute/runtime/Types.h"
+
+#include "support/Mutex.h"
 
 #include <cstddef>
+#include <map>
 
 namespace arm_compute
 {
-/** Default malloc allocator implementation */
+/** Default malloc allocator implementation
+ *
+ * Allocations are aligned to at least the size of a cache line.
+ * Large allocations can be backed by huge pages to reduce the number of TLB misses.
+ */
 class Allocator final : public IAllocator
 {
 public:
-    /** Default constructor */
-    Allocator() = default;
+    /** Minimum alignment of the allocations in bytes */
+    static constexpr size_t cache_line_size = 64;
+    /** Size of a huge page in bytes */
+    static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+    /** Default constructor: only use regular pages */
+    Allocator();
+    /** Constructor
+     *
+     * @param[in] huge_pages          Huge pages policy
+     * @param[in] huge_page_threshold (Optional) Minimum size in bytes of the allocations backed by huge pages
+     */
+    Allocator(HugePagePolicy huge_pages, size_t huge_page_threshold = huge_page_size);
+    /** Sets the huge pages policy of the allocations to come
+     *
+     * @note Memory allocated with a previous policy can still be freed by this allocator.
+     *
+     * @param[in] huge_pages          Huge pages policy
+     * @param[in] huge_page_threshold (Optional) Minimum size in bytes of the allocations backed by huge pages
+     */
+    void set_huge_pages(HugePagePolicy huge_pages, size_t huge_page_threshold = huge_page_size);
+    /** Returns the huge pages policy
+     *
+     * @return Huge pages policy
+     */
+    HugePagePolicy huge_pages() const;
 
     // Inherited methods overridden:
     void *allocate(size_t size, size_t alignment) override;
     void free(void *ptr) override;
     std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    HugePagePolicy           _huge_pages;
+    size_t                   _huge_page_threshold;
+    arm_compute::Mutex       _mtx;
+    std::map<void *, size_t> _mapped_regions;
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_ALLOCATOR_H__ */
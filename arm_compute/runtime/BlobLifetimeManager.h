@@ -53,6 +53,7 @@ public:
 
     // Inherited methods overridden:
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    std::unique_ptr<IMemoryPool> create_pool(MemoryArena *arena) override;
     MappingType mapping_type() const override;
 
 private:
@@ -35,6 +35,7 @@
 namespace arm_compute
 {
 class IAllocator;
+class MemoryArena;
 
 /** Blob memory pool */
 class BlobMemoryPool : public IMemoryPool
@@ -48,6 +49,14 @@ public:
      * @param[in] blob_sizes Sizes of the blobs to be allocated
      */
     BlobMemoryPool(IAllocator *allocator, std::vector<size_t> blob_sizes);
+    /** Constructor of a pool that leases its blobs from an arena on acquire
+     *
+     * @note arena should outlive the memory pool
+     *
+     * @param[in] arena      Memory arena to lease from
+     * @param[in] blob_sizes Sizes of the blobs to be leased
+     */
+    BlobMemoryPool(MemoryArena *arena, std::vector<size_t> blob_sizes);
     /** Default Destructor */
     ~BlobMemoryPool();
     /** Prevent instances of this class to be copy constructed */
@@ -66,16 +75,17 @@ public:
     std::unique_ptr<IMemoryPool> duplicate() override;
 
 private:
-    /** Allocates internal blobs
+    /** Allocates (or leases from the arena) internal blobs
      *
      * @param sizes Size of each blob
      */
     void allocate_blobs(const std::vector<size_t> &sizes);
-    /** Frees blobs **/
+    /** Frees (or returns to the arena) blobs **/
     void free_blobs();
 
 private:
     IAllocator         *_allocator;  /**< Allocator to use for internal allocation */
+    MemoryArena        *_arena;      /**< Arena to lease the blobs from */
     std::vector<void *> _blobs;      /**< Vector holding all the memory blobs */
     std::vector<size_t> _blob_sizes; /**< Sizes of each blob */
 };
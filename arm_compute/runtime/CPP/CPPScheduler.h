@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2017 ARM Limited.
+ * Copyright (c) 2016-2018 ARM Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,15 +27,26 @@
 #include "arm_compute/runtime/IScheduler.h"
 
 #include <list>
+#include <memory>
+#include <vector>
 
 namespace arm_compute
 {
 class Thread;
+class WorkStealingRange;
+class AsyncKernelQueue;
 
 /** C++11 implementation of a pool of threads to automatically split a kernel's execution among several threads. */
 class CPPScheduler : public IScheduler
 {
 public:
+    /** Constructor: create a pool of threads.
+     *
+     * @note Use @ref get() to access the scheduler shared by the whole process.
+     */
+    CPPScheduler();
+    /** Destructor: waits for the asynchronously submitted kernels to complete */
+    ~CPPScheduler();
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
      * @param[in] num_threads If set to 0, then the maximum number of threads supported by C++11 will be used, otherwise the number of threads specified.
@@ -58,17 +69,79 @@ public:
      * - ICPPKernel::is_parallelisable() returns false
      * - The scheduler has been initialized with only one thread.
      *
-     * @param[in] kernel          Kernel to execute.
-     * @param[in] split_dimension Dimension along which to split the kernel's execution window.
+     * With the @ref IScheduler::StrategyHint::DYNAMIC strategy the window is split in
+     * num_threads * @ref dynamic_workloads_per_thread() chunks. Each thread first runs the chunks it owns
+     * and then steals the remaining chunks of the slower threads.
+     *
+     * @warning The dynamic strategy runs a kernel several times on the same thread (With the same ThreadInfo::thread_id),
+     *          so it must only be used with kernels which only rely on the window they are given.
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler.
+     */
+    void schedule(ICPPKernel *kernel, const Hints &hints) override;
+    /** Push the windows of the passed kernel to the queue of asynchronous work and return straight away.
+     *
+     * Idle threads of the pool drain the queue, and so does the thread calling @ref wait or @ref barrier.
+     * Kernels submitted back to back therefore overlap without a barrier between them.
+     *
+     * @note The window is always split statically: the i-th window of the kernel runs with ThreadInfo::thread_id = i.
+     * @note @ref schedule starts with a @ref barrier, so synchronous and asynchronous kernels never overlap.
+     * @note Nothing is allocated: the states of the kernels are reused in turn, so with too many kernels in flight
+     *       the queue is drained until the oldest one has completed. The exception of a kernel is only reported
+     *       by @ref wait as long as its token is waited for before 16 more kernels are submitted.
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler (The strategy is ignored).
+     *
+     * @return Token to pass to @ref wait.
+     */
+    Token submit(ICPPKernel *kernel, const Hints &hints) override;
+    /** Wait for a kernel submitted with @ref submit, executing queued windows in the meantime.
+     *
+     * @param[in] token Token returned by @ref submit.
+     */
+    void wait(const Token &token) override;
+    /** Wait for all the kernels submitted with @ref submit, executing queued windows in the meantime.
+     *
+     * @note Exceptions thrown by the kernels are only reported by @ref wait.
+     */
+    void barrier() override;
+    /** Sets the number of chunks per thread the window is split in when the dynamic strategy is used
+     *
+     * @param[in] num_workloads Number of chunks per thread. Must be greater than 0.
      */
-    void schedule(ICPPKernel *kernel, unsigned int split_dimension) override;
+    void set_dynamic_workloads_per_thread(unsigned int num_workloads);
+    /** Returns the number of chunks per thread the window is split in when the dynamic strategy is used
+     *
+     * @return Number of chunks per thread.
+     */
+    unsigned int dynamic_workloads_per_thread() const;
+    /** Sets the number of polling iterations the threads busy-wait for before parking.
+     *
+     * Workers poll for new kernels and the calling thread polls for their completion on atomic counters.
+     * Once the budget is exhausted they park on a condition variable, which costs a futex round trip to wake up.
+     * A non-zero budget reduces the dispatch latency of small kernels at the cost of burning CPU cycles between kernels.
+     *
+     * @note Busy-waiting only pays off when every thread of the pool has a core of its own.
+     *
+     * @param[in] spin_budget Number of polling iterations. If set to 0 (default), the threads park straight away.
+     */
+    void set_spin_budget(unsigned int spin_budget);
+    /** Returns the number of polling iterations the threads busy-wait for before parking.
+     *
+     * @return Number of polling iterations.
+     */
+    unsigned int spin_budget() const;
 
 private:
-    /** Constructor: create a pool of threads. */
-    CPPScheduler();
-
-    unsigned int      _num_threads;
-    std::list<Thread> _threads;
+    unsigned int                      _num_threads;
+    unsigned int                      _dynamic_workloads_per_thread;
+    unsigned int                      _spin_budget;
+    std::list<Thread>                 _threads;
+    std::vector<WorkStealingRange>    _ranges;
+    std::unique_ptr<AsyncKernelQueue> _async_queue;
+    bool                              _async_pending;
 };
 }
 #endif /* __ARM_COMPUTE_CPPSCHEDULER_H__ */
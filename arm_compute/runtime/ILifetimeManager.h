@@ -34,6 +34,7 @@ namespace arm_compute
 {
 class IMemoryGroup;
 class IAllocator;
+class MemoryArena;
 
 /** Interface for managing the lifetime of objects */
 class ILifetimeManager
@@ -70,6 +71,13 @@ public:
      * @return A memory pool
      */
     virtual std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) = 0;
+    /** Creates a memory pool that leases its backing memory from an arena
+     *
+     * @param arena Memory arena to lease from
+     *
+     * @return A memory pool
+     */
+    virtual std::unique_ptr<IMemoryPool> create_pool(MemoryArena *arena) = 0;
     /** Returns the type of mappings that the lifetime manager returns
      *
      * @return Mapping type of the lifetime manager
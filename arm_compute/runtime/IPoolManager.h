@@ -58,6 +58,19 @@ public:
      * @return Number of managed pools
      */
     virtual size_t num_pools() const = 0;
+    /** Freezes the pool manager
+     *
+     * Once frozen, the memory groups bind to a pool the first time they are acquired and stay bound:
+     * later acquisitions and releases neither lock nor update the memory mappings.
+     *
+     * @note Only supported with a single pool, as all the groups get bound to it
+     */
+    virtual void freeze() = 0;
+    /** Checks if the pool manager has been frozen
+     *
+     * @return True if the pool manager has been frozen else false
+     */
+    virtual bool is_frozen() const = 0;
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_IPOOLMANAGER_H__ */
@@ -26,14 +26,141 @@
 
 #include "arm_compute/core/CPP/CPPTypes.h"
 
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+
 namespace arm_compute
 {
 class ICPPKernel;
+class NEGEMMProfiler;
+class NEGEMMTuner;
+class NEPackedWeightsCache;
 
 /** Scheduler interface to run kernels */
 class IScheduler
 {
 public:
+    /** Strategies available to split a workload */
+    enum class StrategyHint
+    {
+        STATIC,  /**< Split the workload evenly among the threads */
+        DYNAMIC, /**< Split the workload in fine-grained chunks and let idle threads steal the remaining ones */
+    };
+
+    /** Scheduler hints
+     *
+     * Collection of preferences set by the function regarding how to split a given workload
+     */
+    class Hints
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] split_dimension Dimension along which to split the kernel's execution window.
+         * @param[in] strategy        (Optional) Split strategy.
+         */
+        Hints(unsigned int split_dimension, StrategyHint strategy = StrategyHint::STATIC)
+            : _split_dimension(split_dimension), _strategy(strategy)
+        {
+        }
+        /** Set the split_dimension hint
+         *
+         * @param[in] split_dimension Dimension along which to split the kernel's execution window.
+         *
+         * @return the Hints object
+         */
+        Hints &set_split_dimension(unsigned int split_dimension)
+        {
+            _split_dimension = split_dimension;
+            return *this;
+        }
+        /** Return the prefered split dimension
+         *
+         * @return The split dimension
+         */
+        unsigned int split_dimension() const
+        {
+            return _split_dimension;
+        }
+        /** Set the strategy hint
+         *
+         * @param[in] strategy Prefered strategy to use to split the workload
+         *
+         * @return the Hints object
+         */
+        Hints &set_strategy(StrategyHint strategy)
+        {
+            _strategy = strategy;
+            return *this;
+        }
+        /** Return the prefered strategy to use to split workload.
+         *
+         * @return The strategy
+         */
+        StrategyHint strategy() const
+        {
+            return _strategy;
+        }
+
+    private:
+        unsigned int _split_dimension;
+        StrategyHint _strategy;
+    };
+
+    /** State shared between a scheduler and the token of an asynchronously submitted kernel
+     *
+     * States are owned by the scheduler and reused by later kernels once their kernel has completed.
+     */
+    struct AsyncState
+    {
+        std::atomic<unsigned int> pending{ 0 };         /**< Number of parts of the kernel's window still to be executed */
+        std::exception_ptr        exception{ nullptr }; /**< First exception thrown by the kernel, if any */
+        uint64_t                  ticket{ 0 };          /**< Number of the kernel currently using the state, changed by the submitting thread only */
+    };
+
+    /** Completion token of a kernel submitted with @ref IScheduler::submit
+     *
+     * A default constructed token refers to a kernel which has already completed.
+     *
+     * @note The scheduler only reuses the state of a completed kernel, so a token whose state got reused refers to a completed kernel.
+     */
+    class Token
+    {
+    public:
+        /** Default constructor: token of a completed kernel */
+        Token() = default;
+        /** Constructor
+         *
+         * @param[in] state State shared with the scheduler executing the kernel. Its ticket identifies the kernel.
+         */
+        explicit Token(AsyncState *state)
+            : _state(state), _ticket(state->ticket)
+        {
+        }
+        /** Check if the kernel has finished executing
+         *
+         * @return True if the kernel has completed.
+         */
+        bool is_complete() const
+        {
+            return state() == nullptr || _state->pending.load(std::memory_order_acquire) == 0;
+        }
+        /** Access the state shared with the scheduler
+         *
+         * @return The shared state, nullptr if the kernel completed synchronously or its state was reused by a later kernel.
+         */
+        AsyncState *state() const
+        {
+            return (_state != nullptr && _state->ticket == _ticket) ? _state : nullptr;
+        }
+
+    private:
+        AsyncState *_state{ nullptr };
+        uint64_t    _ticket{ 0 };
+    };
+
     /** Default constructor. */
     IScheduler();
 
@@ -54,10 +181,37 @@ public:
 
     /** Runs the kernel in the same thread as the caller synchronously.
      *
-     * @param[in] kernel          Kernel to execute.
-     * @param[in] split_dimension Dimension along which to split the kernel's execution window.
+     * @note An unsigned int split dimension is implicitly converted to Hints with a static split strategy.
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler.
+     */
+    virtual void schedule(ICPPKernel *kernel, const Hints &hints) = 0;
+
+    /** Submit a kernel for execution and return without waiting for its completion.
+     *
+     * Independent kernels can be submitted back to back and overlap with each other.
+     * The kernel must not depend on the output of a kernel which hasn't completed yet: use @ref wait first.
+     *
+     * @note The default implementation runs the kernel synchronously by calling @ref schedule.
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler.
+     *
+     * @return Token to pass to @ref wait to wait for the kernel's completion.
+     */
+    virtual Token submit(ICPPKernel *kernel, const Hints &hints);
+
+    /** Wait for the completion of a kernel submitted with @ref submit.
+     *
+     * If the kernel threw an exception, it gets rethrown by this function.
+     *
+     * @param[in] token Token returned by @ref submit.
      */
-    virtual void schedule(ICPPKernel *kernel, unsigned int split_dimension) = 0;
+    virtual void wait(const Token &token);
+
+    /** Wait for the completion of all the kernels submitted so far. */
+    virtual void barrier();
 
     /** Get CPU info.
      *
@@ -72,12 +226,45 @@ public:
      * @return Best possible number of execution threads to use
      */
     unsigned int num_threads_hint() const;
+    /** Set the tuner used to configure the assembly GEMMs
+     *
+     * @param[in] tuner (Optional) Tuner to use, nullptr to use the default heuristics.
+     */
+    void set_gemm_tuner(NEGEMMTuner *tuner);
+    /** Get the tuner used to configure the assembly GEMMs
+     *
+     * @return The tuner, nullptr if none is set.
+     */
+    NEGEMMTuner *gemm_tuner() const;
+    /** Set the cache of the weights packed by the assembly GEMMs
+     *
+     * @param[in] cache (Optional) Cache to use, nullptr to pack the weights on the first run of every function.
+     */
+    void set_weights_cache(NEPackedWeightsCache *cache);
+    /** Get the cache of the weights packed by the assembly GEMMs
+     *
+     * @return The cache, nullptr if none is set.
+     */
+    NEPackedWeightsCache *weights_cache() const;
+    /** Set the profiler of the assembly GEMMs
+     *
+     * @param[in] profiler (Optional) Profiler recording the phases of the GEMMs run from now on, nullptr to disable profiling.
+     */
+    void set_gemm_profiler(NEGEMMProfiler *profiler);
+    /** Get the profiler of the assembly GEMMs
+     *
+     * @return The profiler, nullptr if none is set.
+     */
+    NEGEMMProfiler *gemm_profiler() const;
 
 protected:
     CPUInfo _cpu_info;
 
 private:
-    unsigned int _num_threads_hint = {};
+    unsigned int          _num_threads_hint = {};
+    NEGEMMTuner          *_gemm_tuner       = { nullptr };
+    NEPackedWeightsCache *_weights_cache    = { nullptr };
+    NEGEMMProfiler       *_gemm_profiler    = { nullptr };
 };
 }
 #endif /* __ARM_COMPUTE_ISCHEDULER_H__ */
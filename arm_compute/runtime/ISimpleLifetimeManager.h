@@ -55,6 +55,28 @@ public:
     /** Allow instances of this class to be moved */
     ISimpleLifetimeManager &operator=(ISimpleLifetimeManager &&) = default;
 
+    /** Memory requirements of a finalized group */
+    struct GroupFootprint
+    {
+        IMemoryGroup *group; /**< Memory group */
+        size_t        size;  /**< Size in bytes of the memory the group requires */
+    };
+    /** Returns the memory requirements of the finalized groups
+     *
+     * @return The footprint of each finalized group, in order of finalization
+     */
+    const std::vector<GroupFootprint> &footprints() const;
+    /** Looks up the memory assigned to a managed object
+     *
+     * @param[in]  group   Finalized group the object has been managed by
+     * @param[in]  obj     Managed object
+     * @param[out] mapping Offset or blob index assigned to the object, depending on @ref mapping_type
+     * @param[out] size    Size in bytes of the object
+     *
+     * @return True if the object has been found in the group else false
+     */
+    bool find_mapping(IMemoryGroup *group, void *obj, size_t &mapping, size_t &size) const;
+
     // Inherited methods overridden:
     void register_group(IMemoryGroup *group) override;
     void start_lifetime(void *obj) override;
@@ -70,13 +92,15 @@ protected:
     struct Element
     {
         Element(void *id_ = nullptr, void **handle_ = nullptr, size_t size_ = 0, bool status_ = false)
-            : id(id_), handle(handle_), size(size_), status(status_)
+            : id(id_), handle(handle_), size(size_), status(status_), start(0), end(0)
         {
         }
         void *id;      /**< Element id */
         void **handle; /**< Element's memory handle */
         size_t size;   /**< Element's size */
         bool   status; /**< Lifetime status */
+        size_t start;  /**< Lifetime event at which the element was registered */
+        size_t end;    /**< Lifetime event at which the element was finalized */
     };
 
     /** Blob struct */
@@ -92,6 +116,8 @@ protected:
     std::list<Blob> _free_blobs;                                           /**< Free blobs */
     std::list<Blob> _occupied_blobs;                                       /**< Occupied blobs */
     std::map<IMemoryGroup *, std::map<void *, Element>> _finalized_groups; /**< A map that contains the finalized groups */
+    size_t _lifetime_events;                                               /**< Number of lifetime events of the active group */
+    std::vector<GroupFootprint> _footprints;                               /**< Memory requirements of the finalized groups */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_ISIMPLELIFETIMEMANAGER_H__ */
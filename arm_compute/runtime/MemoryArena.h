@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MEMORYARENA_H__
+#define __ARM_COMPUTE_MEMORYARENA_H__
+
+#include "support/Mutex.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace arm_compute
+{
+class IAllocator;
+
+/** Memory arena that can be shared by several memory managers
+ *
+ * Memory pools created on an arena do not own any backing memory: they lease
+ * slabs from the arena when they are acquired and return them when released.
+ * A slab that is too small for a lease is grown in place of allocating a new one,
+ * therefore the number of slabs is bound by the maximum number of concurrent leases
+ * and the resident memory of models that run one at a time approaches the
+ * peak of the largest one instead of the sum of all of them.
+ *
+ * @note The content of a slab is not preserved across leases
+ */
+class MemoryArena
+{
+public:
+    /** Default Constructor
+     *
+     * @note allocator should outlive the memory arena
+     *
+     * @param[in] allocator Backing memory allocator
+     */
+    MemoryArena(IAllocator *allocator);
+    /** Default Destructor */
+    ~MemoryArena();
+    /** Prevent instances of this class to be copy constructed */
+    MemoryArena(const MemoryArena &) = delete;
+    /** Prevent instances of this class to be copy assigned */
+    MemoryArena &operator=(const MemoryArena &) = delete;
+    /** Leases a slab of at least the given size
+     *
+     * @param[in] size Size of the slab in bytes
+     *
+     * @return Pointer to the start of the slab
+     */
+    void *lease(size_t size);
+    /** Returns a leased slab to the arena
+     *
+     * @param[in] slab Slab returned by @ref lease
+     */
+    void release(void *slab);
+    /** Frees all the slabs that are not leased */
+    void trim();
+    /** Gets the total size of the slabs held by the arena
+     *
+     * @return Resident size in bytes
+     */
+    size_t resident_size() const;
+    /** Gets the number of slabs held by the arena
+     *
+     * @return Number of slabs
+     */
+    size_t num_slabs() const;
+    /** Gets the number of slabs currently leased
+     *
+     * @return Number of leases
+     */
+    size_t num_leases() const;
+
+private:
+    /** Slab of backing memory */
+    struct Slab
+    {
+        void  *ptr;    /**< Start of the slab */
+        size_t size;   /**< Size of the slab in bytes */
+        bool   leased; /**< True if the slab is currently leased */
+    };
+
+    IAllocator                *_allocator; /**< Allocator to use for slab allocations */
+    std::vector<Slab>          _slabs;     /**< Slabs held by the arena */
+    mutable arm_compute::Mutex _mtx;       /**< Mutex guarding the slabs */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_MEMORYARENA_H__ */
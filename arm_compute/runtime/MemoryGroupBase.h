@@ -127,7 +127,8 @@ inline void MemoryGroupBase<TensorType>::finalize_memory(TensorType *obj, void *
 template <typename TensorType>
 inline void MemoryGroupBase<TensorType>::acquire()
 {
-    if(!_mappings.empty())
+    // Groups already bound to a pool of a frozen pool manager don't need to acquire it again
+    if(!_mappings.empty() && _pool == nullptr)
     {
         ARM_COMPUTE_ERROR_ON(!_memory_manager->pool_manager());
         _pool = _memory_manager->pool_manager()->lock_pool();
@@ -142,6 +143,13 @@ inline void MemoryGroupBase<TensorType>::release()
     {
         ARM_COMPUTE_ERROR_ON(!_memory_manager->pool_manager());
         ARM_COMPUTE_ERROR_ON(_mappings.empty());
+
+        // Groups of a frozen pool manager stay bound to their pool
+        if(_memory_manager->pool_manager()->is_frozen())
+        {
+            return;
+        }
+
         _pool->release(_mappings);
         _memory_manager->pool_manager()->unlock_pool(_pool);
         _pool = nullptr;
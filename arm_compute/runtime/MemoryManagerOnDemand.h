@@ -37,6 +37,7 @@
 namespace arm_compute
 {
 class IAllocator;
+class MemoryArena;
 
 /** On-demand memory manager */
 class MemoryManagerOnDemand : public IMemoryManager
@@ -62,6 +63,24 @@ public:
      * @param[in] allocator Allocator to use
      */
     void set_allocator(IAllocator *allocator);
+    /** Sets an allocator owned with others to be used for configuring the pools
+     *
+     * The memory manager keeps the allocator alive until its pools have been freed.
+     *
+     * @param[in] allocator Allocator to use
+     */
+    void set_allocator(std::shared_ptr<IAllocator> allocator);
+    /** Sets an arena to lease the pools' memory from
+     *
+     * When set, the pools do not own any backing memory: it is leased from the arena
+     * when a memory group is acquired and returned when it is released.
+     * An arena can be shared by several memory managers.
+     *
+     * @note The arena takes precedence over the allocator
+     *
+     * @param[in] arena Arena to use
+     */
+    void set_arena(MemoryArena *arena);
     /** Checks if the memory manager has been finalized
      *
      * @return True if the memory manager has been finalized else false
@@ -74,11 +93,13 @@ public:
     void              finalize() override;
 
 private:
-    std::shared_ptr<ILifetimeManager> _lifetime_mgr; /**< Lifetime manager */
-    std::shared_ptr<IPoolManager>     _pool_mgr;     /**< Memory pool manager */
-    IAllocator                       *_allocator;    /**< Allocator used for backend allocations */
-    bool                              _is_finalized; /**< Flag that notes if the memory manager has been finalized */
-    unsigned int                      _num_pools;    /**< Number of pools to create */
+    std::shared_ptr<IAllocator>       _allocator_owner; /**< Owner of the allocator if shared, destroyed after the pools */
+    std::shared_ptr<ILifetimeManager> _lifetime_mgr;    /**< Lifetime manager */
+    std::shared_ptr<IPoolManager>     _pool_mgr;        /**< Memory pool manager */
+    IAllocator                       *_allocator;       /**< Allocator used for backend allocations */
+    MemoryArena                      *_arena;           /**< Arena the pools lease their memory from */
+    bool                              _is_finalized;    /**< Flag that notes if the memory manager has been finalized */
+    unsigned int                      _num_pools;       /**< Number of pools to create */
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_MEMORYMANAGERONDEMAND_H__ */
@@ -29,6 +29,8 @@
 #include "arm_compute/core/Error.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 
 namespace arm_compute
 {
@@ -38,20 +40,37 @@ class MemoryRegion final : public IMemoryRegion
 public:
     /** Default constructor
      *
-     * @param[in] size Region size
+     * @param[in] size      Region size
+     * @param[in] alignment (Optional) Alignment of the region. Must be a power of 2, 0 to use the default alignment of new.
      */
-    MemoryRegion(size_t size)
+    MemoryRegion(size_t size, size_t alignment = 0)
         : IMemoryRegion(size), _mem(nullptr), _ptr(nullptr)
     {
         if(size != 0)
         {
-            _mem = std::shared_ptr<uint8_t>(new uint8_t[size](), [](uint8_t *ptr)
+            // Allocate extra space to align the start of the region
+            const size_t                   padding = (alignment > 1) ? alignment - 1 : 0;
+            const std::shared_ptr<uint8_t> owner(new uint8_t[size + padding](), [](uint8_t *ptr)
             {
                 delete[] ptr;
             });
-            _ptr = _mem.get();
+
+            const uintptr_t start = reinterpret_cast<uintptr_t>(owner.get());
+            _ptr                  = owner.get() + ((padding != 0) ? ((alignment - (start & padding)) & padding) : 0);
+
+            // Share the ownership of the allocation with a pointer to its aligned start
+            _mem = std::shared_ptr<uint8_t>(owner, _ptr);
         }
     }
+    /** Constructor importing an existing allocation
+     *
+     * @param[in] memory Allocation to import, its ownership is shared with the region
+     * @param[in] size   Size of the allocation
+     */
+    MemoryRegion(std::shared_ptr<uint8_t> memory, size_t size)
+        : IMemoryRegion(size), _mem(std::move(memory)), _ptr(_mem.get())
+    {
+    }
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     MemoryRegion(const MemoryRegion &) = delete;
     /** Default move constructor */
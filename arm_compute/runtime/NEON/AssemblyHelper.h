@@ -34,12 +34,62 @@
 #include "arm_compute/core/NEON/kernels/assembly/arm_gemm.hpp"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/NEGEMMProfiler.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+#include "arm_compute/runtime/NEON/NEPackedWeightsCache.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace arm_compute
 {
+/** Check whether an activation can be fused in the output stage of the assembly GEMMs
+ *
+ * @param[in] act_info Activation to fuse.
+ *
+ * @return True if the activation is disabled or can be applied by the assembly GEMMs.
+ */
+inline bool is_activation_supported_by_assembly(const ActivationLayerInfo &act_info)
+{
+    return !act_info.enabled() || act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU || act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU
+           || act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU;
+}
+
+/** Convert an activation to the one of the assembly GEMMs
+ *
+ * @param[in] act_info Activation supported by the assembly GEMMs (see @ref is_activation_supported_by_assembly).
+ *
+ * @return The activation of the assembly GEMMs' output stage.
+ */
+inline arm_gemm::Activation to_assembly_activation(const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON(!is_activation_supported_by_assembly(act_info));
+
+    if(!act_info.enabled())
+    {
+        return arm_gemm::Activation();
+    }
+
+    switch(act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            return arm_gemm::Activation(arm_gemm::Activation::Type::ReLU);
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+            return arm_gemm::Activation(arm_gemm::Activation::Type::BoundedReLU, act_info.a(), 0.f);
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            return arm_gemm::Activation(arm_gemm::Activation::Type::BoundedReLU, act_info.a(), act_info.b());
+        default:
+            ARM_COMPUTE_ERROR("Activation not supported by the assembly GEMMs");
+    }
+}
+
 /** Assembly kernel glue */
 template <typename TypeInput, typename TypeOutput>
 class AssemblyKernelGlue final
@@ -51,7 +101,9 @@ public:
     using TypeResult = TypeOutput;
     /** Default constructor. */
     AssemblyKernelGlue()
-        : _gemm_kernel_asm(nullptr), _optimised_kernel(nullptr), _a(nullptr), _b(nullptr), _d(nullptr), _pretranspose(nullptr)
+        : _gemm_kernel_asm(nullptr), _optimised_kernel(nullptr), _a(nullptr), _b(nullptr), _d(nullptr), _pretranspose(nullptr), _weights_cache(nullptr), _weights_cache_prefix(),
+          _weights_cache_key(), _shared_pretranspose(nullptr), _bias(nullptr), _activation(), _is_requantized(false), _requantize(), _row_sums(nullptr), _col_sums(nullptr),
+          _is_convolution(false), _convolution(), _shape()
     {
     }
     /** Assembly Gemm */
@@ -72,48 +124,198 @@ public:
     const ITensor *_b;
     /** Output */
     ITensor *_d;
-    /** Pre-transpose tensor */
-    ITensor *_pretranspose;
+    /** Pre-transpose tensor, unused when B is shared through the weights cache */
+    Tensor *_pretranspose;
+    /** Cache of the packed weights */
+    NEPackedWeightsCache *_weights_cache;
+    /** Key of the pretransposed B in the weights cache, without the hash of the weights */
+    std::string _weights_cache_prefix;
+    /** Key of the pretransposed B in the weights cache */
+    std::string _weights_cache_key;
+    /** Pretransposed B shared through the weights cache */
+    std::shared_ptr<const void> _shared_pretranspose;
+    /** Bias added by the output stage */
+    const ITensor *_bias;
+    /** Activation applied by the output stage */
+    arm_gemm::Activation _activation;
+    /** True if the results are requantized to the QASYMM8 output rather than written to it */
+    bool _is_requantized;
+    /** Requantizing output stage, its pointers are set in the run() method */
+    arm_gemm::Requantize32 _requantize;
+    /** Sums of the rows of A for the requantizing output stage, if its B offset isn't 0 */
+    const ITensor *_row_sums;
+    /** Sums of the columns of B for the requantizing output stage, if its A offset isn't 0 */
+    const ITensor *_col_sums;
+    /** True if the rows of A are gathered from the input feature map @p _a of a convolution */
+    bool _is_convolution;
+    /** Convolution gathering the rows of A, its strides are set in the run() method */
+    arm_gemm::ConvolutionParameters _convolution;
+    /** Shape of the GEMM reported to the profiler */
+    NEGEMMProfiler::GEMMShape _shape;
+
+    /** Use the pretransposed B of the weights cache, if any
+     *
+     * @note Functions which reshape their weights into B can call this before reshaping, with the original weights, to skip the reshape as well.
+     *
+     * @param[in] weights Weights identifying B: B itself or the weights B is reshaped from.
+     * @param[in] biases  (Optional) Biases B is reshaped from along with the weights.
+     *
+     * @return True if B was found in the cache and doesn't need to be pretransposed anymore.
+     */
+    inline bool import_pretransposed_B(const ITensor *weights, const ITensor *biases = nullptr)
+    {
+        if(_weights_cache == nullptr || !_gemm_kernel_asm->B_pretranspose_required())
+        {
+            return false;
+        }
+
+        // Key the buffer with the first weights it was looked up with
+        if(_weights_cache_key.empty())
+        {
+            std::stringstream ss;
+            ss << _weights_cache_prefix << "_" << std::hex << NEPackedWeightsCache::hash(*weights);
+            if(biases != nullptr)
+            {
+                ss << "_" << NEPackedWeightsCache::hash(*biases);
+            }
+            _weights_cache_key = ss.str();
+        }
+
+        std::shared_ptr<const void> data = _weights_cache->find(_weights_cache_key, _gemm_kernel_asm->get_B_pretransposed_array_size());
+        if(data == nullptr)
+        {
+            return false;
+        }
+
+        use_shared_pretranspose(std::move(data));
+        return true;
+    }
+
+    /** Point the GEMM to a pretransposed B shared with other functions
+     *
+     * @param[in] data Pretransposed B
+     */
+    inline void use_shared_pretranspose(std::shared_ptr<const void> data)
+    {
+        // The shared buffer is read-only: the GEMM only reads the pretransposed B
+        _gemm_kernel_asm->set_pretransposed_B_data(const_cast<void *>(data.get()));
+        _shared_pretranspose = std::move(data);
+        _b->mark_as_unused();
+    }
 
     /** Configures the arrays pointers and strides in the assembly kernel and executes the assembly kernel.
      *  The call to set_arrays is needed to deal with the input sizes containing batches (dims > 2)
      */
     inline void run()
     {
-        const int lda = _a->info()->strides_in_bytes().y() / sizeof(TypeInput);
+        // The requantized output is written by the output stage rather than used as C
+        const size_t output_size = _is_requantized ? sizeof(uint8_t) : sizeof(TypeOutput);
+
+        int       lda = _a->info()->strides_in_bytes().y() / sizeof(TypeInput);
         const int ldb = _b->info()->strides_in_bytes().y() / sizeof(TypeInput);
-        const int ldd = _d->info()->strides_in_bytes().y() / sizeof(TypeOutput);
+        const int ldd = _d->info()->strides_in_bytes().y() / output_size;
 
         // In the case of NHWC we want to interpret the output shape as 3D. Thus, the batch stride for A is
         // the relevant multiple of the row stride.
         const bool is_nhwc           = _a->info()->data_layout() == DataLayout::NHWC;
         const int  stride_in_bytes_a = is_nhwc ? _a->info()->strides_in_bytes().y() * _d->info()->dimension(1) : _a->info()->strides_in_bytes().z();
 
-        const int batch_stride_a = stride_in_bytes_a / sizeof(TypeInput);
-        const int batch_stride_d = _d->info()->strides_in_bytes().z() / sizeof(TypeOutput);
+        int batch_stride_a = stride_in_bytes_a / sizeof(TypeInput);
+        int batch_stride_d = _d->info()->strides_in_bytes().z() / output_size;
 
         const int multi_stride_a = _a->info()->strides_in_bytes()[3] / sizeof(TypeInput);
         const int multi_stride_b = _b->info()->strides_in_bytes().z() / sizeof(TypeInput);
-        const int multi_stride_d = _d->info()->strides_in_bytes()[3] / sizeof(TypeOutput);
+        const int multi_stride_d = _d->info()->strides_in_bytes()[3] / output_size;
+
+        // Record the phases of this run if a profiler is set, which also covers the pretranspose of B
+        NEGEMMProfiler        *profiler    = NEScheduler::get().gemm_profiler();
+        arm_gemm::ProfileSink *profile_run = (profiler != nullptr) ? profiler->start_run(_shape) : nullptr;
+        _gemm_kernel_asm->set_profiler(profile_run);
 
-        const auto in0_ptr = reinterpret_cast<const TypeInput *>(_a->buffer());
+        auto       in0_ptr = reinterpret_cast<const TypeInput *>(_a->buffer());
         const auto in1_ptr = reinterpret_cast<const TypeInput *>(_b->buffer());
         auto       out_ptr = reinterpret_cast<TypeOutput *>(_d->buffer());
 
-        _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr, ldd, batch_stride_d, multi_stride_d);
-        if(_gemm_kernel_asm->B_pretranspose_required())
+        if(_is_convolution)
+        {
+            // A is the input feature map: the GEMM reads it through its strides, one batch per input
+            const DataLayout data_layout = _a->info()->data_layout();
+            const Strides   &strides_a   = _a->info()->strides_in_bytes();
+            _convolution.input_stride_x  = strides_a[get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH)] / sizeof(TypeInput);
+            _convolution.input_stride_y  = strides_a[get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT)] / sizeof(TypeInput);
+            _convolution.input_stride_c  = strides_a[get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL)] / sizeof(TypeInput);
+            _gemm_kernel_asm->set_convolution_parameters(_convolution);
+
+            lda            = 0;
+            batch_stride_a = strides_a[3] / sizeof(TypeInput);
+            in0_ptr        = reinterpret_cast<const TypeInput *>(_a->buffer() + _a->info()->offset_first_element_in_bytes());
+
+            // D is either a [N, M, batches] matrix or the NHWC output, whose width and height both index M
+            if(_d->info()->data_layout() == DataLayout::NHWC)
+            {
+                ARM_COMPUTE_ERROR_ON_MSG(_d->info()->strides_in_bytes().z() != _d->info()->strides_in_bytes().y() * _d->info()->dimension(1), "The output can't be padded along its width");
+                batch_stride_d = _d->info()->strides_in_bytes()[3] / output_size;
+            }
+            out_ptr = reinterpret_cast<TypeOutput *>(_d->buffer() + _d->info()->offset_first_element_in_bytes());
+        }
+
+        if(_is_requantized)
+        {
+            _requantize.output                = _d->buffer();
+            _requantize.ldo                   = ldd;
+            _requantize.output_batch_stride   = batch_stride_d;
+            _requantize.bias                  = (_bias != nullptr) ? reinterpret_cast<const int32_t *>(_bias->buffer() + _bias->info()->offset_first_element_in_bytes()) : nullptr;
+            _requantize.row_sums              = (_row_sums != nullptr) ? reinterpret_cast<const int32_t *>(_row_sums->buffer() + _row_sums->info()->offset_first_element_in_bytes()) : nullptr;
+            _requantize.row_sums_batch_stride = (_row_sums != nullptr) ? _row_sums->info()->strides_in_bytes().y() / sizeof(int32_t) : 0;
+            _requantize.col_sums              = (_col_sums != nullptr) ? reinterpret_cast<const int32_t *>(_col_sums->buffer() + _col_sums->info()->offset_first_element_in_bytes()) : nullptr;
+            _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, nullptr, 0, 0, 0);
+            _gemm_kernel_asm->set_requantize_stage(_requantize);
+        }
+        else
+        {
+            _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr, ldd, batch_stride_d, multi_stride_d);
+        }
+        if(!_is_requantized && (_bias != nullptr || _activation.type != arm_gemm::Activation::Type::None))
+        {
+            const auto bias_ptr = (_bias != nullptr) ? reinterpret_cast<const TypeOutput *>(_bias->buffer() + _bias->info()->offset_first_element_in_bytes()) : nullptr;
+            // Biases longer than a row of D hold one row of biases per multi
+            const int bias_multi_stride = (_bias != nullptr && _bias->info()->dimension(0) > _d->info()->dimension(0)) ? _d->info()->dimension(0) : 0;
+            _gemm_kernel_asm->set_output_stage(bias_ptr, bias_multi_stride, _activation);
+        }
+        if(_gemm_kernel_asm->B_pretranspose_required() && !import_pretransposed_B(_b))
         {
             // Forcing 128-byte alignment (required by 32-bit kernels)
-            const unsigned int alignment   = 128;
-            void              *raw_ptr     = reinterpret_cast<void *>(_pretranspose->buffer());
-            size_t             space       = _pretranspose->info()->total_size();
-            void              *aligned_ptr = support::cpp11::align(alignment, _gemm_kernel_asm->get_B_pretransposed_array_size(), raw_ptr, space);
-            ARM_COMPUTE_ERROR_ON(_pretranspose == nullptr || _pretranspose->buffer() == nullptr);
-            _gemm_kernel_asm->pretranspose_B_array(aligned_ptr, in1_ptr, ldb, multi_stride_b);
-            _b->mark_as_unused();
+            const unsigned int alignment = 128;
+            const size_t       B_size    = _gemm_kernel_asm->get_B_pretransposed_array_size();
+            if(_weights_cache != nullptr)
+            {
+                // Pack B into a buffer owned by the functions sharing it rather than by this function's tensor
+                std::shared_ptr<uint8_t> buffer(new uint8_t[B_size + alignment - 1], std::default_delete<uint8_t[]>());
+                void                    *raw_ptr     = buffer.get();
+                size_t                   space       = B_size + alignment - 1;
+                void                    *aligned_ptr = support::cpp11::align(alignment, B_size, raw_ptr, space);
+                _gemm_kernel_asm->pretranspose_B_array(aligned_ptr, in1_ptr, ldb, multi_stride_b);
+
+                // Another function might have packed the same weights meanwhile: use whichever buffer the cache kept
+                use_shared_pretranspose(_weights_cache->add(_weights_cache_key, std::shared_ptr<const void>(buffer, aligned_ptr), B_size));
+            }
+            else
+            {
+                void  *raw_ptr     = reinterpret_cast<void *>(_pretranspose->buffer());
+                size_t space       = _pretranspose->info()->total_size();
+                void  *aligned_ptr = support::cpp11::align(alignment, B_size, raw_ptr, space);
+                ARM_COMPUTE_ERROR_ON(_pretranspose == nullptr || _pretranspose->buffer() == nullptr);
+                _gemm_kernel_asm->pretranspose_B_array(aligned_ptr, in1_ptr, ldb, multi_stride_b);
+                _b->mark_as_unused();
+            }
         }
 
         NEScheduler::get().schedule(_optimised_kernel.get(), Window::DimX);
+
+        if(profile_run != nullptr)
+        {
+            profiler->stop_run(profile_run);
+        }
     }
 };
 
@@ -140,6 +342,83 @@ inline void allocate_workspace(size_t workspace_size, Tensor &workspace, MemoryG
     workspace.allocator()->allocate();
 }
 
+/** Create the runner of a GEMM configuration for the tuner.
+ *
+ * The GEMM runs on buffers owned by the runner: B is filled with ones so that it isn't found sparse, A and D are zero-initialised.
+ *
+ * @param[in] ci                CPU information.
+ * @param[in] M                 Number of rows of the output matrix.
+ * @param[in] N                 Number of columns of the output matrix.
+ * @param[in] K                 Number of columns of the first input matrix.
+ * @param[in] batches           Number of batches.
+ * @param[in] multis            Number of multis.
+ * @param[in] alpha             Alpha value.
+ * @param[in] beta              Beta value.
+ * @param[in] num_threads       Number of threads running the GEMM.
+ * @param[in] pretranspose_hint Pre-transpose hint in case matrix b should be pre-transposed
+ * @param[in] config            Candidate configuration of the GEMM.
+ *
+ * @return the runner, empty if the GEMM can't be created with this configuration.
+ */
+template <typename T>
+inline NEGEMMTuner::CandidateRunner create_gemm_tuning_runner(const CPUInfo &ci, int M, int N, int K, int batches, int multis, float alpha, float beta,
+                                                              unsigned int num_threads, bool pretranspose_hint, const arm_gemm::GemmConfig &config)
+{
+    struct TuningGemm
+    {
+        std::unique_ptr<typename T::AssemblyGemm>       kernel_asm{ nullptr };
+        NEGEMMAssemblyWrapper<typename T::AssemblyGemm> kernel{};
+        std::vector<typename T::TypeOperator>           a{};
+        std::vector<typename T::TypeOperator>           b{};
+        std::vector<typename T::TypeResult>             d{};
+        std::vector<uint8_t>                            workspace{};
+        std::vector<uint8_t>                            pretranspose{};
+    };
+
+    auto gemm        = std::make_shared<TuningGemm>();
+    gemm->kernel_asm = arm_gemm::gemm<typename T::TypeOperator, typename T::TypeResult>(ci, M, N, K, batches, multis, false, false, alpha, beta, num_threads, pretranspose_hint, &config);
+    if(gemm->kernel_asm == nullptr)
+    {
+        return nullptr;
+    }
+
+    gemm->a.resize(static_cast<size_t>(M) * K * batches * multis);
+    gemm->b.resize(static_cast<size_t>(K) * N * multis, static_cast<typename T::TypeOperator>(1));
+    gemm->d.resize(static_cast<size_t>(M) * N * batches * multis);
+    gemm->kernel_asm->set_arrays(gemm->a.data(), K, M * K, M * K * batches, gemm->b.data(), N, N * K, gemm->d.data(), N, M * N, M * N * batches);
+
+    const size_t workspace_size = gemm->kernel_asm->get_working_size();
+    if(workspace_size)
+    {
+        gemm->workspace.resize(workspace_size);
+        gemm->kernel_asm->set_working_space(gemm->workspace.data());
+    }
+
+    const unsigned int window_size = gemm->kernel_asm->get_window_size();
+    if(window_size < num_threads)
+    {
+        gemm->kernel_asm->set_nthreads(window_size);
+    }
+
+    if(gemm->kernel_asm->B_pretranspose_required())
+    {
+        // Forcing 128-byte alignment (required by 32-bit kernels)
+        const unsigned int alignment           = 128;
+        const size_t       B_pretranspose_size = gemm->kernel_asm->get_B_pretransposed_array_size();
+        gemm->pretranspose.resize(B_pretranspose_size + alignment);
+        void  *raw_ptr = gemm->pretranspose.data();
+        size_t space   = gemm->pretranspose.size();
+        gemm->kernel_asm->pretranspose_B_array(support::cpp11::align(alignment, B_pretranspose_size, raw_ptr, space), gemm->b.data(), N, N * K);
+    }
+
+    gemm->kernel.configure(gemm->kernel_asm.get());
+
+    return [gemm]()
+    {
+        NEScheduler::get().schedule(&gemm->kernel, Window::DimX);
+    };
+}
+
 /** Create a wrapper kernel.
  *
  * @param[in]  a                 Input tensor A.
@@ -149,32 +428,74 @@ inline void allocate_workspace(size_t workspace_size, Tensor &workspace, MemoryG
  * @param[in]  beta              Beta value.
  * @param[in]  pretranspose_hint Pre-transpose hint in case matrix b should be pre-transposed
  * @param[out] workspace         Workspace tensor
- * @param[out] B_pretranspose    Tensor to hold the pre-transposed B
+ * @param[out] B_pretranspose    Tensor to hold the pre-transposed B when no weights cache is set
  * @param[in]  memory_group      Tensor memory group.
  * @param[out] asm_glue          Assembly glue kernel.
+ * @param[in]  bias              (Optional) Bias added to each column of the output by the GEMM's output stage, either shared by all the multis or one row per multi. Data type supported: Same as @p d.
+ * @param[in]  act_info          (Optional) Activation applied by the GEMM's output stage (see @ref is_activation_supported_by_assembly).
+ * @param[in]  requantize        (Optional) Requantizing output stage writing @p d as QASYMM8, its pointers are set by @p asm_glue on each run.
+ *                               The bias is then added by this stage, the sums it needs must be set in @p asm_glue.
+ * @param[in]  convolution       (Optional) Convolution whose im2col matrix is gathered on the fly from @p a, the input feature map, its strides are set by @p asm_glue on each run.
+ *                               @p d is then either a [N, M, batches] matrix or an NHWC output.
  *
  * @return the wrapper kernel.
  */
 template <typename T>
 inline bool setup_assembly_kernel(const ITensor *a, const ITensor *b, ITensor *d, float alpha, float beta, bool pretranspose_hint,
-                                  Tensor &workspace, Tensor &B_pretranspose, MemoryGroup &memory_group, T &asm_glue)
+                                  Tensor &workspace, Tensor &B_pretranspose, MemoryGroup &memory_group, T &asm_glue,
+                                  const ITensor *bias = nullptr, const ActivationLayerInfo &act_info = ActivationLayerInfo(), const arm_gemm::Requantize32 *requantize = nullptr,
+                                  const arm_gemm::ConvolutionParameters *convolution = nullptr)
 {
     const CPUInfo &ci          = NEScheduler::get().cpu_info();
-    const int      M           = d->info()->tensor_shape().y();
     const int      N           = d->info()->tensor_shape().x();
-    const int      K           = a->info()->tensor_shape().x();
-    const int      batches     = d->info()->tensor_shape().total_size_upper(2);
+    const int      K           = (convolution != nullptr) ? b->info()->tensor_shape().y() : a->info()->tensor_shape().x();
     const int      multis      = b->info()->tensor_shape().z();
+    const int      batches     = (convolution != nullptr) ? a->info()->tensor_shape().total_size_upper(3) : d->info()->tensor_shape().total_size_upper(2) / multis;
+    const int      M           = (convolution != nullptr) ? d->info()->tensor_shape().total_size() / (N * batches) : d->info()->tensor_shape().y();
     unsigned int   num_threads = NEScheduler::get().num_threads();
 
+    NEGEMMTuner          *tuner         = NEScheduler::get().gemm_tuner();
+    NEPackedWeightsCache *weights_cache = NEScheduler::get().weights_cache();
+    std::string           gemm_id;
+    if(tuner != nullptr || weights_cache != nullptr)
+    {
+        gemm_id = NEGEMMTuner::gemm_id(string_from_data_type(a->info()->data_type()), M, N, K, batches, multis, num_threads, pretranspose_hint, ci.get_cpu_model());
+    }
+
+    // Use the configuration measured by the tuner, if any
+    arm_gemm::GemmConfig gemm_config;
+    if(tuner != nullptr)
+    {
+        gemm_config = tuner->find_config(gemm_id, N, K, [&](const arm_gemm::GemmConfig & config)
+        {
+            return create_gemm_tuning_runner<T>(ci, M, N, K, batches, multis, alpha, beta, num_threads, pretranspose_hint, config);
+        });
+    }
+
+    // Only the blocked GEMM can gather the rows of A
+    if(convolution != nullptr)
+    {
+        gemm_config.method = arm_gemm::GemmMethod::GEMM_INTERLEAVED;
+    }
+
     // unique_ptr to a Gemm object
     std::unique_ptr<typename T::AssemblyGemm>
-    asm_gemm(arm_gemm::gemm<typename T::TypeOperator, typename T::TypeResult>(ci, M, N, K, batches, multis, false, false, alpha, beta, num_threads, pretranspose_hint));
+    asm_gemm(arm_gemm::gemm<typename T::TypeOperator, typename T::TypeResult>(ci, M, N, K, batches, multis, false, false, alpha, beta, num_threads, pretranspose_hint, &gemm_config));
     // arm_compute wrapper for the Gemm object (see above)
     std::unique_ptr<NEGEMMAssemblyWrapper<typename T::AssemblyGemm>>
                                                                   acl_gemm_wrapper = support::cpp14::make_unique<NEGEMMAssemblyWrapper<typename T::AssemblyGemm>>();
     if(acl_gemm_wrapper != nullptr && asm_gemm != nullptr)
     {
+        // The requantizing output stage and the convolution change the working space of the GEMM, so they are set first
+        if(requantize != nullptr && !asm_gemm->set_requantize_stage(*requantize))
+        {
+            return false;
+        }
+        if(convolution != nullptr && !asm_gemm->set_convolution_parameters(*convolution))
+        {
+            return false;
+        }
+
         acl_gemm_wrapper->configure(asm_gemm.get());
         const size_t workspace_size = asm_gemm->get_working_size();
         if(workspace_size)
@@ -203,9 +524,23 @@ inline bool setup_assembly_kernel(const ITensor *a, const ITensor *b, ITensor *d
             // Forcing 128-byte alignment (required by 32-bit kernels)
             const unsigned int alignment           = 128;
             const size_t       B_pretranspose_size = asm_gemm->get_B_pretransposed_array_size();
-            allocate_workspace(B_pretranspose_size, B_pretranspose, nullptr, alignment, 1);
-            ARM_COMPUTE_ERROR_ON_NULLPTR(B_pretranspose.buffer());
-            asm_glue._pretranspose = &B_pretranspose;
+            if(weights_cache != nullptr)
+            {
+                // The pretransposed B is found in the cache or packed into a buffer shared through it on the first run
+                // The layout of the pretransposed B depends on the GEMM, its configuration and the caches it was blocked for
+                std::stringstream ss;
+                ss << gemm_id << "_" << static_cast<int>(gemm_config.method) << "_" << gemm_config.inner_block_size << "_" << gemm_config.outer_block_size
+                   << "_L1_" << ci.get_L1_cache_size() << "_L2_" << ci.get_L2_cache_size() << (requantize != nullptr ? "_requantized" : "") << (convolution != nullptr ? "_convolution" : "")
+                   << "_" << B_pretranspose_size;
+                asm_glue._weights_cache        = weights_cache;
+                asm_glue._weights_cache_prefix = ss.str();
+            }
+            else
+            {
+                allocate_workspace(B_pretranspose_size, B_pretranspose, nullptr, alignment, 1);
+                ARM_COMPUTE_ERROR_ON_NULLPTR(B_pretranspose.buffer());
+                asm_glue._pretranspose = &B_pretranspose;
+            }
         }
 
         asm_glue._gemm_kernel_asm  = std::move(asm_gemm);
@@ -214,6 +549,25 @@ inline bool setup_assembly_kernel(const ITensor *a, const ITensor *b, ITensor *d
         asm_glue._a = a;
         asm_glue._b = b;
         asm_glue._d = d;
+        // The output stage is set along with the arrays in the run() method
+        asm_glue._bias           = bias;
+        asm_glue._activation     = to_assembly_activation(act_info);
+        asm_glue._is_requantized = requantize != nullptr;
+        if(requantize != nullptr)
+        {
+            asm_glue._requantize = *requantize;
+        }
+        asm_glue._is_convolution = convolution != nullptr;
+        if(convolution != nullptr)
+        {
+            asm_glue._convolution = *convolution;
+        }
+        // The shape is only used to report the runs to the profiler
+        asm_glue._shape.M       = M;
+        asm_glue._shape.N       = N;
+        asm_glue._shape.K       = K;
+        asm_glue._shape.batches = batches;
+        asm_glue._shape.multis  = multis;
         return true;
     }
     return false;
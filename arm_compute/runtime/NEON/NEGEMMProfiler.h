@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMPROFILER_H__
+#define __ARM_COMPUTE_NEGEMMPROFILER_H__
+
+#include "arm_compute/core/NEON/kernels/assembly/arm_gemm.hpp"
+#include "support/Mutex.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Profiler of the arm_gemm assembly GEMMs
+ *
+ * Records, for every run of an assembly GEMM, the time spent preparing A (interleaving it), preparing B (transposing it),
+ * in the kernel and merging the results into the output, along with the work done by each phase.
+ *
+ * @note The profiler is used by the NEON functions running assembly GEMMs once it has been set with @ref IScheduler::set_gemm_profiler
+ */
+class NEGEMMProfiler
+{
+public:
+    /** Number of phases of a GEMM */
+    static constexpr size_t num_phases = static_cast<size_t>(arm_gemm::ProfilePhase::NumPhases);
+
+    /** Shape of a GEMM */
+    struct GEMMShape
+    {
+        unsigned int M{ 0 };       /**< Number of rows of the output matrix */
+        unsigned int N{ 0 };       /**< Number of columns of the output matrix */
+        unsigned int K{ 0 };       /**< Number of columns of the first input matrix */
+        unsigned int batches{ 1 }; /**< Number of batches */
+        unsigned int multis{ 1 };  /**< Number of multis */
+    };
+
+    /** Measurements of a phase of a GEMM run */
+    struct PhaseMeasurement
+    {
+        uint64_t events{ 0 };  /**< Number of blocks processed */
+        uint64_t time_ns{ 0 }; /**< Time spent processing the blocks, summed over the threads */
+        uint64_t units{ 0 };   /**< Bytes moved, or multiply-accumulates for the kernel (see arm_gemm::ProfilePhase) */
+    };
+
+    /** Measurements of a GEMM run */
+    struct GEMMMeasurement
+    {
+        std::string                              layer{};   /**< Layer the GEMM ran for, empty if unknown */
+        GEMMShape                                shape{};   /**< Shape of the GEMM */
+        uint64_t                                 time_ns{}; /**< Wall clock time of the run, pretranspose of B included */
+        std::array<PhaseMeasurement, num_phases> phases{};  /**< Measurements of each phase, indexed by arm_gemm::ProfilePhase */
+
+        /** Measurements of a phase
+         *
+         * @param[in] phase Phase of the GEMM
+         *
+         * @return The measurements of the phase
+         */
+        const PhaseMeasurement &phase(arm_gemm::ProfilePhase phase) const
+        {
+            return phases[static_cast<size_t>(phase)];
+        }
+        /** Throughput achieved by the run
+         *
+         * @return Billions of floating point operations (2 per multiply-accumulate of the GEMM) per second of wall clock time.
+         */
+        double gflops() const;
+        /** Bytes moved by the run
+         *
+         * @return Bytes moved preparing A and B and merging the results.
+         */
+        uint64_t bytes() const;
+    };
+
+    /** Default constructor */
+    NEGEMMProfiler();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMProfiler(const NEGEMMProfiler &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMProfiler &operator=(const NEGEMMProfiler &) = delete;
+    /** Default destructor */
+    ~NEGEMMProfiler() = default;
+
+    /** Set the layer the next GEMMs run for
+     *
+     * @param[in] layer Name of the layer, empty if unknown.
+     */
+    void set_layer(std::string layer);
+    /** Start recording a GEMM run
+     *
+     * @param[in] shape Shape of the GEMM
+     *
+     * @return The sink the GEMM reports its phases to until @ref stop_run is called.
+     */
+    arm_gemm::ProfileSink *start_run(const GEMMShape &shape);
+    /** Stop recording a GEMM run
+     *
+     * @param[in] run Sink returned by @ref start_run
+     */
+    void stop_run(arm_gemm::ProfileSink *run);
+    /** Measurements of the GEMM runs recorded since the last call to @ref clear
+     *
+     * @return The measurements, in the order the runs were started.
+     */
+    std::vector<GEMMMeasurement> measurements() const;
+    /** Forget the recorded runs
+     *
+     * @note Must not be called while a GEMM is running.
+     */
+    void clear();
+
+private:
+    /** Recorded GEMM run */
+    class Run final : public arm_gemm::ProfileSink
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] layer Layer the GEMM runs for
+         * @param[in] shape Shape of the GEMM
+         */
+        Run(std::string layer, const GEMMShape &shape);
+        // Inherited methods overridden:
+        void record(arm_gemm::ProfilePhase phase, uint64_t time_ns, uint64_t units) override;
+
+        /** Stop the wall clock timer of the run */
+        void stop();
+        /** Measurements of the run
+         *
+         * @return The measurements recorded so far
+         */
+        GEMMMeasurement measurement() const;
+
+    private:
+        /** Phase measurements updated concurrently by the threads running the GEMM */
+        struct AtomicPhase
+        {
+            std::atomic<uint64_t> events{ 0 };
+            std::atomic<uint64_t> time_ns{ 0 };
+            std::atomic<uint64_t> units{ 0 };
+        };
+
+        std::string                           _layer;
+        GEMMShape                             _shape;
+        std::chrono::steady_clock::time_point _start;
+        uint64_t                              _time_ns;
+        std::array<AtomicPhase, num_phases>   _phases;
+    };
+
+    std::list<Run>             _runs;
+    std::string                _layer;
+    mutable arm_compute::Mutex _mtx;
+};
+}
+#endif /*__ARM_COMPUTE_NEGEMMPROFILER_H__ */
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMTUNER_H__
+#define __ARM_COMPUTE_NEGEMMTUNER_H__
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/NEON/kernels/assembly/arm_gemm.hpp"
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner of the arm_gemm assembly GEMMs
+ *
+ * Measures the implementation method and block sizes which run a GEMM the fastest and
+ * keeps them in a table indexed by the GEMM's configuration (data type, shape, number of threads and CPU model).
+ *
+ * @note The tuner is used by the NEON functions running assembly GEMMs once it has been set with @ref IScheduler::set_gemm_tuner
+ */
+class NEGEMMTuner
+{
+public:
+    /** Function which runs a GEMM configured with a given candidate configuration,
+     *  empty if the candidate can't be configured.
+     */
+    using CandidateRunner = std::function<void()>;
+    /** Function creating the runner of a candidate configuration */
+    using CandidateFactory = std::function<CandidateRunner(const arm_gemm::GemmConfig &)>;
+
+    /** Constructor
+     *
+     * @param[in] tune_new_gemms Find the optimal configuration for GEMMs which are not present in the table ?
+     */
+    NEGEMMTuner(bool tune_new_gemms = true);
+
+    /** Setter for tune_new_gemms option
+     *
+     * @param[in] tune_new_gemms Find the optimal configuration for GEMMs which are not present in the table ?
+     */
+    void set_tune_new_gemms(bool tune_new_gemms);
+    /** Tune GEMMs that are not in the configuration table
+     *
+     * @return True if tuning of new GEMMs is enabled.
+     */
+    bool tune_new_gemms() const;
+    /** Manually add a configuration for a GEMM
+     *
+     * @param[in] gemm_id Unique identifier of the GEMM (see @ref NEGEMMTuner::gemm_id)
+     * @param[in] config  Optimal configuration to use for the given GEMM
+     */
+    void add_config_to_table(const std::string &gemm_id, const arm_gemm::GemmConfig &config);
+    /** Import configuration table
+     *
+     * @param[in] config_table The unordered_map container to import
+     */
+    void import_config_table(const std::unordered_map<std::string, arm_gemm::GemmConfig> &config_table);
+    /** Give read access to the configuration table
+     *
+     * @return The configuration table as unordered_map container
+     */
+    const std::unordered_map<std::string, arm_gemm::GemmConfig> &config_table() const;
+
+    /** Load the configuration table from file
+     *
+     * @param[in] filename Load the configuration table from this file.(Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the configuration table to file
+     *
+     * @param[in] filename Save the configuration table to this file. (Content will be overwritten)
+     */
+    void save_to_file(const std::string &filename) const;
+
+    /** Get the configuration of a GEMM
+     *
+     * If the GEMM is not in the table and tuning of new GEMMs is enabled, the candidate configurations
+     * are timed and the fastest one is added to the table.
+     *
+     * @param[in] gemm_id Unique identifier of the GEMM (see @ref NEGEMMTuner::gemm_id)
+     * @param[in] N       Number of columns of the output matrix
+     * @param[in] K       Number of columns of the first input matrix
+     * @param[in] factory Function creating the runner of a candidate configuration
+     *
+     * @return The configuration to use, the default one if the GEMM is unknown and isn't tuned.
+     */
+    arm_gemm::GemmConfig find_config(const std::string &gemm_id, unsigned int N, unsigned int K, const CandidateFactory &factory);
+
+    /** Create the identifier of a GEMM
+     *
+     * @param[in] data_type         Name of the data type of the GEMM
+     * @param[in] M                 Number of rows of the output matrix
+     * @param[in] N                 Number of columns of the output matrix
+     * @param[in] K                 Number of columns of the first input matrix
+     * @param[in] batches           Number of batches
+     * @param[in] multis            Number of multis
+     * @param[in] num_threads       Number of threads running the GEMM
+     * @param[in] pretranspose_hint True if the second input matrix gets pretransposed
+     * @param[in] cpu_model         CPU model the GEMM runs on
+     *
+     * @return The identifier of the GEMM
+     */
+    static std::string gemm_id(const std::string &data_type, unsigned int M, unsigned int N, unsigned int K, unsigned int batches, unsigned int multis,
+                               unsigned int num_threads, bool pretranspose_hint, CPUModel cpu_model);
+
+private:
+    /** Find the fastest configuration using a brute-force approach
+     *
+     * @param[in] N       Number of columns of the output matrix
+     * @param[in] K       Number of columns of the first input matrix
+     * @param[in] factory Function creating the runner of a candidate configuration
+     *
+     * @return The fastest configuration
+     */
+    arm_gemm::GemmConfig find_optimal_config(unsigned int N, unsigned int K, const CandidateFactory &factory);
+
+    std::unordered_map<std::string, arm_gemm::GemmConfig> _config_table;
+    bool _tune_new_gemms;
+};
+}
+#endif /*__ARM_COMPUTE_NEGEMMTUNER_H__ */
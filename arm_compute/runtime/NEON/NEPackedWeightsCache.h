@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEPACKEDWEIGHTSCACHE_H__
+#define __ARM_COMPUTE_NEPACKEDWEIGHTSCACHE_H__
+
+#include "support/Mutex.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Cache of packed (e.g. pretransposed) weights
+ *
+ * Packing the weights for the assembly GEMMs is done on the first run of every function.
+ * The cache records the packed buffers so that they can be saved to a file, which later processes map
+ * read-only: the packed weights are then neither recomputed nor copied to anonymous memory.
+ *
+ * Buffers are identified by a key describing how they were packed (GEMM shape, method, block sizes and CPU)
+ * and a hash of the weights they were packed from (see @ref NEPackedWeightsCache::hash).
+ *
+ * The buffers are immutable and reference counted: the functions using a buffer share its ownership, while the cache
+ * only keeps a weak reference to the buffers it didn't load. Functions configured with the same weights, e.g. from
+ * several instances of a graph, therefore share a single packed copy which is freed once the last of them is destroyed.
+ *
+ * @note The cache is used by the NEON functions running assembly GEMMs once it has been set with @ref IScheduler::set_weights_cache
+ */
+class NEPackedWeightsCache
+{
+public:
+    /** Default constructor */
+    NEPackedWeightsCache();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPackedWeightsCache(const NEPackedWeightsCache &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPackedWeightsCache &operator=(const NEPackedWeightsCache &) = delete;
+    /** Default destructor
+     *
+     * @note The loaded file stays mapped until the functions using its buffers are destroyed.
+     */
+    ~NEPackedWeightsCache() = default;
+
+    /** Map a cache file read-only and add its buffers to the cache
+     *
+     * @note Any previously loaded file gets unmapped once its buffers are not used anymore.
+     *
+     * @param[in] filename Load the cache from this file. (Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the buffers of the cache to file
+     *
+     * @note The file is written to a temporary file first, so it can safely replace the loaded file.
+     *
+     * @param[in] filename Save the cache to this file. (Content will be overwritten)
+     */
+    void save_to_file(const std::string &filename) const;
+
+    /** Look up a packed buffer
+     *
+     * @param[in] key  Key of the buffer
+     * @param[in] size Expected size of the buffer in bytes
+     *
+     * @return The read-only buffer, nullptr if no buffer of this size is alive for this key.
+     */
+    std::shared_ptr<const void> find(const std::string &key, size_t size) const;
+    /** Record a packed buffer
+     *
+     * @note The cache doesn't extend the lifetime of the buffer: it is forgotten once the last reference to it is released.
+     *
+     * @param[in] key  Key of the buffer
+     * @param[in] data Packed buffer
+     * @param[in] size Size of the buffer in bytes
+     *
+     * @return The buffer now recorded for this key: a buffer of the same size recorded by another function in the meantime is kept instead of @p data.
+     */
+    std::shared_ptr<const void> add(const std::string &key, std::shared_ptr<const void> data, size_t size);
+    /** Number of buffers in the cache
+     *
+     * @return Number of buffers loaded or recorded which are still alive.
+     */
+    size_t num_entries() const;
+    /** Were buffers recorded since the cache was loaded ?
+     *
+     * @return True if the cache should be saved.
+     */
+    bool has_new_entries() const;
+
+    /** Hash the content of a tensor
+     *
+     * @param[in] tensor Tensor to hash. Padding is ignored.
+     *
+     * @return Hash of the tensor's elements.
+     */
+    static uint64_t hash(const ITensor &tensor);
+
+private:
+    /** Packed buffer */
+    struct Entry
+    {
+        std::weak_ptr<const void> data; /**< Read-only packed data */
+        size_t                    size; /**< Size of the buffer in bytes */
+    };
+
+    std::map<std::string, Entry> _entries;
+    std::shared_ptr<const void>  _mapping;
+    bool                         _has_new_entries;
+    mutable arm_compute::Mutex   _mtx;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEPACKEDWEIGHTSCACHE_H__ */
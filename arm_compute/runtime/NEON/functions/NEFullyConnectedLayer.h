@@ -33,6 +33,8 @@
 #include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
 #include "arm_compute/core/NEON/kernels/NETransposeKernel.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/AssemblyHelper.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
 namespace arm_compute
@@ -86,8 +88,11 @@ private:
  *  -# @ref NEGEMMInterleave4x4Kernel (called if we have a multi-batch input)
  *  -# @ref NEGEMMMatrixMultiplyKernel
  *  -# @ref NEGEMMMatrixAccumulateBiasesKernel (if @p biases is not equal to nullptr)
+ *  -# @ref NEActivationLayer (if a fused activation is enabled and not applied by the assembly GEMMs)
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
+ * @note  For F32, unless the weights are already reshaped, the matrix multiplication runs on the assembly GEMMs instead,
+ *        which add the biases and apply RELU, BOUNDED_RELU and LU_BOUNDED_RELU activations in their output stage.
  */
 class NEFullyConnectedLayer : public IFunction
 {
@@ -110,8 +115,10 @@ public:
      * @param[out] output               Destination tensor. Data type supported: Same as @p input.
      * @param[in]  transpose_weights    (Optional) Transpose the weights tensor if true. Defaults to true.
      * @param[in]  are_weights_reshaped (Optional) Reshape the weights tensor if false. Defaults to false.
+     * @param[in]  act_info             (Optional) Activation layer information in case of a fused activation.
      */
-    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights = true, bool are_weights_reshaped = false);
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights = true, bool are_weights_reshaped = false,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
     /** Static function to check if given info will lead to a valid configuration of @ref CLFullyConnectedLayer
      *
      * @param[in] input                Source tensor info. Data type supported: QS8/QS16/F16/F32.
@@ -120,28 +127,48 @@ public:
      * @param[in] output               Destination tensor info. Data type supported: Same as @p input.
      * @param[in] transpose_weights    (Optional) Transpose weights if true. Defaults to true.
      * @param[in] are_weights_reshaped (Optional) Reshape the weights tensor if false. Defaults to false.
+     * @param[in] act_info             (Optional) Activation layer information in case of a fused activation.
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, bool transpose_weights = true, bool are_weights_reshaped = false);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, bool transpose_weights = true, bool are_weights_reshaped = false,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     //Inherited methods override
     void run() override;
 
 private:
+    /** Configure the F32 path running on the assembly GEMMs
+     *
+     * @param[in]  input                Source tensor.
+     * @param[in]  weights              Weights tensor.
+     * @param[in]  biases               Bias tensor. Can be nullptr.
+     * @param[out] output               Destination tensor.
+     * @param[in]  transpose_weights    Transpose the weights tensor if true.
+     * @param[in]  num_input_dimensions Number of dimensions of the input which aren't batches.
+     * @param[in]  act_info             Activation applied by the output stage of the GEMM.
+     */
+    void configure_asm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights, int num_input_dimensions,
+                       const ActivationLayerInfo &act_info);
+
+    AssemblyKernelGlueF32               _asm_glue;
     MemoryGroup                         _memory_group;
     NEIm2ColKernel                      _im2col_kernel;
     NEFullyConnectedLayerReshapeWeights _reshape_weights_kernel;
     NEGEMMInterleave4x4Kernel           _interleave4x4_kernel;
     NEGEMMMatrixMultiplyKernel          _mm_kernel;
     NEGEMMMatrixAccumulateBiasesKernel  _accumulate_biases_kernel;
+    NEActivationLayer                   _activationlayer_function;
     Tensor                              _im2col_output;
     Tensor                              _interleave4x4_output;
     Tensor                              _reshape_weights_output;
+    Tensor                              _workspace;
+    Tensor                              _B_pretransposed;
     bool                                _are_weights_reshaped;
     bool                                _is_batched_fc_layer;
     bool                                _linearize_input;
     bool                                _accumulate_biases;
+    bool                                _is_activationlayer_enabled;
     const ITensor                      *_original_weights;
 };
 } // namespace arm_compute
@@ -40,7 +40,6 @@
 #include "arm_compute/runtime/NEON/AssemblyHelper.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h"
-#include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
@@ -94,10 +93,11 @@ private:
  * -# @ref NEWeightsReshapeKernel   (executed only once for each configuration)
  * -# @ref NEIm2ColKernel
  * -# @ref NEGEMMInterleave4x4Kernel (executed only in case GEMM is required for the operation)
- * -# @ref NEGEMMMatrixMultiplyKernel or @ref NEGEMMLowpMatrixMultiplyCore (if quantized asymmetric)
- * -# @ref NEGEMMLowpQuantizeDownInt32ToUint8Scale (if quantized asymmetric)
+ * -# @ref NEGEMMMatrixMultiplyKernel or @ref NEGEMMLowpMatrixMultiplyCore (if quantized asymmetric, requantizing its results)
  * -# @ref NECol2ImKernel
- * -# @ref NEActivationLayer (executed only if the activation layer is enabled)
+ * -# @ref NEActivationLayer (executed only if the activation layer is enabled and not fused in the assembly GEMM)
+ *
+ * @note For F32 the biases and the RELU/BOUNDED_RELU/LU_BOUNDED_RELU activations are applied by the output stage of the assembly GEMM.
  */
 class NEGEMMConvolutionLayer : public IFunction
 {
@@ -159,33 +159,33 @@ private:
      *
      * @param[in]  input          Input tensor. Data types supported: QS8/QASYMM8/QS16/F16/F32.
      * @param[in]  weights        Weights tensor. Data type supported: Same as @p input.
-     * @param[out] output         Output tensor. Data types supported: Same as @p input,
-     *                            except for input of QASYMM8 type where output should be of S32 type.
+     * @param[in]  biases         Biases tensor, added by the requantization of the results for input of QASYMM8 type, otherwise unused.
+     *                            Data type supported: S32.
+     * @param[out] output         Output tensor. Data types supported: Same as @p input.
      * @param[in]  is_interleaved (Optional) True if input0 and input1 have been reshaped respectively using @ref CLGEMMInterleave4x4Kernel and @ref CLGEMMTranspose1xWKernel
      * @param[in]  reshape_info   (Optional) GEMM reshape info. If is_interleaved_transposed = true, this object must contain the information to understand how the matrix A and matrix B have been reshaped
      */
-    void configure_mm(const ITensor *input, const ITensor *weights, ITensor *output, bool is_interleaved, const GEMMReshapeInfo &reshape_info = GEMMReshapeInfo());
+    void configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool is_interleaved, const GEMMReshapeInfo &reshape_info = GEMMReshapeInfo());
 
 private:
-    AssemblyKernelGlueF32                               _asm_glue;
-    MemoryGroup                                         _memory_group;
-    NEIm2ColKernel                                      _input_im2col_kernel;
-    NEGEMMInterleave4x4Kernel                           _input_interleave_kernel;
-    NEConvolutionLayerReshapeWeights                    _reshape_weights;
-    NEGEMMMatrixMultiplyKernel                          _mm_kernel;
-    NEGEMMLowpMatrixMultiplyCore                        _mm_gemmlowp;
-    NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint _gemmlowp_output_stage;
-    NECol2ImKernel                                      _output_col2im_kernel;
-    NEActivationLayer                                   _activationlayer_function;
-    NEArithmeticAdditionKernel                          _add_bias_kernel;
+    AssemblyKernelGlueF32            _asm_glue;
+    MemoryGroup                      _memory_group;
+    NEIm2ColKernel                   _input_im2col_kernel;
+    NEGEMMInterleave4x4Kernel        _input_interleave_kernel;
+    NEConvolutionLayerReshapeWeights _reshape_weights;
+    NEGEMMMatrixMultiplyKernel       _mm_kernel;
+    NEGEMMLowpMatrixMultiplyCore     _mm_gemmlowp;
+    NECol2ImKernel                   _output_col2im_kernel;
+    NEActivationLayer                _activationlayer_function;
+    NEArithmeticAdditionKernel       _add_bias_kernel;
 
     const ITensor *_original_weights;
+    const ITensor *_original_biases;
 
     Tensor _input_im2col_reshaped;
     Tensor _input_interleaved_reshaped;
     Tensor _weights_reshaped;
     Tensor _gemm_output;
-    Tensor _tmp_output;
     Tensor _workspace;
     Tensor _B_pretransposed;
 
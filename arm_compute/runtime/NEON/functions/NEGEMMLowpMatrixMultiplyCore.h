@@ -31,6 +31,7 @@
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/AssemblyHelper.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
@@ -50,6 +51,10 @@ class ITensor;
  *
  *  -# @ref NEGEMMLowpOffsetContributionKernel
  *
+ * When the results are requantized to QASYMM8, the assembly GEMM applies the offset contributions and the output stage
+ * as it writes its results on AArch64; otherwise they are applied by @ref NEGEMMLowpOffsetContributionKernel and
+ * @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint.
+ *
 */
 class NEGEMMLowpMatrixMultiplyCore : public IFunction
 {
@@ -83,32 +88,75 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *output, const GEMMInfo &gemm_info = GEMMInfo());
+    /** Initialise the kernel's inputs, output, requantizing the results to QASYMM8
+     *
+     * The results of the matrix product are requantized as by @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint,
+     * without writing them to an intermediate S32 tensor when the assembly GEMM supports it.
+     *
+     * @param[in]  a            First input tensor  (Matrix A). Data type supported: QASYMM8.
+     * @param[in]  b            Second input tensor (Matrix B). Data type supported: same as @p a
+     * @param[in]  bias         Biases tensor. Only shared biases supported and it can be a nullptr if the biases addition is not required.
+     *                          Biases are 1D tensor with dimensions [OFM]. Data type supported: S32.
+     * @param[out] output       Output tensor. Data type supported: QASYMM8
+     * @param[in]  output_stage Requantization of the results.
+     * @param[in]  gemm_info    (Optional) Specifies if the matrix A and/or matrix B have been reshaped and
+     *                          if the reshape of matrix B should be executed only for the first run
+     */
+    void configure(const ITensor *a, const ITensor *b, const ITensor *bias, ITensor *output, const GEMMLowpOutputStageInfo &output_stage, const GEMMInfo &gemm_info = GEMMInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMLowpMatrixMultiplyCore requantizing the results to QASYMM8
+     *
+     * @param[in] a            First input tensor  (Matrix A). Data type supported: QASYMM8.
+     * @param[in] b            Second input tensor (Matrix B). Data type supported: same as @p a
+     * @param[in] bias         Biases tensor. Only shared biases supported and it can be a nullptr if the biases addition is not required.
+     *                         Biases are 1D tensor with dimensions [OFM]. Data type supported: S32.
+     * @param[in] output       Output tensor. Data type supported: QASYMM8
+     * @param[in] output_stage Requantization of the results.
+     * @param[in] gemm_info    (Optional) Specifies if the matrix A and/or matrix B have been reshaped and
+     *                         if the reshape of matrix B should be executed only for the first run
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *bias, const ITensorInfo *output, const GEMMLowpOutputStageInfo &output_stage,
+                           const GEMMInfo &gemm_info = GEMMInfo());
 
     // Inherited methods overridden
     void run() override;
 
 private:
-    MemoryGroup                        _memory_group;
-    AssemblyKernelGlueU8U32            _asm_glue_unsigned;
-    AssemblyKernelGlueS8S32            _asm_glue_signed;
-    std::unique_ptr<INEKernel>         _mm_kernel;
-    std::unique_ptr<INEKernel>         _mtx_a_reshape_kernel;
-    std::unique_ptr<INEKernel>         _mtx_b_reshape_kernel;
-    NEGEMMLowpMatrixAReductionKernel   _mtx_a_reduction_kernel;
-    NEGEMMLowpMatrixBReductionKernel   _mtx_b_reduction_kernel;
-    NEGEMMLowpOffsetContributionKernel _offset_contribution_kernel;
-    Tensor                             _vector_sum_col;
-    Tensor                             _vector_sum_row;
-    Tensor                             _tmp_a;
-    Tensor                             _tmp_b;
-    Tensor                             _workspace;
-    Tensor                             _B_pretranspose;
-    int32_t                            _a_offset;
-    int32_t                            _b_offset;
-    bool                               _run_vector_matrix_multiplication;
-    bool                               _dot_product_path;
-    bool                               _is_first_run;
-    bool                               _reshape_b_only_on_first_run;
+    /** Configure the reductions of A and B needed by the offset contributions
+     *
+     * @param[in] a First input tensor  (Matrix A).
+     * @param[in] b Second input tensor (Matrix B).
+     */
+    void configure_reductions(const ITensor *a, const ITensor *b);
+    /** Allocate the results of the reductions configured by @ref configure_reductions */
+    void allocate_reductions();
+
+    MemoryGroup                                         _memory_group;
+    AssemblyKernelGlueU8U32                             _asm_glue_unsigned;
+    AssemblyKernelGlueS8S32                             _asm_glue_signed;
+    std::unique_ptr<INEKernel>                          _mm_kernel;
+    std::unique_ptr<INEKernel>                          _mtx_a_reshape_kernel;
+    std::unique_ptr<INEKernel>                          _mtx_b_reshape_kernel;
+    NEGEMMLowpMatrixAReductionKernel                    _mtx_a_reduction_kernel;
+    NEGEMMLowpMatrixBReductionKernel                    _mtx_b_reduction_kernel;
+    NEGEMMLowpOffsetContributionKernel                  _offset_contribution_kernel;
+    NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint _output_stage;
+    Tensor                                              _vector_sum_col;
+    Tensor                                              _vector_sum_row;
+    Tensor                                              _tmp_a;
+    Tensor                                              _tmp_b;
+    Tensor                                              _mm_result_s32;
+    Tensor                                              _workspace;
+    Tensor                                              _B_pretranspose;
+    int32_t                                             _a_offset;
+    int32_t                                             _b_offset;
+    bool                                                _run_vector_matrix_multiplication;
+    bool                                                _dot_product_path;
+    bool                                                _is_first_run;
+    bool                                                _reshape_b_only_on_first_run;
+    bool                                                _fused_output_stage;
+    bool                                                _run_output_stage;
 };
 }
 #endif /*__ARM_COMPUTE_NEGEMMLOWPMATRIXMULTIPLYCORE_H__ */
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGROUPEDCONVOLUTIONLAYER_H__
+#define __ARM_COMPUTE_NEGROUPEDCONVOLUTIONLAYER_H__
+
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/kernels/NECol2ImKernel.h"
+#include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/AssemblyHelper.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+/** Basic function to compute a grouped convolution layer in a single pass.
+ *
+ * The im2col matrix of the whole input is built once, then every group is run as one multi of the same assembly GEMM,
+ * which reads its slice of the im2col matrix and of the reshaped weights in place and writes its output channels
+ * straight into a GEMM output shared by all the groups. No split or concatenation of the feature maps is needed.
+ *
+ * This function calls the following NEON kernels/functions:
+ *
+ * -# @ref NEIm2ColKernel
+ * -# @ref NEConvolutionLayerReshapeWeights
+ * -# @ref NEGEMMAssemblyWrapper
+ * -# @ref NECol2ImKernel
+ * -# @ref NEActivationLayer (if the activation can't be fused in the GEMM)
+ */
+class NEGroupedConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEGroupedConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupedConvolutionLayer(const NEGroupedConvolutionLayer &) = delete;
+    /** Default move constructor */
+    NEGroupedConvolutionLayer(NEGroupedConvolutionLayer &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupedConvolutionLayer &operator=(const NEGroupedConvolutionLayer &) = delete;
+    /** Default move assignment operator */
+    NEGroupedConvolutionLayer &operator=(NEGroupedConvolutionLayer &&) = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input      Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                        while every optional dimension from 4 and above represent a batch of inputs.
+     *                        Data types supported: F32. Data layouts supported: NCHW.
+     * @param[in]  weights    Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM].
+     *                        The OFM of group g are the g-th slice of OFM / num_groups. Data type supported: Same as @p input.
+     * @param[in]  biases     Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[out] output     Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                        Data types supported: Same as @p input.
+     * @param[in]  conv_info  Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  num_groups Number of groups, IFM and OFM must both be multiples of it.
+     * @param[in]  act_info   (Optional) Activation layer information in case of a fused activation.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int num_groups,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGroupedConvolutionLayer
+     *
+     * @param[in] input      Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                       while every optional dimension from 4 and above represent a batch of inputs.
+     *                       Data types supported: F32. Data layouts supported: NCHW.
+     * @param[in] weights    Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported: Same as @p input.
+     * @param[in] biases     Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[in] output     Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                       Data types supported: Same as @p input.
+     * @param[in] conv_info  Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] num_groups Number of groups, IFM and OFM must both be multiples of it.
+     * @param[in] act_info   (Optional) Activation layer information in case of a fused activation.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info, unsigned int num_groups,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    /** View of a matrix whose columns are split in groups, the groups being its multis */
+    class GroupView final : public ITensor
+    {
+    public:
+        /** Initialise the view
+         *
+         * @param[in] matrix     Matrix to view, its strides must not change anymore.
+         * @param[in] num_groups Number of groups the columns of @p matrix are split in.
+         * @param[in] is_batched True if the batches of @p matrix, in its 4th dimension, are viewed as well.
+         */
+        void init(const ITensor *matrix, unsigned int num_groups, bool is_batched);
+
+        // Inherited methods overridden:
+        ITensorInfo *info() const override;
+        ITensorInfo *info() override;
+        uint8_t *buffer() const override;
+
+    private:
+        const ITensor     *_matrix{ nullptr };
+        mutable TensorInfo _info{};
+    };
+
+    AssemblyKernelGlueF32            _asm_glue;
+    MemoryGroup                      _memory_group;
+    NEIm2ColKernel                   _input_im2col_kernel;
+    NEConvolutionLayerReshapeWeights _reshape_weights;
+    NECol2ImKernel                   _output_col2im_kernel;
+    NEActivationLayer                _activationlayer_function;
+
+    const ITensor *_original_weights;
+
+    Tensor _input_im2col_reshaped;
+    Tensor _weights_reshaped;
+    Tensor _gemm_output;
+    Tensor _workspace;
+    Tensor _B_pretransposed;
+
+    GroupView _input_im2col_view;
+    GroupView _weights_view;
+    GroupView _gemm_output_view;
+
+    bool _are_weights_reshaped;
+    bool _is_activationlayer_enabled;
+};
+}
+#endif /* __ARM_COMPUTE_NEGROUPEDCONVOLUTIONLAYER_H__ */
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEIMPLICITGEMMCONVOLUTIONLAYER_H__
+#define __ARM_COMPUTE_NEIMPLICITGEMMCONVOLUTIONLAYER_H__
+
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/core/NEON/kernels/NECol2ImKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/AssemblyHelper.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to compute a convolution layer as a GEMM without materialising its im2col matrix.
+ *
+ * The assembly GEMM gathers the rows of the im2col matrix straight from the input as it interleaves them,
+ * one block at a time, so the only intermediate buffers are the reshaped weights and, for NCHW, the GEMM output.
+ *
+ * @note The gathers are slower than the im2col reshape, element by element in NHWC, so @ref NEConvolutionLayer never picks this function:
+ *       use it directly, or through graph::ConvolutionMethod::IMPLICIT_GEMM, when the memory of the im2col matrix matters more than the speed.
+ *
+ * This function calls the following NEON kernels/functions:
+ *
+ * -# @ref NEConvolutionLayerReshapeWeights
+ * -# @ref NEGEMMAssemblyWrapper
+ * -# @ref NECol2ImKernel (if the data layout is NCHW)
+ * -# @ref NEActivationLayer (if the activation can't be fused in the GEMM)
+ */
+class NEImplicitGEMMConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEImplicitGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImplicitGEMMConvolutionLayer(const NEImplicitGEMMConvolutionLayer &) = delete;
+    /** Default move constructor */
+    NEImplicitGEMMConvolutionLayer(NEImplicitGEMMConvolutionLayer &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImplicitGEMMConvolutionLayer &operator=(const NEImplicitGEMMConvolutionLayer &) = delete;
+    /** Default move assignment operator */
+    NEImplicitGEMMConvolutionLayer &operator=(NEImplicitGEMMConvolutionLayer &&) = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input        Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                          while every optional dimension from 4 and above represent a batch of inputs.
+     *                          Data types supported: F32.
+     * @param[in]  weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[out] output       Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                          Data types supported: Same as @p input.
+     * @param[in]  conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  weights_info (Optional) Weights information. Reshaped weights aren't supported.
+     * @param[in]  dilation     (Optional) Dilation, in elements, across x and y. Only (1, 1) is supported.
+     * @param[in]  act_info     (Optional) Activation layer information in case of a fused activation.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
+                   const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEImplicitGEMMConvolutionLayer
+     *
+     * @param[in] input        Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                         while every optional dimension from 4 and above represent a batch of inputs.
+     *                         Data types supported: F32.
+     * @param[in] weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in] biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[in] output       Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                         Data types supported: Same as @p input.
+     * @param[in] conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info (Optional) Weights information. Reshaped weights aren't supported.
+     * @param[in] dilation     (Optional) Dilation, in elements, across x and y. Only (1, 1) is supported.
+     * @param[in] act_info     (Optional) Activation layer information in case of a fused activation.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                           const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    AssemblyKernelGlueF32            _asm_glue;
+    MemoryGroup                      _memory_group;
+    NEConvolutionLayerReshapeWeights _reshape_weights;
+    NECol2ImKernel                   _output_col2im_kernel;
+    NEActivationLayer                _activationlayer_function;
+
+    const ITensor *_original_weights;
+
+    Tensor _weights_reshaped;
+    Tensor _gemm_output;
+    Tensor _workspace;
+    Tensor _B_pretransposed;
+
+    bool _is_nchw;
+    bool _are_weights_reshaped;
+    bool _is_activationlayer_enabled;
+};
+}
+#endif /* __ARM_COMPUTE_NEIMPLICITGEMMCONVOLUTIONLAYER_H__ */
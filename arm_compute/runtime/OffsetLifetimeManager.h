@@ -37,7 +37,10 @@ namespace arm_compute
 class IMemoryPool;
 
 /** Concrete class that tracks the lifetime of registered tensors and
- *  calculates the systems memory requirements in terms of a single blob and a list of offsets */
+ *  calculates the systems memory requirements in terms of a single blob and a list of offsets
+ *
+ *  Tensors whose lifetimes do not overlap can share offsets: they are packed greedily
+ *  by decreasing size, each one in the tightest gap left by the tensors alive at the same time. */
 class OffsetLifetimeManager : public ISimpleLifetimeManager
 {
 public:
@@ -52,8 +55,20 @@ public:
     /** Allow instances of this class to be moved */
     OffsetLifetimeManager &operator=(OffsetLifetimeManager &&) = default;
 
+    /** Size of the memory blob planned by the lifetime-aware packing
+     *
+     * @return Planned size in bytes
+     */
+    size_t planned_size() const;
+    /** Size the memory blob would have if the blobs were laid end to end
+     *
+     * @return Size in bytes
+     */
+    size_t unpacked_size() const;
+
     // Inherited methods overridden:
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    std::unique_ptr<IMemoryPool> create_pool(MemoryArena *arena) override;
     MappingType mapping_type() const override;
 
 private:
@@ -61,7 +76,8 @@ private:
     void update_blobs_and_mappings() override;
 
 private:
-    size_t _blob; /**< Memory blob size */
+    size_t _blob;          /**< Memory blob size */
+    size_t _unpacked_blob; /**< Memory blob size without packing */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_OFFSETLIFETIMEMANAGER_H__ */
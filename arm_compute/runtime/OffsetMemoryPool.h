@@ -33,6 +33,7 @@
 namespace arm_compute
 {
 class IAllocator;
+class MemoryArena;
 
 /** Offset based memory pool */
 class OffsetMemoryPool : public IMemoryPool
@@ -46,6 +47,14 @@ public:
      * @param[in] blob_size Size of the memory be allocated
      */
     OffsetMemoryPool(IAllocator *allocator, size_t blob_size);
+    /** Constructor of a pool that leases its memory blob from an arena on acquire
+     *
+     * @note arena should outlive the memory pool
+     *
+     * @param[in] arena     Memory arena to lease from
+     * @param[in] blob_size Size of the memory be leased
+     */
+    OffsetMemoryPool(MemoryArena *arena, size_t blob_size);
     /** Default Destructor */
     ~OffsetMemoryPool();
     /** Prevent instances of this class to be copy constructed */
@@ -64,9 +73,10 @@ public:
     std::unique_ptr<IMemoryPool> duplicate() override;
 
 private:
-    IAllocator *_allocator; /**< Allocator to use for internal allocation */
-    void       *_blob;      /**< Memory blob */
-    size_t      _blob_size; /**< Sizes of the allocated memory blob */
+    IAllocator  *_allocator; /**< Allocator to use for internal allocation */
+    MemoryArena *_arena;     /**< Arena to lease the memory blob from */
+    void        *_blob;      /**< Memory blob */
+    size_t       _blob_size; /**< Sizes of the allocated memory blob */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_OFFSETMEMORYPOOL_H__ */
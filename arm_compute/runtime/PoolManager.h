@@ -57,12 +57,15 @@ public:
     void unlock_pool(IMemoryPool *pool) override;
     void register_pool(std::unique_ptr<IMemoryPool> pool) override;
     size_t num_pools() const override;
+    void freeze() override;
+    bool is_frozen() const override;
 
 private:
     std::list<std::unique_ptr<IMemoryPool>> _free_pools;     /**< List of free pools */
     std::list<std::unique_ptr<IMemoryPool>> _occupied_pools; /**< List of occupied pools */
     std::unique_ptr<arm_compute::Semaphore> _sem;            /**< Semaphore to control the queues */
     mutable arm_compute::Mutex              _mtx;            /**< Mutex to control access to the queues */
+    bool                                    _is_frozen;      /**< Flag that notes if the pools stay bound to the groups */
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_POOLMANAGER_H__ */
@@ -70,6 +70,13 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Overrides the scheduler returned by @ref get() on the calling thread.
+     *
+     * This allows several threads to run functions concurrently, each one splitting its kernels on its own pool of threads.
+     *
+     * @param[in] scheduler Scheduler to use on the calling thread. Pass nullptr to go back to the active scheduler.
+     */
+    static void set_thread_local(IScheduler *scheduler);
 
 private:
     static Type                        _scheduler_type;
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_RUNTIME_TYPES_H__
 #define __ARM_COMPUTE_RUNTIME_TYPES_H__
 
+#include <cstddef>
 #include <map>
 
 namespace arm_compute
@@ -35,6 +36,14 @@ enum class MappingType
     OFFSETS /**< Mappings are in offset granularity in the same blob */
 };
 
+/** Huge pages policy of an allocator */
+enum class HugePagePolicy
+{
+    NONE,        /**< Only use regular pages */
+    TRANSPARENT, /**< Ask the kernel to back large allocations with transparent huge pages */
+    EXPLICIT     /**< Map large allocations from the pool of reserved huge pages, fall back to transparent huge pages if the pool is exhausted */
+};
+
 /** A map of (handle, index/offset), where handle is the memory handle of the object
  * to provide the memory for and index/offset is the buffer/offset from the pool that should be used
  *
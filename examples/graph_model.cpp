@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "support/ToolchainSupport.h"
+#include "utils/GraphUtils.h"
+#include "utils/Utils.h"
+
+#include <cstdlib>
+
+using namespace arm_compute::utils;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::graph_utils;
+
+/** Example demonstrating how to run a network saved with arm_compute::graph::GraphSerializer
+ *
+ * @note The preprocessing of the input isn't part of the model: a PPM image is fed as is, use a NumPy file for preprocessed inputs
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( Target (0 = NEON, 1 = OpenCL, 2 = OpenCL with Tuner), Path to the model file, [optional] image, [optional] labels )
+ */
+class GraphModelExample : public Example
+{
+public:
+    void do_setup(int argc, char **argv) override
+    {
+        std::string model; /* Model file */
+        std::string image; /* Image data */
+        std::string label; /* Label data */
+
+        // Parse arguments
+        if(argc < 3)
+        {
+            // Print help
+            std::cout << "Usage: " << argv[0] << " target model_file [image] [labels]\n\n";
+            throw std::runtime_error("No model file provided");
+        }
+        else if(argc == 3)
+        {
+            model = argv[2];
+            std::cout << "Usage: " << argv[0] << " " << argv[1] << " " << argv[2] << " [image] [labels]\n\n";
+            std::cout << "No image provided: using random values\n\n";
+        }
+        else if(argc == 4)
+        {
+            model = argv[2];
+            image = argv[3];
+            std::cout << "Usage: " << argv[0] << " " << argv[1] << " " << argv[2] << " " << argv[3] << " [labels]\n\n";
+            std::cout << "No text file with labels provided: skipping output accessor\n\n";
+        }
+        else
+        {
+            model = argv[2];
+            image = argv[3];
+            label = argv[4];
+        }
+
+        // Set target. 0 (NEON), 1 (OpenCL), 2 (OpenCL with Tuner)
+        const int    target      = std::strtol(argv[1], nullptr, 10);
+        const Target target_hint = set_target_hint(target);
+
+        // Build the graph from the model, the constants are backed by the mapped file
+        arm_compute::graph::Graph &g = graph.graph();
+        arm_compute::graph::GraphSerializer::deserialize(g, model, target_hint);
+
+        // The accessors of the inputs and outputs aren't part of the model
+        for(auto &input : g.inputs())
+        {
+            g.node(input)->output(0)->set_accessor(get_input_accessor(image));
+        }
+        for(auto &node : g.nodes())
+        {
+            if(node != nullptr && node->type() == arm_compute::graph::NodeType::Output)
+            {
+                node->input(0)->set_accessor(get_output_accessor(label, 5));
+            }
+        }
+
+        // Finalize graph
+        GraphConfig config;
+        config.use_tuner = (target == 2);
+        graph.finalize(target_hint, config);
+    }
+    void do_run() override
+    {
+        // Run graph
+        graph.run();
+    }
+
+private:
+    Stream graph{ 0, "Model" };
+};
+
+/** Main program for running a saved model
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( Target (0 = NEON, 1 = OpenCL, 2 = OpenCL with Tuner), Path to the model file, [optional] image, [optional] labels )
+ */
+int main(int argc, char **argv)
+{
+    return arm_compute::utils::run_example<GraphModelExample>(argc, argv);
+}
@@ -35,7 +35,7 @@ using namespace arm_compute::graph_utils;
 /** Example demonstrating how to implement VGG16's network using the Compute Library's graph API
  *
  * @param[in] argc Number of arguments
- * @param[in] argv Arguments ( [optional] Target (0 = NEON, 1 = OpenCL, 2 = OpenCL with Tuner), [optional] Path to the weights folder, [optional] image, [optional] labels, [optional] Fast math for convolution layer (0 = DISABLED, 1 = ENABLED) )
+ * @param[in] argv Arguments ( [optional] Target (0 = NEON, 1 = OpenCL, 2 = OpenCL with Tuner), [optional] Path to the weights folder, [optional] image, [optional] labels, [optional] Fast math for convolution layer (0 = DISABLED, 1 = ENABLED), [optional] File to save the model to )
  */
 class GraphVGG16Example : public Example
 {
@@ -45,6 +45,7 @@ public:
         std::string data_path; /* Path to the trainable data */
         std::string image;     /* Image data */
         std::string label;     /* Label data */
+        std::string model;     /* Model file to save */
 
         // Create a preprocessor object
         const std::array<float, 3> mean_rgb{ { 123.68f, 116.779f, 103.939f } };
@@ -63,25 +64,25 @@ public:
         if(argc < 2)
         {
             // Print help
-            std::cout << "Usage: " << argv[0] << " [target] [path_to_data] [image] [labels] [fast_math_hint]\n\n";
+            std::cout << "Usage: " << argv[0] << " [target] [path_to_data] [image] [labels] [fast_math_hint] [model_file]\n\n";
             std::cout << "No data folder provided: using random values\n\n";
         }
         else if(argc == 2)
         {
-            std::cout << "Usage: " << argv[0] << " " << argv[1] << " [path_to_data] [image] [labels] [fast_math_hint]\n\n";
+            std::cout << "Usage: " << argv[0] << " " << argv[1] << " [path_to_data] [image] [labels] [fast_math_hint] [model_file]\n\n";
             std::cout << "No data folder provided: using random values\n\n";
         }
         else if(argc == 3)
         {
             data_path = argv[2];
-            std::cout << "Usage: " << argv[0] << " " << argv[1] << " " << argv[2] << " [image] [labels] [fast_math_hint]\n\n";
+            std::cout << "Usage: " << argv[0] << " " << argv[1] << " " << argv[2] << " [image] [labels] [fast_math_hint] [model_file]\n\n";
             std::cout << "No image provided: using random values\n\n";
         }
         else if(argc == 4)
         {
             data_path = argv[2];
             image     = argv[3];
-            std::cout << "Usage: " << argv[0] << " " << argv[1] << " " << argv[2] << " " << argv[3] << " [labels] [fast_math_hint]\n\n";
+            std::cout << "Usage: " << argv[0] << " " << argv[1] << " " << argv[2] << " " << argv[3] << " [labels] [fast_math_hint] [model_file]\n\n";
             std::cout << "No text file with labels provided: skipping output accessor\n\n";
         }
         else if(argc == 5)
@@ -89,7 +90,7 @@ public:
             data_path = argv[2];
             image     = argv[3];
             label     = argv[4];
-            std::cout << "Usage: " << argv[0] << " " << argv[1] << " " << argv[2] << " " << argv[3] << " " << argv[4] << " [fast_math_hint]\n\n";
+            std::cout << "Usage: " << argv[0] << " " << argv[1] << " " << argv[2] << " " << argv[3] << " " << argv[4] << " [fast_math_hint] [model_file]\n\n";
             std::cout << "No fast math info provided: disabling fast math\n\n";
         }
         else
@@ -98,6 +99,7 @@ public:
             image          = argv[3];
             label          = argv[4];
             fast_math_hint = (std::strtol(argv[5], nullptr, 1) == 0) ? FastMathHint::DISABLED : FastMathHint::ENABLED;
+            model          = (argc > 6) ? argv[6] : "";
         }
 
         graph << target_hint
@@ -239,6 +241,12 @@ public:
               << SoftmaxLayer().set_name("prob")
               << OutputLayer(get_output_accessor(label, 5));
 
+        // Save the model, to be loaded by graph_model
+        if(!model.empty())
+        {
+            arm_compute::graph::GraphSerializer::serialize(graph.graph(), model);
+        }
+
         // Finalize graph
         GraphConfig config;
         config.use_tuner = (target == 2);
@@ -257,7 +265,7 @@ private:
 /** Main program for VGG16
  *
  * @param[in] argc Number of arguments
- * @param[in] argv Arguments ( [optional] Target (0 = NEON, 1 = OpenCL, 2 = OpenCL with Tuner), [optional] Path to the weights folder, [optional] image, [optional] labels, [optional] Fast math for convolution layer (0 = DISABLED, 1 = ENABLED) )
+ * @param[in] argv Arguments ( [optional] Target (0 = NEON, 1 = OpenCL, 2 = OpenCL with Tuner), [optional] Path to the weights folder, [optional] image, [optional] labels, [optional] Fast math for convolution layer (0 = DISABLED, 1 = ENABLED), [optional] File to save the model to )
  */
 int main(int argc, char **argv)
 {
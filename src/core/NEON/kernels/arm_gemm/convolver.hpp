@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+
+#include "arm_gemm.hpp"
+
+namespace arm_gemm
+{
+/*
+ * Gathers rows of the (virtual) im2col matrix of a convolution.
+ *
+ * Row m and columns [k0, kmax) are read straight from the input feature
+ * map.  Consecutive columns walk along kernel_x, so they are processed in
+ * runs along a row of the input: each run is a strided copy, with the parts
+ * falling in the padding filled with zeros.
+ */
+template <typename T>
+class convolver
+{
+private:
+    const ConvolutionParameters _params;
+
+public:
+    convolver(const ConvolutionParameters &params)
+        : _params(params)
+    {
+    }
+
+    /* Write rows [m0, mmax) and columns [k0, kmax) to out, ldout elements apart. */
+    void get_rows(T *out, const int ldout, const T *in, const unsigned int m0, const unsigned int mmax, const unsigned int k0, const unsigned int kmax) const
+    {
+        const unsigned int kernel_size = _params.kernel_width * _params.kernel_height;
+
+        for(unsigned int m = m0; m < mmax; m++, out += ldout)
+        {
+            const int in_x0 = static_cast<int>(m % _params.output_width) * _params.stride_x - _params.padding_left;
+            const int in_y0 = static_cast<int>(m / _params.output_width) * _params.stride_y - _params.padding_top;
+
+            T           *out_ptr = out;
+            unsigned int k       = k0;
+
+            while(k < kmax)
+            {
+                const int c   = k / kernel_size;
+                const int pos = k % kernel_size;
+                const int kx  = pos % _params.kernel_width;
+                const int ky  = pos / _params.kernel_width;
+                const int run = std::min(_params.kernel_width - kx, static_cast<int>(kmax - k));
+
+                const int x = in_x0 + kx;
+                const int y = in_y0 + ky;
+
+                if(y < 0 || y >= _params.input_height)
+                {
+                    std::fill_n(out_ptr, run, static_cast<T>(0));
+                }
+                else
+                {
+                    /* Only part of the run may be in the padding. */
+                    const int first = std::min(std::max(-x, 0), run);
+                    const int last  = std::max(std::min(_params.input_width - x, run), first);
+
+                    const T *in_ptr = in + (y * _params.input_stride_y) + (c * _params.input_stride_c);
+
+                    std::fill_n(out_ptr, first, static_cast<T>(0));
+                    for(int i = first; i < last; i++)
+                    {
+                        out_ptr[i] = in_ptr[(x + i) * _params.input_stride_x];
+                    }
+                    std::fill_n(out_ptr + last, run - last, static_cast<T>(0));
+                }
+
+                out_ptr += run;
+                k += run;
+            }
+        }
+    }
+};
+
+} // namespace arm_gemm
@@ -36,10 +36,10 @@ private:
 public:
     GemmBatched(const CPUInfo &ci, const unsigned int M, const unsigned int N, const unsigned int K,
                 const unsigned int nbatches, const unsigned int nmulti, const bool trA, const bool trB,
-                const To alpha, const To beta, const int maxthreads, const bool pretransposed_hint)
+                const To alpha, const To beta, const int maxthreads, const bool pretransposed_hint, const GemmConfig *cfg = nullptr)
     {
         /* Just create a subgemm with batches->M */
-        _subgemm = gemm<To, Tr>(ci, nbatches, N, K, 1, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint);
+        _subgemm = gemm<To, Tr>(ci, nbatches, N, K, 1, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint, cfg);
     }
 
     void set_arrays(const To *A, const int lda, const int A_batch_stride, const int A_multi_stride,
@@ -52,6 +52,16 @@ public:
                              C, C_batch_stride, 0, C_multi_stride);
     }
 
+    void set_output_stage(const Tr *bias, const int bias_multi_stride, const Activation &act) override
+    {
+        _subgemm->set_output_stage(bias, bias_multi_stride, act);
+    }
+
+    void set_profiler(ProfileSink *profiler) override
+    {
+        _subgemm->set_profiler(profiler);
+    }
+
     unsigned int get_window_size() const override
     {
         return _subgemm->get_window_size();
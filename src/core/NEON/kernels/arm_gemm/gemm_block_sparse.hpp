@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <assert.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "arm_gemm.hpp"
+#include "utils.hpp"
+
+#include "mergeresults.hpp"
+#include "transform.hpp"
+
+#include "profiler.hpp"
+
+// Implementation of the GemmCommon abstract class.
+//
+// This implementation skips the zero blocks of a pretransposed B, e.g. the
+// weights of a pruned layer.  Whether B is sparse is only known once it is
+// pretransposed, so this wraps the dense GEMM the dispatcher picked:
+// pretranspose_B_array() counts the nonzero blocks of B and stores it block
+// sparse if there are few enough of them, otherwise it hands B over to the
+// dense GEMM, which then does all the work.
+//
+// The window is the dense GEMM's, so that it doesn't change once B is
+// known; the units of the sparse work (the column blocks of each row block
+// of each problem) are spread over it.
+namespace arm_gemm
+{
+template <typename strategy, typename To, typename Tr>
+class GemmBlockSparse : public GemmCommon<To, Tr>
+{
+    typedef typename strategy::operand_type Toi;
+    typedef typename strategy::result_type  Tri;
+
+    // Header of the pretransposed buffer, saying whether the block sparse B
+    // or the dense GEMM's pretransposed B follows.  It is padded so that
+    // what follows is aligned like the buffer.
+    struct Header
+    {
+        uint32_t is_sparse;
+        uint32_t nnz;
+    };
+    static const size_t header_size = 128;
+
+    /* const properties set by constructor */
+    const CPUInfo *const _ci;
+
+    const unsigned int _Msize;
+    const unsigned int _Nsize;
+    const unsigned int _Ksize;
+
+    const unsigned int _nbatches;
+    const unsigned int _nmulti;
+
+    const Tr _alpha;
+    const Tr _beta;
+
+    const unsigned int _maxthreads;
+
+    /* Blocking of the sparse work */
+    const unsigned int _n_blocks;
+    const unsigned int _row_blocks;
+
+    /* Dense GEMM, used unless B is sparse enough */
+    UniqueGemmCommon<To, Tr> _dense;
+
+    /* Most nonzero blocks B can have to be stored sparse */
+    const size_t _max_nnz;
+    bool         _sparse_allowed = true;
+
+    /* Pretransposed B and working space */
+    bool            _B_ready       = false;
+    bool            _is_sparse     = false;
+    const uint32_t *_block_start   = nullptr;
+    const uint32_t *_k_index       = nullptr;
+    const Toi      *_values        = nullptr;
+    void           *_working_space = nullptr;
+
+    // The block sparse B: the first nonzero block of each column block (of
+    // all the multis, plus the end), the row of each nonzero block, then
+    // their values, aligned for the kernel.
+    size_t get_block_start_size() const
+    {
+        return ((static_cast<size_t>(_nmulti) * _n_blocks) + 1) * sizeof(uint32_t);
+    }
+
+    size_t get_values_offset(const size_t nnz) const
+    {
+        return roundup(get_block_start_size() + (nnz * sizeof(uint32_t)), static_cast<size_t>(16));
+    }
+
+    size_t get_sparse_size(const size_t nnz) const
+    {
+        return get_values_offset(nnz) + (nnz * strategy::out_width * sizeof(Toi));
+    }
+
+    // Per thread buffers: the results of a row block and its interleaved A.
+    size_t get_c_working_size() const
+    {
+        return roundup(sizeof(Tri) * _n_blocks * strategy::out_width * strategy::out_height, static_cast<size_t>(64));
+    }
+
+    size_t get_a_working_size() const
+    {
+        return roundup(sizeof(Toi) * _Ksize * strategy::out_height, static_cast<size_t>(64));
+    }
+
+    size_t get_thread_working_size() const
+    {
+        return get_c_working_size() + get_a_working_size();
+    }
+
+    // Units of the sparse work, spread over the dense GEMM's window.
+    uint64_t get_sparse_units() const
+    {
+        return static_cast<uint64_t>(_nmulti) * _nbatches * _row_blocks * _n_blocks;
+    }
+
+    bool is_nonzero_block(const To *B_row, const unsigned int block) const
+    {
+        const unsigned int x0   = block * strategy::out_width;
+        const unsigned int xmax = std::min(_Nsize, x0 + strategy::out_width);
+
+        for(unsigned int x = x0; x < xmax; x++)
+        {
+            if(B_row[x] != static_cast<To>(0))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /* The output stage variant of the merge doesn't read C if beta is 0, so it is used even without a bias or activation. */
+    template <unsigned int height>
+    void merge(Tr *C, const Tri *c_panel, const unsigned int y0, const unsigned int ymax, const unsigned int x0, const unsigned int xmax, const Tr *bias) const
+    {
+        MergeResults<strategy::out_width, height>(C, c_panel, this->_ldc, y0, ymax, x0, xmax, _alpha, _beta, bias, this->_act);
+    }
+
+public:
+    GemmBlockSparse(GemmBlockSparse &) = delete;
+    GemmBlockSparse &operator=(GemmBlockSparse &) = delete;
+
+    /* Constructor: B is stored sparse if at most max_density of its blocks are nonzero, otherwise the pretransposed dense GEMM is used. */
+    GemmBlockSparse(const CPUInfo *ci, const unsigned int M, const unsigned int N, const unsigned int K,
+                    const unsigned int nbatches, const unsigned int nmulti, const Tr alpha, const Tr beta, const int maxthreads,
+                    const float max_density, UniqueGemmCommon<To, Tr> dense)
+        : _ci(ci), _Msize(M), _Nsize(N), _Ksize(K), _nbatches(nbatches), _nmulti(nmulti), _alpha(alpha), _beta(beta), _maxthreads(maxthreads),
+          _n_blocks(iceildiv(N, strategy::out_width)), _row_blocks(iceildiv(M, strategy::out_height)), _dense(std::move(dense)),
+          _max_nnz(static_cast<size_t>(max_density * static_cast<size_t>(nmulti) * _n_blocks * K))
+    {
+        assert(maxthreads > 0);
+        assert(_dense->B_is_pretransposed());
+    }
+
+    // Interface implementation - Compulsory functions
+
+    void set_arrays(const To *A, const int lda, const int A_batch_stride, const int A_multi_stride,
+                    const To *B, const int ldb, const int B_multi_stride,
+                    Tr *C, const int ldc, const int C_batch_stride, const int C_multi_stride) override
+    {
+        GemmCommon<To, Tr>::set_arrays(A, lda, A_batch_stride, A_multi_stride, B, ldb, B_multi_stride, C, ldc, C_batch_stride, C_multi_stride);
+        _dense->set_arrays(A, lda, A_batch_stride, A_multi_stride, B, ldb, B_multi_stride, C, ldc, C_batch_stride, C_multi_stride);
+    }
+
+    void set_output_stage(const Tr *bias, const int bias_multi_stride, const Activation &act) override
+    {
+        GemmCommon<To, Tr>::set_output_stage(bias, bias_multi_stride, act);
+        _dense->set_output_stage(bias, bias_multi_stride, act);
+    }
+
+    // The sparse kernels support neither, so B then always goes to the dense GEMM.
+    bool set_requantize_stage(const Requantize32 &qp) override
+    {
+        _sparse_allowed = false;
+        return _dense->set_requantize_stage(qp);
+    }
+
+    bool set_convolution_parameters(const ConvolutionParameters &params) override
+    {
+        _sparse_allowed = false;
+        return _dense->set_convolution_parameters(params);
+    }
+
+    void set_profiler(ProfileSink *profiler) override
+    {
+        GemmCommon<To, Tr>::set_profiler(profiler);
+        _dense->set_profiler(profiler);
+    }
+
+    unsigned int get_window_size() const override
+    {
+        return _dense->get_window_size();
+    }
+
+    void set_nthreads(int nthreads) override
+    {
+        _dense->set_nthreads(nthreads);
+    }
+
+    // Execute
+    void execute(unsigned int start, unsigned int end, int threadid) override
+    {
+        if(!_is_sparse)
+        {
+            _dense->execute(start, end, threadid);
+            return;
+        }
+
+        profiler prof(this->_profiler);
+
+        strategy strat(_ci);
+
+        assert(_working_space);
+        int8_t *working_space_bytes = reinterpret_cast<int8_t *>(_working_space) + (threadid * get_thread_working_size());
+
+        Tri *const c_panel = reinterpret_cast<Tri *>(working_space_bytes);
+        Toi *const a_panel = reinterpret_cast<Toi *>(working_space_bytes + get_c_working_size());
+
+        // Units of the sparse work matching this part of the window.
+        const uint64_t window_size = _dense->get_window_size();
+        const uint64_t units       = get_sparse_units();
+        uint64_t       unit        = (start * units) / window_size;
+        const uint64_t unit_end    = (end * units) / window_size;
+
+        while(unit < unit_end)
+        {
+            // Column blocks j0 to j1 of a row block of a problem.
+            const unsigned int j0        = unit % _n_blocks;
+            const unsigned int row_block = (unit / _n_blocks) % _row_blocks;
+            const unsigned int problem   = unit / (static_cast<uint64_t>(_n_blocks) * _row_blocks);
+            const unsigned int multi     = problem / _nbatches;
+            const unsigned int batch     = problem - (multi * _nbatches);
+            const unsigned int j1        = static_cast<unsigned int>(std::min<uint64_t>(_n_blocks, j0 + (unit_end - unit)));
+
+            const unsigned int y0   = row_block * strategy::out_height;
+            const unsigned int ymax = std::min(_Msize, y0 + strategy::out_height);
+            const unsigned int x0   = j0 * strategy::out_width;
+            const unsigned int xmax = std::min(_Nsize, j1 * strategy::out_width);
+
+            const To *const       A           = this->_Aptr + (batch * this->_A_batch_stride) + (multi * this->_A_multi_stride);
+            Tr *const             C           = this->_Cptr + (batch * this->_C_batch_stride) + (multi * this->_C_multi_stride);
+            const Tr *const       bias        = (this->_bias != nullptr) ? this->_bias + (multi * this->_bias_multi_stride) : nullptr;
+            const uint32_t *const block_start = _block_start + (multi * _n_blocks) + j0;
+            const uint64_t        macs        = static_cast<uint64_t>(block_start[j1 - j0] - block_start[0]) * strategy::out_width;
+
+            if(ymax - y0 == strategy::out_height)
+            {
+                {
+                    auto p = prof.ScopedProfiler(ProfilePhase::PrepareA, strategy::out_height * _Ksize * sizeof(Toi));
+
+                    Transform<strategy::A_interleave, strategy::A_block, strategy::A_transpose>(a_panel, A, this->_lda, y0, ymax, 0, _Ksize);
+                }
+
+                {
+                    auto p = prof.ScopedProfiler(ProfilePhase::Kernel, macs * strategy::out_height);
+
+                    strat.kernel(a_panel, _values, _k_index, block_start, c_panel, j1 - j0);
+                }
+
+                {
+                    auto p = prof.ScopedProfiler(ProfilePhase::Merge, (ymax - y0) * (xmax - x0) * sizeof(Tr));
+
+                    merge<strategy::out_height>(C, c_panel, y0, ymax, x0, xmax, bias);
+                }
+            }
+            else
+            {
+                /* The last rows aren't worth interleaving: the row kernel reads them in place. */
+                for(unsigned int y = y0; y < ymax; y++)
+                {
+                    {
+                        auto p = prof.ScopedProfiler(ProfilePhase::Kernel, macs);
+
+                        strat.kernel_row(A + (y * this->_lda), _values, _k_index, block_start, c_panel, j1 - j0);
+                    }
+
+                    {
+                        auto p = prof.ScopedProfiler(ProfilePhase::Merge, (xmax - x0) * sizeof(Tr));
+
+                        merge<1>(C, c_panel, y, y + 1, x0, xmax, bias);
+                    }
+                }
+            }
+
+            unit += (j1 - j0);
+        }
+    }
+
+    // Interface implementation - working space
+    size_t get_working_size() const override
+    {
+        // Private buffers for each thread, plus a cache line extra for alignment.
+        return std::max(_dense->get_working_size(), (get_thread_working_size() * _maxthreads) + 64);
+    }
+
+    void set_working_space(void *working_space) override
+    {
+        // Only one of the dense and sparse GEMMs runs, so they share the working space.
+        _dense->set_working_space(working_space);
+
+        // Make sure everything ends up cache line aligned
+        int8_t  *working_space_bytes = reinterpret_cast<int8_t *>(working_space);
+        intptr_t working_space_int   = reinterpret_cast<intptr_t>(working_space);
+
+        if(working_space_int & 0x3F)
+        {
+            working_space_bytes += 0x40 - (working_space_int & 0x3F);
+        }
+
+        _working_space = reinterpret_cast<void *>(working_space_bytes);
+    }
+
+    // Interface implementation - pretransposed
+    bool B_is_pretransposed() const override
+    {
+        return true;
+    }
+
+    bool B_pretranspose_required() const override
+    {
+        return !_B_ready;
+    }
+
+    size_t get_B_pretransposed_array_size() const override
+    {
+        const size_t sparse_size = _sparse_allowed ? get_sparse_size(_max_nnz) : 0;
+
+        return header_size + std::max(_dense->get_B_pretransposed_array_size(), sparse_size);
+    }
+
+    void pretranspose_B_array(void *in_buffer, const To *B, const int ldb, const int B_multi_stride) override
+    {
+        int8_t *buffer = reinterpret_cast<int8_t *>(in_buffer);
+        Header *header = reinterpret_cast<Header *>(buffer);
+        profiler prof(this->_profiler);
+
+        // Nonzero blocks of each column block, and in total.
+        std::vector<uint32_t> block_nnz;
+        size_t                nnz = 0;
+
+        if(_sparse_allowed)
+        {
+            auto p = prof.ScopedProfiler(ProfilePhase::PrepareB, static_cast<size_t>(_nmulti) * _Ksize * _Nsize * sizeof(To));
+
+            block_nnz.resize(static_cast<size_t>(_nmulti) * _n_blocks, 0);
+            for(unsigned int multi = 0; multi < _nmulti; multi++)
+            {
+                for(unsigned int k = 0; k < _Ksize; k++)
+                {
+                    const To *B_row = B + (multi * B_multi_stride) + (k * ldb);
+
+                    for(unsigned int j = 0; j < _n_blocks; j++)
+                    {
+                        if(is_nonzero_block(B_row, j))
+                        {
+                            block_nnz[(multi * _n_blocks) + j]++;
+                            nnz++;
+                        }
+                    }
+                }
+            }
+        }
+
+        if(!_sparse_allowed || nnz > _max_nnz)
+        {
+            header->is_sparse = 0;
+            header->nnz       = 0;
+            _dense->pretranspose_B_array(buffer + header_size, B, ldb, B_multi_stride);
+            set_pretransposed_B_data(in_buffer);
+            return;
+        }
+
+        auto p = prof.ScopedProfiler(ProfilePhase::PrepareB, get_sparse_size(nnz));
+
+        header->is_sparse = 1;
+        header->nnz       = nnz;
+
+        uint32_t *block_start = reinterpret_cast<uint32_t *>(buffer + header_size);
+        uint32_t *k_index     = block_start + (static_cast<size_t>(_nmulti) * _n_blocks) + 1;
+        Toi      *values      = reinterpret_cast<Toi *>(buffer + header_size + get_values_offset(nnz));
+
+        block_start[0] = 0;
+        for(size_t block = 0; block < block_nnz.size(); block++)
+        {
+            block_start[block + 1] = block_start[block] + block_nnz[block];
+        }
+
+        // Fill the column blocks row by row, reusing block_nnz as the cursor of each.
+        std::fill(block_nnz.begin(), block_nnz.end(), 0);
+        for(unsigned int multi = 0; multi < _nmulti; multi++)
+        {
+            for(unsigned int k = 0; k < _Ksize; k++)
+            {
+                const To *B_row = B + (multi * B_multi_stride) + (k * ldb);
+
+                for(unsigned int j = 0; j < _n_blocks; j++)
+                {
+                    if(!is_nonzero_block(B_row, j))
+                    {
+                        continue;
+                    }
+
+                    const size_t       block = (multi * _n_blocks) + j;
+                    const uint32_t     pos   = block_start[block] + block_nnz[block]++;
+                    const unsigned int x0    = j * strategy::out_width;
+
+                    k_index[pos] = k;
+                    for(unsigned int x = 0; x < strategy::out_width; x++)
+                    {
+                        values[(pos * strategy::out_width) + x] = (x0 + x < _Nsize) ? static_cast<Toi>(B_row[x0 + x]) : static_cast<Toi>(0);
+                    }
+                }
+            }
+        }
+
+        set_pretransposed_B_data(in_buffer);
+    }
+
+    void set_pretransposed_B_data(void *in_buffer) override
+    {
+        int8_t       *buffer = reinterpret_cast<int8_t *>(in_buffer);
+        const Header *header = reinterpret_cast<const Header *>(buffer);
+
+        _is_sparse = (header->is_sparse != 0);
+        if(_is_sparse)
+        {
+            _block_start = reinterpret_cast<const uint32_t *>(buffer + header_size);
+            _k_index     = _block_start + (static_cast<size_t>(_nmulti) * _n_blocks) + 1;
+            _values      = reinterpret_cast<const Toi *>(buffer + header_size + get_values_offset(header->nnz));
+        }
+        else
+        {
+            _dense->set_pretransposed_B_data(buffer + header_size);
+        }
+
+        _B_ready = true;
+    }
+};
+
+} // namespace arm_gemm
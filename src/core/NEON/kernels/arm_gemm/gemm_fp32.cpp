@@ -23,13 +23,16 @@
  */
 #include "arm_gemm.hpp"
 #include "gemm_batched.hpp"
+#include "gemm_block_sparse.hpp"
 #include "gemm_common.hpp"
 #include "gemm_interleaved.hpp"
+#include "gemm_interleaved_batched.hpp"
 #include "gemm_native.hpp"
 #include "gemv_native_transposed.hpp"
 #include "gemv_pretransposed.hpp"
 
 #include "kernels/a32_sgemm_8x6.hpp"
+#include "kernels/a64_sgemm_bsr_8x4.hpp"
 #include "kernels/a64_sgemm_12x8.hpp"
 #include "kernels/a64_sgemm_native_16x4.hpp"
 #include "kernels/a64_sgemv_pretransposed.hpp"
@@ -37,27 +40,24 @@
 
 namespace arm_gemm
 {
-template <>
-UniqueGemmCommon<float, float> gemm<float, float>(const CPUInfo &ci, const unsigned int M, const unsigned int N, const unsigned int K,
-                                                  const unsigned int nbatches, const unsigned int nmulti,
-                                                  const bool trA, const bool trB, const float alpha, const float beta,
-                                                  const int maxthreads, const bool pretransposed_hint)
+namespace
+{
+/* Dense implementations. */
+UniqueGemmCommon<float, float> gemm_dense(const CPUInfo &ci, const unsigned int M, const unsigned int N, const unsigned int K,
+                                          const unsigned int nbatches, const unsigned int nmulti,
+                                          const bool trA, const bool trB, const float alpha, const float beta,
+                                          const int maxthreads, const bool pretransposed_hint, const GemmMethod method, const GemmConfig *cfg)
 {
-    /* Handle "batched GEMM" */
-    if(M == 1 && nbatches > 1)
-    {
-        return UniqueGemmCommon<float, float>(new GemmBatched<float, float>(ci, M, N, K, nbatches, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint));
-    }
 #ifdef __aarch64__
     /* Cases in priority order */
     /* GemvPretransposed: requires M=1, alpha=1, and transposed hint set.  nbatches must be 1 or we would have returned above so don't test. */
-    if(M == 1 && alpha == 1.0f && pretransposed_hint)
+    if((method == GemmMethod::DEFAULT || method == GemmMethod::GEMV_PRETRANSPOSED) && M == 1 && alpha == 1.0f && pretransposed_hint)
     {
         return UniqueGemmCommon<float, float>(new GemvPretransposed<sgemv_pretransposed, float, float>(&ci, N, K, nmulti, trB, beta));
     }
 
     /* GemvNativeTransposed: requires M=1, no trA or trB, doesn't handle alpha */
-    if(M == 1 && alpha == 1.0f && !trA && !trB)
+    if((method == GemmMethod::DEFAULT || method == GemmMethod::GEMV_NATIVE_TRANSPOSED) && M == 1 && alpha == 1.0f && !trA && !trB)
     {
         return UniqueGemmCommon<float, float>(new GemvNativeTransposed<sgemv_trans, float, float>(&ci, N, K, nmulti, beta));
     }
@@ -65,16 +65,62 @@ UniqueGemmCommon<float, float> gemm<float, float>(const CPUInfo &ci, const unsig
     /* Native GEMM: requires M to be a multiple of 4, K at least 4, N a
      * multiple of 16, doesn't handle alpha and only makes sense for small
      * sizes.  */
-    if(N <= 128 && K <= 128 && ((M % 4) == 0) && (K >= 4) && ((N % 16) == 0) && alpha == 1.0f)
+    if(((method == GemmMethod::DEFAULT && N <= 128 && K <= 128) || method == GemmMethod::GEMM_NATIVE) && ((M % 4) == 0) && (K >= 4) && ((N % 16) == 0) && alpha == 1.0f)
     {
         return UniqueGemmCommon<float, float>(new GemmNative<sgemm_native_16x4, float, float>(&ci, M, N, K, nbatches, nmulti, beta));
     }
 
+    /* Batched GEMM: many small problems (e.g. the tile GEMMs of Winograd), each run whole by a thread. */
+    if(((method == GemmMethod::DEFAULT && GemmInterleavedBatched<sgemm_12x8, float, float>::is_suitable(ci, M, N, K, nbatches, nmulti, maxthreads)) || method == GemmMethod::GEMM_INTERLEAVED_BATCHED)
+       && (nbatches * nmulti) > 1)
+    {
+        return UniqueGemmCommon<float, float>(new GemmInterleavedBatched<sgemm_12x8, float, float>(&ci, M, N, K, nbatches, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint));
+    }
+
     /* Blocked GEMM, handles all cases. */
-    return UniqueGemmCommon<float, float>(new GemmInterleaved<sgemm_12x8, float, float>(&ci, M, N, K, nbatches, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint));
+    return UniqueGemmCommon<float, float>(new GemmInterleaved<sgemm_12x8, float, float>(&ci, M, N, K, nbatches, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint, cfg));
 #else
-    return UniqueGemmCommon<float, float>(new GemmInterleaved<sgemm_8x6, float, float>(&ci, M, N, K, nbatches, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint));
+    if(((method == GemmMethod::DEFAULT && GemmInterleavedBatched<sgemm_8x6, float, float>::is_suitable(ci, M, N, K, nbatches, nmulti, maxthreads)) || method == GemmMethod::GEMM_INTERLEAVED_BATCHED)
+       && (nbatches * nmulti) > 1)
+    {
+        return UniqueGemmCommon<float, float>(new GemmInterleavedBatched<sgemm_8x6, float, float>(&ci, M, N, K, nbatches, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint));
+    }
+
+    return UniqueGemmCommon<float, float>(new GemmInterleaved<sgemm_8x6, float, float>(&ci, M, N, K, nbatches, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint, cfg));
+#endif
+}
+} // namespace
+
+template <>
+UniqueGemmCommon<float, float> gemm<float, float>(const CPUInfo &ci, const unsigned int M, const unsigned int N, const unsigned int K,
+                                                  const unsigned int nbatches, const unsigned int nmulti,
+                                                  const bool trA, const bool trB, const float alpha, const float beta,
+                                                  const int maxthreads, const bool pretransposed_hint, const GemmConfig *cfg)
+{
+    /* Handle "batched GEMM" */
+    if(M == 1 && nbatches > 1)
+    {
+        return UniqueGemmCommon<float, float>(new GemmBatched<float, float>(ci, M, N, K, nbatches, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint, cfg));
+    }
+
+    /* A method requested through the config is only used if it applies; otherwise fall back to the blocked GEMM. */
+    const GemmMethod method = (cfg != nullptr) ? cfg->method : GemmMethod::DEFAULT;
+
+    UniqueGemmCommon<float, float> dense = gemm_dense(ci, M, N, K, nbatches, nmulti, trA, trB, alpha, beta, maxthreads, pretransposed_hint, method, cfg);
+
+#ifdef __aarch64__
+    /* Block sparse B: whether B is sparse is only known once it is pretransposed, so any GEMM pretransposing B is wrapped and
+     * only replaced if at most half of the 1x4 blocks of B are nonzero (or always, if requested).  Below that density the
+     * sparse kernels do less work than the dense ones, whichever the dense GEMM is.  */
+    if(dense->B_is_pretransposed() && !trA && !trB)
+    {
+        const float max_density = (method == GemmMethod::GEMM_BLOCK_SPARSE) ? 1.0f : 0.5f;
+
+        return UniqueGemmCommon<float, float>(new GemmBlockSparse<sgemm_bsr_8x4, float, float>(&ci, M, N, K, nbatches, nmulti, alpha, beta, maxthreads, max_density, std::move(dense)));
+    }
 #endif
+
+    return dense;
 }
 
 // Instantiate static class variables.
@@ -84,6 +130,9 @@ const int sgemm_12x8::out_height;
 
 const int sgemm_native_16x4::out_width;
 const int sgemm_native_16x4::out_height;
+
+const int sgemm_bsr_8x4::out_width;
+const int sgemm_bsr_8x4::out_height;
 #else
 const int sgemm_8x6::out_width;
 const int sgemm_8x6::out_height;
@@ -32,12 +32,11 @@
 #include "utils.hpp"
 
 #include "buffer_manager.hpp"
+#include "convolver.hpp"
 #include "mergeresults.hpp"
 #include "transform.hpp"
 
-#ifdef CYCLE_PROFILING
 #include "profiler.hpp"
-#endif
 
 // Some macros used to decide how much working space to allocate.
 // Round allocations up to the next cache line.
@@ -80,11 +79,27 @@ class GemmInterleaved : public GemmCommon<To, Tr>
     unsigned int _x_block = 0;
     unsigned int _Mround  = 0;
 
+    /* Requested N block size, 0 for the cache based default */
+    unsigned int _outer_block_size = 0;
+
+    /* N partitioning: when there are too few rows to keep every thread busy,
+     * the columns are also split into _n_splits ranges of _x_split columns. */
+    unsigned int _n_splits = 1;
+    unsigned int _x_split  = 0;
+
     /* Working space, pretransposed buffer, buffer manager */
     const Toi     *_B_transposed  = nullptr;
     BufferManager *_bm            = nullptr;
     void          *_working_space = nullptr;
 
+    /* Requantizing output stage */
+    bool         _requantize = false;
+    Requantize32 _qp{};
+
+    /* Convolution gathering the rows of A */
+    bool                  _convolution = false;
+    ConvolutionParameters _conv{};
+
     /* We will need to walk through the blocks of B in a few contexts, so
      * factor that out.  */
     class blockwalker
@@ -175,13 +190,14 @@ class GemmInterleaved : public GemmCommon<To, Tr>
         }
     };
 
-    // A working size: One of these needed, regardless of thread count.  Divided according to window.
+    // A working size: One of these needed per N range, regardless of thread count.  Divided according to window.
     size_t get_a_working_size() const
     {
         return ROUND_UP(sizeof(Toi) * _k_block * _Mround * _nbatches);
     }
 
-    // B working size: 0, 1 or 3 of these needed depending on pretransposed and threading settings.
+    // B working size: 0, 1 or 3 of these needed depending on pretransposed and threading settings,
+    // or one per thread when N is partitioned without pretransposed B.
     size_t get_b_working_size() const
     {
         return ROUND_UP(sizeof(Toi) * _x_block * _k_block);
@@ -193,14 +209,67 @@ class GemmInterleaved : public GemmCommon<To, Tr>
         return ROUND_UP(sizeof(Tri) * _x_block * strategy::out_height);
     }
 
+    // Convolution rows working size: One needed per thread, to gather a block of rows before interleaving them.
+    size_t get_conv_working_size() const
+    {
+        return ROUND_UP(sizeof(To) * _k_block * strategy::A_interleave);
+    }
+
+    // Work out the N block size for the current K block size.
+    void compute_x_block()
+    {
+        const unsigned int L2_size = _ci->get_L2_cache_size();
+
+        // x_block: Work out how many rows (of length k_block) will fit in the L2
+        // Don't allocate more than 90% of the L2 to allow for overheads, and subtract off the L1 contents.
+        _x_block = (((L2_size * 9) / 10) - (_k_block * sizeof(Toi) * (strategy::out_width + strategy::out_height))) / (sizeof(Toi) * _k_block);
+
+        // Unless a block size was explicitly requested.
+        if(_outer_block_size)
+        {
+            _x_block = std::min(_outer_block_size, _Nsize);
+        }
+
+        // Needs to be (at least a single) multiple of the kernel output width.
+        _x_block /= strategy::out_width;
+        _x_block = std::max(_x_block, 1U) * strategy::out_width;
+
+        // And tune to the presented problem size.
+        int num_x_blocks = iceildiv(_Nsize, _x_block);
+        _x_block         = iceildiv(_Nsize, num_x_blocks);
+
+        _x_block = iceildiv(_x_block, strategy::out_width);
+        _x_block *= strategy::out_width;
+    }
+
+    // Offset of the convolution rows buffers, after the other private buffers.
+    size_t get_conv_working_offset() const
+    {
+        size_t offset = (_maxthreads * get_c_working_size()) + (_n_splits * get_a_working_size());
+
+        if(!_pretransposed && !uses_buffer_manager())
+        {
+            offset += _maxthreads * get_b_working_size();
+        }
+
+        return offset;
+    }
+
+    // Whether the buffer manager is used to share B panels between threads.
+    // When N is partitioned the threads no longer walk the same blocks, so
+    // each one transforms its own part of B instead.
+    bool uses_buffer_manager() const
+    {
+        return !_pretransposed && _n_splits == 1;
+    }
+
     // Internal execute function.
     // This supports both the "pretransposed" and "standard" interfaces via the template parameter.
+    // 'start' and 'end' are positions within the M window of N range 'part'.
     template <bool pretransposed>
-    void execute_internal(unsigned int start, unsigned int end, int threadid)
+    void execute_internal(unsigned int start, unsigned int end, int threadid, unsigned int part)
     {
-#ifdef CYCLE_PROFILING
-        profiler prof;
-#endif
+        profiler prof(this->_profiler);
 
         strategy strat(_ci);
 
@@ -216,12 +285,19 @@ class GemmInterleaved : public GemmCommon<To, Tr>
         unsigned int m_0   = (start - (batch_0 * window_per_batch)) * strategy::out_height;
         unsigned int m_max = (end - (batch_end * window_per_batch)) * strategy::out_height;
 
+        /* Columns to operate on. */
+        const unsigned int x_start = part * _x_split;
+        const unsigned int x_end   = std::min(x_start + _x_split, _Nsize);
+
+        const bool has_output_stage = (this->_bias != nullptr) || (this->_act.type != Activation::Type::None);
+        const bool use_bm           = !pretransposed && (_n_splits == 1);
+
         /* Make sure we've been set up correctly. */
         if(pretransposed)
         {
             assert(_B_transposed);
         }
-        else
+        else if(use_bm)
         {
             assert(_bm);
         }
@@ -229,9 +305,10 @@ class GemmInterleaved : public GemmCommon<To, Tr>
         assert(_working_space);
         int8_t *working_space_bytes = reinterpret_cast<int8_t *>(_working_space);
 
-        // Private buffers.  Treat working_space as an array of C buffers (one per thread) first, followed by the (window-divided) A buffer.
-        // Set a_panel to the base of the A buffers - compute offsets into it based on M/batches later.
-        Toi *const a_panel = reinterpret_cast<Toi *>(working_space_bytes + (_maxthreads * get_c_working_size()));
+        // Private buffers.  Treat working_space as an array of C buffers (one per thread) first, followed by the (window-divided) A buffers
+        // (one per N range), if B is neither pretransposed nor shared a B buffer per thread and, for convolutions, a rows buffer per thread.
+        // Set a_panel to the base of this range's A buffer - compute offsets into it based on M/batches later.
+        Toi *const a_panel = reinterpret_cast<Toi *>(working_space_bytes + (_maxthreads * get_c_working_size()) + (part * get_a_working_size()));
         Tri *const c_panel = reinterpret_cast<Tri *>(working_space_bytes + (threadid * get_c_working_size()));
 
         // Shared buffers - these come either from BufferManager or _B_transposed.
@@ -251,9 +328,7 @@ class GemmInterleaved : public GemmCommon<To, Tr>
         {
             if(current.newkblock())
             {
-#ifdef CYCLE_PROFILING
-                auto p = prof.ScopedProfiler(PROFILE_PREPA, (end - start) * strategy::out_height * (current.kmax() - current.k0()) * sizeof(Toi));
-#endif
+                auto p = prof.ScopedProfiler(ProfilePhase::PrepareA, (end - start) * strategy::out_height * (current.kmax() - current.k0()) * sizeof(Toi));
                 for(unsigned int batch = batch_0; batch <= batch_end; batch++)
                 {
                     unsigned int first_m = (batch == batch_0) ? m_0 : 0;
@@ -261,7 +336,28 @@ class GemmInterleaved : public GemmCommon<To, Tr>
 
                     if(first_m >= last_m)
                         continue;
-                    if(_trA ^ strategy::A_transpose)
+                    if(_convolution)
+                    {
+                        // Gather and interleave a block of rows at a time, the kernel expects them
+                        // A_interleave rows of the rounded up K block apart.
+                        To *const          conv_rows = reinterpret_cast<To *>(working_space_bytes + get_conv_working_offset() + (threadid * get_conv_working_size()));
+                        const unsigned int k_size    = current.kmax() - current.k0();
+                        const unsigned int k_round   = iceildiv(k_size, strategy::A_block) * strategy::A_block;
+                        const convolver<To> conv(_conv);
+
+                        Toi *a_out = a_panel + ((batch * _Mround + first_m) * _k_block);
+
+                        for(unsigned int m = first_m; m < last_m; m += strategy::A_interleave)
+                        {
+                            const unsigned int m_end = std::min(m + strategy::A_interleave, last_m);
+
+                            conv.get_rows(conv_rows, k_size, this->_Aptr + (batch * this->_A_batch_stride), m, m_end, current.k0(), current.kmax());
+                            Transform<strategy::A_interleave, strategy::A_block, false>(a_out, conv_rows, k_size, 0, m_end - m, 0, k_size);
+
+                            a_out += strategy::A_interleave * k_round;
+                        }
+                    }
+                    else if(_trA ^ strategy::A_transpose)
                     {
                         Transform<strategy::A_interleave, strategy::A_block, true>(
                             a_panel + ((batch * _Mround + first_m) * _k_block),
@@ -284,7 +380,50 @@ class GemmInterleaved : public GemmCommon<To, Tr>
 
             int bblocks = iceildiv(current.xmax() - current.x0(), strategy::out_width);
 
-            if(!pretransposed)
+            /* Part of this block within our N range - both ends are multiples of out_width from x0. */
+            const unsigned int x0   = std::max(current.x0(), x_start);
+            const unsigned int xmax = std::min(current.xmax(), x_end);
+
+            if(x0 >= xmax)
+            {
+                if(pretransposed)
+                {
+                    b_panel += (bblocks * strat.out_width * kern_k);
+                }
+                continue;
+            }
+
+            const int x_offset = (x0 - current.x0()) / strategy::out_width;
+            const int x_blocks = iceildiv(xmax - x0, strategy::out_width);
+
+            const Toi *b_ptr;
+
+            if(pretransposed)
+            {
+                b_ptr = b_panel + (x_offset * strat.out_width * kern_k);
+            }
+            else if(!use_bm)
+            {
+                Toi *const b_local = reinterpret_cast<Toi *>(working_space_bytes + (_maxthreads * get_c_working_size()) + (_n_splits * get_a_working_size()) + (threadid * get_b_working_size()));
+
+                auto p = prof.ScopedProfiler(ProfilePhase::PrepareB, (xmax - x0) * (current.kmax() - current.k0()) * sizeof(Toi));
+
+                if(_trB ^ strategy::B_transpose)
+                {
+                    Transform<strategy::B_interleave, strategy::B_block, true>(
+                        b_local, this->_Bptr + (current.multi() * this->_B_multi_stride), this->_ldb,
+                        x0, xmax, current.k0(), current.kmax());
+                }
+                else
+                {
+                    Transform<strategy::B_interleave, strategy::B_block, false>(
+                        b_local, this->_Bptr + (current.multi() * this->_B_multi_stride), this->_ldb,
+                        x0, xmax, current.k0(), current.kmax());
+                }
+
+                b_ptr = b_local;
+            }
+            else
             {
                 /* Look ahead to the next block and populate it if necessary.
                  * This avoids the populate operation becoming a bottleneck, and
@@ -298,9 +437,7 @@ class GemmInterleaved : public GemmCommon<To, Tr>
                 {
                     _bm->try_populate(next.index(), [&](void *buffer)
                     {
-#ifdef CYCLE_PROFILING
-                        auto p = prof.ScopedProfiler(PROFILE_PREPB, (next.xmax() - next.x0()) * (next.kmax() - next.k0()) * sizeof(Toi));
-#endif
+                        auto p = prof.ScopedProfiler(ProfilePhase::PrepareB, (next.xmax() - next.x0()) * (next.kmax() - next.k0()) * sizeof(Toi));
 
                         Toi *b_panel = reinterpret_cast<Toi *>(buffer);
                         if(_trB ^ strategy::B_transpose)
@@ -320,9 +457,7 @@ class GemmInterleaved : public GemmCommon<To, Tr>
                 /* Get the buffer for this iteration from the BufferManager. */
                 b_panel = reinterpret_cast<Toi *>(_bm->get(current.index(), [&](void *bpv)
                 {
-#ifdef CYCLE_PROFILING
-                    auto p = prof.ScopedProfiler(PROFILE_PREPB, (current.xmax() - current.x0()) * (current.kmax() - current.k0()) * sizeof(Toi));
-#endif
+                    auto p = prof.ScopedProfiler(ProfilePhase::PrepareB, (current.xmax() - current.x0()) * (current.kmax() - current.k0()) * sizeof(Toi));
 
                     Toi *b_panel = reinterpret_cast<Toi *>(bpv);
                     if(_trB ^ strategy::B_transpose)
@@ -339,6 +474,8 @@ class GemmInterleaved : public GemmCommon<To, Tr>
                     }
 
                 }));
+
+                b_ptr = b_panel;
             }
 
             /* Do the actual work. */
@@ -357,23 +494,38 @@ class GemmInterleaved : public GemmCommon<To, Tr>
                     unsigned int ymax = std::min(_Msize, y + strategy::out_height);
 
                     {
-#ifdef CYCLE_PROFILING
-                        auto p = prof.ScopedProfiler(PROFILE_KERNEL, (strategy::out_height * bblocks * strategy::out_width * kern_k));
-#endif
+                        auto p = prof.ScopedProfiler(ProfilePhase::Kernel, (strategy::out_height * x_blocks * strategy::out_width * kern_k));
 
-                        strat.kernel(a_ptr, b_panel, c_panel, 1, bblocks, kern_k);
+                        strat.kernel(a_ptr, b_ptr, c_panel, 1, x_blocks, kern_k);
 
                         a_ptr += (strategy::out_height * kern_k);
                     }
 
                     {
-#ifdef CYCLE_PROFILING
-                        auto p = prof.ScopedProfiler(PROFILE_MERGE, (strategy::out_height * bblocks * strategy::out_width * sizeof(Tr)));
-#endif
-                        MergeResults<strategy::out_width, strategy::out_height>(
-                            this->_Cptr + (batch * this->_C_batch_stride) + (current.multi() * this->_C_multi_stride),
-                            c_panel, this->_ldc, y, ymax, current.x0(), current.xmax(),
-                            _alpha, (current.k0() == 0 ? _beta : static_cast<Tr>(1)));
+                        auto p = prof.ScopedProfiler(ProfilePhase::Merge, (strategy::out_height * x_blocks * strategy::out_width * sizeof(Tr)));
+                        /* The output stage is applied once the last K block has been accumulated. */
+                        if(_requantize)
+                        {
+                            MergeRequantize<strategy::out_width, strategy::out_height>(
+                                _qp.output + (batch * _qp.output_batch_stride), c_panel, _qp.ldo, y, ymax, x0, xmax, _qp,
+                                (_qp.b_offset != 0) ? _qp.row_sums + (batch * _qp.row_sums_batch_stride) : nullptr,
+                                _qp.a_offset * _qp.b_offset * static_cast<int32_t>(_Ksize));
+                        }
+                        else if(has_output_stage && current.kmax() >= _Ksize)
+                        {
+                            MergeResults<strategy::out_width, strategy::out_height>(
+                                this->_Cptr + (batch * this->_C_batch_stride) + (current.multi() * this->_C_multi_stride),
+                                c_panel, this->_ldc, y, ymax, x0, xmax,
+                                _alpha, (current.k0() == 0 ? _beta : static_cast<Tr>(1)),
+                                (this->_bias != nullptr) ? this->_bias + (current.multi() * this->_bias_multi_stride) : nullptr, this->_act);
+                        }
+                        else
+                        {
+                            MergeResults<strategy::out_width, strategy::out_height>(
+                                this->_Cptr + (batch * this->_C_batch_stride) + (current.multi() * this->_C_multi_stride),
+                                c_panel, this->_ldc, y, ymax, x0, xmax,
+                                _alpha, (current.k0() == 0 ? _beta : static_cast<Tr>(1)));
+                        }
                     }
                 }
             }
@@ -382,7 +534,7 @@ class GemmInterleaved : public GemmCommon<To, Tr>
             {
                 b_panel += (bblocks * strat.out_width * kern_k);
             }
-            else
+            else if(use_bm)
             {
                 _bm->release(current.index());
             }
@@ -396,11 +548,10 @@ public:
     /* Constructor */
     GemmInterleaved(const CPUInfo *ci, const unsigned int M, const unsigned int N, const unsigned int K,
                     const unsigned int nbatches, const unsigned int nmulti, const bool trA, const bool trB,
-                    const Tr alpha, const Tr beta, const int maxthreads, const bool pretransposed)
+                    const Tr alpha, const Tr beta, const int maxthreads, const bool pretransposed, const GemmConfig *cfg = nullptr)
         : _ci(ci), _Msize(M), _Nsize(N), _Ksize(K), _nbatches(nbatches), _nmulti(nmulti), _trA(trA), _trB(trB), _alpha(alpha), _beta(beta), _maxthreads(maxthreads), _pretransposed(pretransposed)
     {
         const unsigned int L1_size = ci->get_L1_cache_size();
-        const unsigned int L2_size = ci->get_L2_cache_size();
 
         assert(maxthreads > 0);
 
@@ -410,6 +561,12 @@ public:
         // This should account for associative caches.
         _k_block = (L1_size / 2) / (sizeof(Toi) * (std::max(strategy::out_width, strategy::out_height)));
 
+        // Unless a block size was explicitly requested.
+        if(cfg && cfg->inner_block_size)
+        {
+            _k_block = std::min(cfg->inner_block_size, K);
+        }
+
         // Needs to be (at least a single) multiple of the K unroll level.
         _k_block /= strategy::k_unroll;
         _k_block = std::max(_k_block, 1U) * strategy::k_unroll;
@@ -424,24 +581,31 @@ public:
         _k_block = iceildiv(_k_block, strategy::k_unroll);
         _k_block *= strategy::k_unroll;
 
-        // x_block: Work out how many rows (of length k_block) will fit in the L2
-        // Don't allocate more than 90% of the L2 to allow for overheads, and subtract off the L1 contents.
-        _x_block = (((L2_size * 9) / 10) - (_k_block * sizeof(Toi) * (strategy::out_width + strategy::out_height))) / (sizeof(Toi) * _k_block);
-
-        // Needs to be (at least a single) multiple of the kernel output width.
-        _x_block /= strategy::out_width;
-        _x_block = std::max(_x_block, 1U) * strategy::out_width;
-
-        // And tune to the presented problem size.
-        int num_x_blocks = iceildiv(N, _x_block);
-        _x_block         = iceildiv(N, num_x_blocks);
+        if(cfg)
+        {
+            _outer_block_size = cfg->outer_block_size;
+        }
 
-        _x_block = iceildiv(_x_block, strategy::out_width);
-        _x_block *= strategy::out_width;
+        compute_x_block();
 
         // Work out the rounded size of M - needed for some buffers.
         _Mround = iceildiv(M, strategy::out_height);
         _Mround *= strategy::out_height;
+
+        // If there are fewer row blocks than threads (e.g. fully connected
+        // layers with a small batch), split N as well so that every thread
+        // gets some work.  Ranges are whole multiples of out_width.
+        const unsigned int m_window = (_Mround / strategy::out_height) * _nbatches;
+
+        if(m_window < static_cast<unsigned int>(maxthreads))
+        {
+            const unsigned int n_units = iceildiv(N, strategy::out_width);
+
+            _n_splits = std::min(static_cast<unsigned int>(iceildiv(maxthreads, m_window)), n_units);
+        }
+
+        _x_split  = iceildiv(iceildiv(N, strategy::out_width), _n_splits) * strategy::out_width;
+        _n_splits = iceildiv(N, _x_split);
     }
 
     // Interface implementation - Compulsory functions
@@ -449,12 +613,50 @@ public:
     // Window size: Only the last thread should do a ragged block, so dole
     // out work in units of out_height.  Factor batches into the window, but
     // not multi for now (as this would cause problems with the buffer
-    // manager).
+    // manager).  If N is partitioned, the window is repeated once per N
+    // range, so contiguous chunks of it mostly stay within one range.
 
     unsigned int get_window_size() const override
     {
         // _Mround is a multiple of out_height by definition.
-        return (_Mround / strategy::out_height) * _nbatches;
+        return (_Mround / strategy::out_height) * _nbatches * _n_splits;
+    }
+
+    // Requantization needs the complete results, so K is no longer blocked.
+    bool set_requantize_stage(const Requantize32 &qp) override
+    {
+        if(_nmulti > 1)
+        {
+            return false;
+        }
+
+        if(!_requantize)
+        {
+            _requantize = true;
+
+            _k_block = iceildiv(_Ksize, strategy::k_unroll) * strategy::k_unroll;
+            compute_x_block();
+        }
+
+        _qp = qp;
+
+        return true;
+    }
+
+    // Rows of A are gathered one interleaved block at a time, so this doesn't
+    // change the blocking.
+    bool set_convolution_parameters(const ConvolutionParameters &params) override
+    {
+        if(_trA || _nmulti > 1 || params.output_width <= 0 || (_Msize % params.output_width) != 0
+           || _Ksize != static_cast<unsigned int>(params.kernel_width * params.kernel_height * params.input_channels))
+        {
+            return false;
+        }
+
+        _convolution = true;
+        _conv        = params;
+
+        return true;
     }
 
     // set_nthreads: pass on to buffer manager to avoid it waiting for non-existant threads.
@@ -469,28 +671,46 @@ public:
     // Execute
     void execute(unsigned int start, unsigned int end, int threadid) override
     {
-        if(_pretransposed)
-        {
-            execute_internal<true>(start, end, threadid);
-        }
-        else
+        const unsigned int m_window = (_Mround / strategy::out_height) * _nbatches;
+
+        // Run the part of the window that falls in each N range in turn.
+        for(unsigned int part = start / m_window; part < _n_splits && part * m_window < end; part++)
         {
-            execute_internal<false>(start, end, threadid);
+            const unsigned int part_start = std::max(start, part * m_window) - (part * m_window);
+            const unsigned int part_end   = std::min(end, (part + 1) * m_window) - (part * m_window);
+
+            if(_pretransposed)
+            {
+                execute_internal<true>(part_start, part_end, threadid, part);
+            }
+            else
+            {
+                execute_internal<false>(part_start, part_end, threadid, part);
+            }
         }
     }
 
     // Interface implementation - working space
     size_t get_working_size() const override
     {
-        // In all cases, we need one A buffer plus a C buffer per thread.
-        size_t size = get_a_working_size() + (get_c_working_size() * _maxthreads);
+        // In all cases, we need one A buffer per N range plus a C buffer per thread.
+        size_t size = (get_a_working_size() * _n_splits) + (get_c_working_size() * _maxthreads);
 
         // For pretransposed case, there is no working space needed for B.
-        // Otherwise, we need a BufferManager.
-        if(!_pretransposed)
+        // Otherwise, we need a BufferManager, or a B buffer per thread if N is partitioned.
+        if(uses_buffer_manager())
         {
             size += BufferManager::get_storage_requirement(_maxthreads, get_b_working_size());
         }
+        else if(!_pretransposed)
+        {
+            size += get_b_working_size() * _maxthreads;
+        }
+
+        if(_convolution)
+        {
+            size += get_conv_working_size() * _maxthreads;
+        }
 
         size += 64; // Add on a cache line extra for alignment.
 
@@ -512,9 +732,9 @@ public:
 
         working_space_bytes += diff;
 
-        if(_pretransposed)
+        if(!uses_buffer_manager())
         {
-            // Pretransposed case: just set internal pointer to parameter value.
+            // Pretransposed or partitioned case: just set internal pointer to parameter value.
             _working_space = reinterpret_cast<void *>(working_space_bytes);
         }
         else
@@ -572,6 +792,7 @@ public:
         blockwalker current(*this);
         Toi        *buffer = reinterpret_cast<Toi *>(in_buffer);
         _B_transposed      = buffer;
+        profiler prof(this->_profiler);
 
         do
         {
@@ -586,6 +807,8 @@ public:
             k_size = iceildiv(k_size, strategy::k_unroll);
             k_size *= strategy::k_unroll;
 
+            auto p = prof.ScopedProfiler(ProfilePhase::PrepareB, x_size * k_size * sizeof(Toi));
+
             if(_trB ^ strategy::B_transpose)
             {
                 Transform<strategy::B_interleave, strategy::B_block, true>(
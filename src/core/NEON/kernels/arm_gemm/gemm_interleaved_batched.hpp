@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <assert.h>
+
+#include <algorithm>
+
+#include "arm_gemm.hpp"
+#include "utils.hpp"
+
+#include "mergeresults.hpp"
+#include "transform.hpp"
+
+#include "profiler.hpp"
+
+// Some macros used to decide how much working space to allocate.
+// Round allocations up to the next cache line.
+#define ALLOC_ROUND 64
+#define ROUND_UP(x) ((((x) + ALLOC_ROUND - 1) / ALLOC_ROUND) * ALLOC_ROUND)
+
+// Implementation of the GemmCommon abstract class.
+//
+// This implementation runs many small independent GEMMs (the batches and
+// multis) by handing whole problems to the threads, rather than splitting
+// every problem between them: each thread interleaves the A and B of its
+// problems into private buffers without any synchronization.  The batches
+// of a multi share B and are contiguous in the window, so a thread only
+// interleaves B again when it moves on to another multi.  Neither K nor N
+// is blocked, so this is meant for problems whose interleaved A and B fit
+// in the cache.
+namespace arm_gemm
+{
+template <typename strategy, typename To, typename Tr>
+class GemmInterleavedBatched : public GemmCommon<To, Tr>
+{
+    typedef typename strategy::operand_type Toi;
+    typedef typename strategy::result_type  Tri;
+
+    /* const properties set by constructor */
+    const CPUInfo *const _ci;
+
+    const unsigned int _Msize;
+    const unsigned int _Nsize;
+    const unsigned int _Ksize;
+
+    const unsigned int _nbatches;
+    const unsigned int _nmulti;
+
+    const bool _trA;
+    const bool _trB;
+
+    const Tr _alpha;
+    const Tr _beta;
+
+    const unsigned int _maxthreads;
+    const bool         _pretransposed;
+
+    /* Sizes rounded up to the blocks the kernel processes */
+    const unsigned int _Mround;
+    const unsigned int _Nround;
+    const unsigned int _Kround;
+
+    /* Working space, pretransposed buffer */
+    const Toi *_B_transposed  = nullptr;
+    void      *_working_space = nullptr;
+
+    // Elements of the interleaved B of one multi.
+    size_t get_b_size() const
+    {
+        return static_cast<size_t>(_Nround) * _Kround;
+    }
+
+    // Per thread buffers: the results of a row block, the interleaved A of a
+    // problem and, unless B is pretransposed, the interleaved B of a multi.
+    size_t get_c_working_size() const
+    {
+        return ROUND_UP(sizeof(Tri) * _Nround * strategy::out_height);
+    }
+
+    size_t get_a_working_size() const
+    {
+        return ROUND_UP(sizeof(Toi) * _Mround * _Kround);
+    }
+
+    size_t get_b_working_size() const
+    {
+        return _pretransposed ? 0 : ROUND_UP(sizeof(Toi) * get_b_size());
+    }
+
+    size_t get_thread_working_size() const
+    {
+        return get_c_working_size() + get_a_working_size() + get_b_working_size();
+    }
+
+    void interleave_B(Toi *b_panel, const To *B, const int ldb) const
+    {
+        if(_trB ^ strategy::B_transpose)
+        {
+            Transform<strategy::B_interleave, strategy::B_block, true>(b_panel, B, ldb, 0, _Nsize, 0, _Ksize);
+        }
+        else
+        {
+            Transform<strategy::B_interleave, strategy::B_block, false>(b_panel, B, ldb, 0, _Nsize, 0, _Ksize);
+        }
+    }
+
+public:
+    GemmInterleavedBatched(GemmInterleavedBatched &) = delete;
+    GemmInterleavedBatched &operator=(GemmInterleavedBatched &) = delete;
+
+    /* Constructor */
+    GemmInterleavedBatched(const CPUInfo *ci, const unsigned int M, const unsigned int N, const unsigned int K,
+                           const unsigned int nbatches, const unsigned int nmulti, const bool trA, const bool trB,
+                           const Tr alpha, const Tr beta, const int maxthreads, const bool pretransposed)
+        : _ci(ci), _Msize(M), _Nsize(N), _Ksize(K), _nbatches(nbatches), _nmulti(nmulti), _trA(trA), _trB(trB), _alpha(alpha), _beta(beta), _maxthreads(maxthreads),
+          _pretransposed(pretransposed), _Mround(roundup(M, static_cast<unsigned int>(strategy::out_height))), _Nround(roundup(N, static_cast<unsigned int>(strategy::out_width))),
+          _Kround(roundup(K, static_cast<unsigned int>(strategy::k_unroll)))
+    {
+        assert(maxthreads > 0);
+    }
+
+    // Whether the problems are better run whole by the threads: there must
+    // be more than one, in numbers that keep the threads busy (at most one
+    // problem slot in 8 left idle on the last round), and each must be
+    // small enough for its interleaved A and B to fit in half the L2.
+    static bool is_suitable(const CPUInfo &ci, const unsigned int M, const unsigned int N, const unsigned int K,
+                            const unsigned int nbatches, const unsigned int nmulti, const int maxthreads)
+    {
+        const unsigned int problems = nbatches * nmulti;
+        const unsigned int threads  = std::max(maxthreads, 1);
+        const unsigned int slots    = iceildiv(problems, threads) * threads;
+
+        const size_t interleaved_size = (roundup(M, static_cast<unsigned int>(strategy::out_height)) + roundup(N, static_cast<unsigned int>(strategy::out_width)))
+                                        * static_cast<size_t>(roundup(K, static_cast<unsigned int>(strategy::k_unroll))) * sizeof(Toi);
+
+        return (problems > 1) && ((slots - problems) * 8 <= slots) && (interleaved_size <= ci.get_L2_cache_size() / 2);
+    }
+
+    // Interface implementation - Compulsory functions
+
+    // Window size: one unit per problem, the batches of each multi first.
+    unsigned int get_window_size() const override
+    {
+        return _nbatches * _nmulti;
+    }
+
+    // Execute
+    void execute(unsigned int start, unsigned int end, int threadid) override
+    {
+        profiler prof(this->_profiler);
+
+        strategy strat(_ci);
+
+        assert(_working_space);
+        int8_t *working_space_bytes = reinterpret_cast<int8_t *>(_working_space) + (threadid * get_thread_working_size());
+
+        // Private buffers of this thread.
+        Tri *const c_panel = reinterpret_cast<Tri *>(working_space_bytes);
+        Toi *const a_panel = reinterpret_cast<Toi *>(working_space_bytes + get_c_working_size());
+        Toi *const b_local = reinterpret_cast<Toi *>(working_space_bytes + get_c_working_size() + get_a_working_size());
+
+        const bool has_output_stage = (this->_bias != nullptr) || (this->_act.type != Activation::Type::None);
+        const int  x_blocks         = _Nround / strategy::out_width;
+
+        // Multi whose B is interleaved in b_local, none yet.
+        const Toi   *b_panel = nullptr;
+        unsigned int b_multi = _nmulti;
+
+        for(unsigned int problem = start; problem < end; problem++)
+        {
+            const unsigned int multi = problem / _nbatches;
+            const unsigned int batch = problem - (multi * _nbatches);
+
+            if(_pretransposed)
+            {
+                assert(_B_transposed);
+                b_panel = _B_transposed + (multi * get_b_size());
+            }
+            else if(multi != b_multi)
+            {
+                auto p = prof.ScopedProfiler(ProfilePhase::PrepareB, get_b_size() * sizeof(Toi));
+
+                interleave_B(b_local, this->_Bptr + (multi * this->_B_multi_stride), this->_ldb);
+                b_panel = b_local;
+                b_multi = multi;
+            }
+
+            {
+                auto p = prof.ScopedProfiler(ProfilePhase::PrepareA, static_cast<size_t>(_Mround) * _Kround * sizeof(Toi));
+
+                const To *A = this->_Aptr + (batch * this->_A_batch_stride) + (multi * this->_A_multi_stride);
+                if(_trA ^ strategy::A_transpose)
+                {
+                    Transform<strategy::A_interleave, strategy::A_block, true>(a_panel, A, this->_lda, 0, _Msize, 0, _Ksize);
+                }
+                else
+                {
+                    Transform<strategy::A_interleave, strategy::A_block, false>(a_panel, A, this->_lda, 0, _Msize, 0, _Ksize);
+                }
+            }
+
+            Tr *const       C     = this->_Cptr + (batch * this->_C_batch_stride) + (multi * this->_C_multi_stride);
+            const Tr *const bias  = (this->_bias != nullptr) ? this->_bias + (multi * this->_bias_multi_stride) : nullptr;
+            const Toi      *a_ptr = a_panel;
+
+            for(unsigned int y = 0; y < _Msize; y += strategy::out_height)
+            {
+                const unsigned int ymax = std::min(_Msize, y + strategy::out_height);
+
+                {
+                    auto p = prof.ScopedProfiler(ProfilePhase::Kernel, (strategy::out_height * _Nround * _Kround));
+
+                    strat.kernel(a_ptr, b_panel, c_panel, 1, x_blocks, _Kround);
+
+                    a_ptr += (strategy::out_height * _Kround);
+                }
+
+                {
+                    auto p = prof.ScopedProfiler(ProfilePhase::Merge, (strategy::out_height * _Nround * sizeof(Tr)));
+
+                    /* K isn't blocked, so the output stage is applied straight away. */
+                    if(has_output_stage)
+                    {
+                        MergeResults<strategy::out_width, strategy::out_height>(C, c_panel, this->_ldc, y, ymax, 0, _Nsize, _alpha, _beta, bias, this->_act);
+                    }
+                    else
+                    {
+                        MergeResults<strategy::out_width, strategy::out_height>(C, c_panel, this->_ldc, y, ymax, 0, _Nsize, _alpha, _beta);
+                    }
+                }
+            }
+        }
+    }
+
+    // Interface implementation - working space
+    size_t get_working_size() const override
+    {
+        // Private buffers for each thread, plus a cache line extra for alignment.
+        return (get_thread_working_size() * _maxthreads) + 64;
+    }
+
+    void set_working_space(void *working_space) override
+    {
+        // Make sure everything ends up cache line aligned
+        int8_t  *working_space_bytes = reinterpret_cast<int8_t *>(working_space);
+        intptr_t working_space_int   = reinterpret_cast<intptr_t>(working_space);
+
+        if(working_space_int & 0x3F)
+        {
+            working_space_bytes += 0x40 - (working_space_int & 0x3F);
+        }
+
+        _working_space = reinterpret_cast<void *>(working_space_bytes);
+    }
+
+    // Interface implementation - pretransposed
+    bool B_is_pretransposed() const override
+    {
+        return _pretransposed;
+    }
+
+    bool B_pretranspose_required() const override
+    {
+        return _pretransposed && (_B_transposed == nullptr);
+    }
+
+    size_t get_B_pretransposed_array_size() const override
+    {
+        return get_b_size() * _nmulti * sizeof(Toi);
+    }
+
+    void pretranspose_B_array(void *in_buffer, const To *B, const int ldb, const int B_multi_stride) override
+    {
+        Toi *buffer   = reinterpret_cast<Toi *>(in_buffer);
+        _B_transposed = buffer;
+        profiler prof(this->_profiler);
+
+        for(unsigned int multi = 0; multi < _nmulti; multi++)
+        {
+            auto p = prof.ScopedProfiler(ProfilePhase::PrepareB, get_b_size() * sizeof(Toi));
+
+            interleave_B(buffer + (multi * get_b_size()), B + (multi * B_multi_stride), ldb);
+        }
+    }
+
+    void set_pretransposed_B_data(void *in_buffer) override
+    {
+        _B_transposed = reinterpret_cast<Toi *>(in_buffer);
+    }
+};
+
+} // namespace arm_gemm
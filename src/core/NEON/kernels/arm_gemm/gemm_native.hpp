@@ -30,9 +30,7 @@
 #include "mergeresults.hpp"
 #include "transform.hpp"
 
-#ifdef CYCLE_PROFILING
 #include "profiler.hpp"
-#endif
 
 namespace arm_gemm
 {
@@ -84,9 +82,7 @@ public:
     // Actually execute the GEMM.
     void execute(unsigned int start, unsigned int end, int) override
     {
-#ifdef CYCLE_PROFILING
-        profiler prof;
-#endif
+        profiler prof(this->_profiler);
         strategy           strat(_ci);
         const unsigned int window_per_batch = iceildiv(_Msize, strategy::out_height);
         const unsigned int window_per_multi = window_per_batch * _nbatches;
@@ -103,6 +99,9 @@ public:
         static_assert(std::is_same<To, Toi>::value, "gemm_native: Operand types must be the same.");
         static_assert(std::is_same<Tr, Tri>::value, "gemm_native: Result types must be the same.");
 
+        /* Output stage applied to each block of rows while it is still in cache. */
+        const bool has_output_stage = (this->_bias != nullptr) || (this->_act.type != Activation::Type::None);
+
         for(unsigned int multi = first_multi; multi <= last_multi; multi++)
         {
             const unsigned int batch_0   = (multi == first_multi) ? first_batch : 0;
@@ -116,14 +115,18 @@ public:
                 for(unsigned int y0 = m_start; y0 < m_end; y0 += strategy::out_height)
                 {
                     const unsigned int ymax = std::min(y0 + strategy::out_height, m_end);
-#ifdef CYCLE_PROFILING
-                    auto p = prof.ScopedProfiler(PROFILE_KERNEL, (ymax - y0) * _Nsize * _Ksize);
-#endif
+                    auto p = prof.ScopedProfiler(ProfilePhase::Kernel, (ymax - y0) * _Nsize * _Ksize);
 
                     strat.kernel(this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride) + (y0 * this->_lda), this->_lda,
                                  this->_Bptr + (multi * this->_B_multi_stride), this->_ldb,
                                  this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (y0 * this->_ldc), this->_ldc,
                                  _beta, (ymax - y0), _Nsize, _Ksize);
+
+                    if(has_output_stage)
+                    {
+                        ApplyOutputStage(this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (y0 * this->_ldc), this->_ldc,
+                                         0, (ymax - y0), 0, _Nsize, (this->_bias != nullptr) ? this->_bias + (multi * this->_bias_multi_stride) : nullptr, this->_act);
+                    }
                 }
             }
         }
@@ -30,9 +30,7 @@
 #include "mergeresults.hpp"
 #include "transform.hpp"
 
-#ifdef CYCLE_PROFILING
 #include "profiler.hpp"
-#endif
 
 namespace arm_gemm
 {
@@ -81,9 +79,7 @@ public:
     // Actually execute the GEMV.
     void execute(unsigned int start, unsigned int end, int) override
     {
-#ifdef CYCLE_PROFILING
-        profiler prof;
-#endif
+        profiler prof(this->_profiler);
 
         strategy strat(_ci);
 
@@ -97,6 +93,9 @@ public:
         static_assert(std::is_same<To, Toi>::value, "gemv_transposed: Operand types must be the same.");
         static_assert(std::is_same<Tr, Tri>::value, "gemv_transposed: Result types must be the same.");
 
+        /* Output stage applied to each block of columns once it has been fully accumulated. */
+        const bool has_output_stage = (this->_bias != nullptr) || (this->_act.type != Activation::Type::None);
+
         for(unsigned int multi = multi_0; multi <= multi_end; multi++)
         {
             const unsigned int n_start = (multi == multi_0) ? n_0 : 0;
@@ -111,13 +110,17 @@ public:
                 for(unsigned int n0 = n_start; n0 < n_end; n0 += n_block)
                 {
                     unsigned int nmax = std::min(n0 + n_block, n_end);
-#ifdef CYCLE_PROFILING
-                    auto p = prof.ScopedProfiler(PROFILE_KERNEL, (mmax - m0) * (nmax - n0));
-#endif
+                    auto p = prof.ScopedProfiler(ProfilePhase::Kernel, (mmax - m0) * (nmax - n0));
                     strat.kernel(this->_Bptr + (multi * this->_B_multi_stride) + (m0 * this->_ldb) + n0,
                                  this->_Aptr + (multi * this->_A_multi_stride) + m0,
                                  this->_Cptr + (multi * this->_C_multi_stride) + n0,
                                  _beta, this->_ldb, (mmax - m0), (nmax - n0));
+
+                    if(has_output_stage && mmax == _Ksize)
+                    {
+                        ApplyOutputStage(this->_Cptr + (multi * this->_C_multi_stride), 0, 0, 1, n0, nmax,
+                                         (this->_bias != nullptr) ? this->_bias + (multi * this->_bias_multi_stride) : nullptr, this->_act);
+                    }
                 }
             }
         }
@@ -30,9 +30,7 @@
 #include "mergeresults.hpp"
 #include "transform.hpp"
 
-#ifdef CYCLE_PROFILING
 #include "profiler.hpp"
-#endif
 
 namespace arm_gemm
 {
@@ -84,9 +82,7 @@ public:
     // Actually execute the GEMV.
     void execute(unsigned int start, unsigned int end, int) override
     {
-#ifdef CYCLE_PROFILING
-        profiler prof;
-#endif
+        profiler prof(this->_profiler);
 
         strategy strat(_ci);
 
@@ -101,6 +97,9 @@ public:
 
         static_assert(std::is_same<Tr, Tri>::value, "GemvPretransposed: Result types must be the same.");
 
+        /* Output stage applied to each block of columns once it has been fully accumulated. */
+        const bool has_output_stage = (this->_bias != nullptr) || (this->_act.type != Activation::Type::None);
+
         for(unsigned int multi = multi_0; multi <= multi_end; multi++)
         {
             const unsigned int n_start = (multi == multi_0) ? n_0 : 0;
@@ -115,15 +114,19 @@ public:
                 for(unsigned int n = n_start; n < n_end; n += n_block)
                 {
                     unsigned int nmax = std::min(n + n_block, n_end);
-#ifdef CYCLE_PROFILING
-                    auto p = prof.ScopedProfiler(PROFILE_KERNEL, (mmax - m0) * (nmax - n));
-#endif
+                    auto p = prof.ScopedProfiler(ProfilePhase::Kernel, (mmax - m0) * (nmax - n));
                     /* This assumes that the underlying call was a GEMM with M=1; for the N=1 case we would have to pick up this->_Bptr below instead */
                     strat.kernel(_A_pretransposed + (multi * _buffer_per_multi) + (n * _Ksize) + (m0 * strategy::A_interleave),
                                  (_Ksize * strategy::A_interleave),
                                  this->_Aptr + (multi * this->_A_multi_stride) + m0,
                                  this->_Cptr + (multi * this->_C_multi_stride) + n,
                                  _beta, (mmax - m0), (nmax - n));
+
+                    if(has_output_stage && mmax == _Ksize)
+                    {
+                        ApplyOutputStage(this->_Cptr + (multi * this->_C_multi_stride), 0, 0, 1, n, nmax,
+                                         (this->_bias != nullptr) ? this->_bias + (multi * this->_bias_multi_stride) : nullptr, this->_act);
+                    }
                 }
             }
         }
@@ -149,9 +152,12 @@ public:
     void pretranspose_B_array(void *buffer, const To *B, const int ldb, const int B_multi_stride) override
     {
         Toi *A_buffer = reinterpret_cast<Toi *>(buffer);
+        profiler prof(this->_profiler);
 
         for(unsigned int multi = 0; multi < _nmultis; multi++)
         {
+            auto p = prof.ScopedProfiler(ProfilePhase::PrepareB, _buffer_per_multi * sizeof(Toi));
+
             /* Reverse sense here as we are dealing with B rather than A.  So if
              * strategy::A_transpose is false and _trB is false, we still
              * transpose.  */
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#ifdef __aarch64__
+
+#include <cstdint>
+
+namespace arm_gemm
+{
+// Actual kernel implementations
+void a64_sgemm_bsr_8x4(const float *, const float *, const uint32_t *, const uint32_t *, float *, int);
+void a64_sgemm_bsr_1x4(const float *, const float *, const uint32_t *, const uint32_t *, float *, int);
+
+// Block sparse SGEMM "strategy" class.
+//
+// B is stored as 1x4 blocks (one row of K, four columns of N) in a BSR
+// like format: the nonzero blocks of each column block, their rows in
+// k_index and their values in consecutive groups of 4.  Zero blocks are
+// neither stored nor multiplied.
+//
+// "kernel" multiplies an interleaved panel of 8 rows of A, "kernel_row" a
+// single row of A read in place.  Both write 'out_width' columns of results
+// per column block, for the merge.
+class sgemm_bsr_8x4
+{
+public:
+    typedef float operand_type;
+    typedef float result_type;
+
+    typedef void (*kern_type)(const float *, const float *, const uint32_t *, const uint32_t *, float *, int);
+
+    /* Describes the data layout for A input */
+    static const int  A_interleave = 8;
+    static const int  A_block      = 1;
+    static const bool A_transpose  = false;
+
+    /* Kernel blocking parameters */
+    static const int out_width  = 4;
+    static const int out_height = 8;
+
+    kern_type kernel     = a64_sgemm_bsr_8x4;
+    kern_type kernel_row = a64_sgemm_bsr_1x4;
+
+    sgemm_bsr_8x4(const CPUInfo *ci)
+    {
+    }
+};
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include <cstdint>
+
+#include <arm_neon.h>
+
+namespace arm_gemm
+{
+// Multiply an interleaved panel of 8 rows of A (8 values per row of K) by
+// 'n_blocks' column blocks of a block sparse B.  The nonzero blocks of
+// column block j are Bblock_start[j] to Bblock_start[j + 1].  The results
+// of each column block are written as 8 rows of 4.
+void a64_sgemm_bsr_8x4(const float *Apanel, const float *Bvalues, const uint32_t *Bk_index, const uint32_t *Bblock_start, float *Cpanel, int n_blocks)
+{
+    for(int j = 0; j < n_blocks; j++)
+    {
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+        float32x4_t acc2 = vdupq_n_f32(0.0f);
+        float32x4_t acc3 = vdupq_n_f32(0.0f);
+        float32x4_t acc4 = vdupq_n_f32(0.0f);
+        float32x4_t acc5 = vdupq_n_f32(0.0f);
+        float32x4_t acc6 = vdupq_n_f32(0.0f);
+        float32x4_t acc7 = vdupq_n_f32(0.0f);
+
+        const uint32_t block_end = Bblock_start[j + 1];
+
+        for(uint32_t p = Bblock_start[j]; p < block_end; p++)
+        {
+            const float *a_ptr = Apanel + (Bk_index[p] * 8);
+
+            const float32x4_t b  = vld1q_f32(Bvalues + (p * 4));
+            const float32x4_t a0 = vld1q_f32(a_ptr);
+            const float32x4_t a1 = vld1q_f32(a_ptr + 4);
+
+            acc0 = vfmaq_laneq_f32(acc0, b, a0, 0);
+            acc1 = vfmaq_laneq_f32(acc1, b, a0, 1);
+            acc2 = vfmaq_laneq_f32(acc2, b, a0, 2);
+            acc3 = vfmaq_laneq_f32(acc3, b, a0, 3);
+            acc4 = vfmaq_laneq_f32(acc4, b, a1, 0);
+            acc5 = vfmaq_laneq_f32(acc5, b, a1, 1);
+            acc6 = vfmaq_laneq_f32(acc6, b, a1, 2);
+            acc7 = vfmaq_laneq_f32(acc7, b, a1, 3);
+        }
+
+        vst1q_f32(Cpanel, acc0);
+        vst1q_f32(Cpanel + 4, acc1);
+        vst1q_f32(Cpanel + 8, acc2);
+        vst1q_f32(Cpanel + 12, acc3);
+        vst1q_f32(Cpanel + 16, acc4);
+        vst1q_f32(Cpanel + 20, acc5);
+        vst1q_f32(Cpanel + 24, acc6);
+        vst1q_f32(Cpanel + 28, acc7);
+        Cpanel += 32;
+    }
+}
+
+// Multiply a single row of A (contiguous along K) by 'n_blocks' column
+// blocks of a block sparse B, writing 4 results per column block.  Two
+// accumulators hide the latency of the multiply-accumulates.
+void a64_sgemm_bsr_1x4(const float *Arow, const float *Bvalues, const uint32_t *Bk_index, const uint32_t *Bblock_start, float *Cpanel, int n_blocks)
+{
+    for(int j = 0; j < n_blocks; j++)
+    {
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+
+        const uint32_t block_end = Bblock_start[j + 1];
+
+        uint32_t p = Bblock_start[j];
+        for(; p + 1 < block_end; p += 2)
+        {
+            acc0 = vfmaq_n_f32(acc0, vld1q_f32(Bvalues + (p * 4)), Arow[Bk_index[p]]);
+            acc1 = vfmaq_n_f32(acc1, vld1q_f32(Bvalues + (p * 4) + 4), Arow[Bk_index[p + 1]]);
+        }
+        if(p < block_end)
+        {
+            acc0 = vfmaq_n_f32(acc0, vld1q_f32(Bvalues + (p * 4)), Arow[Bk_index[p]]);
+        }
+
+        vst1q_f32(Cpanel, vaddq_f32(acc0, acc1));
+        Cpanel += 4;
+    }
+}
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
@@ -27,11 +27,46 @@
  * arm_gemm namespace, put these headers here.  */
 #include <arm_neon.h>
 
+#include <algorithm>
+#include <limits>
+
+#include "arm_gemm.hpp"
 #include "asmlib.hpp"
 #include "utils.hpp"
 
 namespace arm_gemm
 {
+/* Apply an activation to a single result. */
+template <typename T>
+inline T activate(const T v, const Activation &act)
+{
+    switch(act.type)
+    {
+        case Activation::Type::ReLU:
+            return std::max(v, static_cast<T>(0));
+        case Activation::Type::BoundedReLU:
+            return std::min(std::max(v, static_cast<T>(act.lower_bound)), static_cast<T>(act.upper_bound));
+        default:
+            return v;
+    }
+}
+
+/* Apply the output stage to a block of results which have already been
+ * written, for the implementations which don't merge their results.  */
+template <typename Tout>
+inline void ApplyOutputStage(Tout *out, int ldc, int y0, int ymax, int x0, int xmax, const Tout *bias, const Activation &act)
+{
+    for(int y = y0; y < ymax; y++)
+    {
+        for(int x = x0; x < xmax; x++)
+        {
+            Tout &p = out[y * ldc + x];
+
+            p = activate<Tout>(p + (bias != nullptr ? bias[x] : static_cast<Tout>(0)), act);
+        }
+    }
+}
+
 template <unsigned int width, unsigned int height, typename Tin, typename Tout>
 inline void MergeResults(Tout *out, const Tin *in, int ldc, int y0, int ymax, int x0, int xmax, const Tout alpha, const Tout beta)
 {
@@ -70,6 +105,125 @@ inline void MergeResults(Tout *out, const Tin *in, int ldc, int y0, int ymax, in
     }
 }
 
+/* Merge variant with an output stage: the bias of each column is added
+ * and the activation applied while the results are merged.  */
+template <unsigned int width, unsigned int height, typename Tin, typename Tout>
+inline void MergeResults(Tout *out, const Tin *in, int ldc, int y0, int ymax, int x0, int xmax, const Tout alpha, const Tout beta, const Tout *bias, const Activation &act)
+{
+    int full_y_blocks = (ymax - y0) / height;
+    int y_remainder   = (ymax - y0) % height;
+    int y_blocks      = full_y_blocks + (y_remainder ? 1 : 0);
+
+    int full_x_blocks = (xmax - x0) / width;
+    int x_remainder   = (xmax - x0) % width;
+    int x_blocks      = full_x_blocks + (x_remainder ? 1 : 0);
+
+    for(int y_block = 0; y_block < y_blocks; y_block++)
+    {
+        int ybase = y0 + (y_block * height);
+
+        int fill_rows = (y_block < full_y_blocks) ? height : y_remainder;
+
+        for(int x_block = 0; x_block < x_blocks; x_block++)
+        {
+            int xbase = x0 + (x_block * width);
+
+            int fill_cols = (x_block < full_x_blocks) ? width : x_remainder;
+
+            for(int row = 0; row < fill_rows; row++)
+            {
+                for(int col = 0; col < fill_cols; col++)
+                {
+                    Tout &p = out[(ybase + row) * ldc + xbase + col];
+
+                    /* Don't read the output when it is overwritten, it might not be initialised. */
+                    Tout v = (alpha * in[row * width + col]) + (bias != nullptr ? bias[xbase + col] : static_cast<Tout>(0));
+                    if(beta != static_cast<Tout>(0))
+                    {
+                        v += p * beta;
+                    }
+
+                    p = activate<Tout>(v, act);
+                }
+            }
+
+            in += (width * height);
+        }
+    }
+}
+
+/* Requantize a single int32 result to uint8, rounding as the gemmlowp
+ * fixed point multiplication and division by a power of two do.  */
+inline uint8_t requantize(const int32_t v, const Requantize32 &qp)
+{
+    const int64_t ab    = static_cast<int64_t>(v) * qp.result_multiplier;
+    const int64_t nudge = (ab >= 0) ? (1 << 30) : (1 - (1 << 30));
+    const bool    sat   = (v == qp.result_multiplier) && (v == std::numeric_limits<int32_t>::min());
+    const int32_t high  = sat ? std::numeric_limits<int32_t>::max() : static_cast<int32_t>((ab + nudge) / (1ll << 31));
+
+    const int32_t mask      = (1 << qp.result_shift) - 1;
+    const int32_t threshold = (mask >> 1) + ((high < 0) ? 1 : 0);
+    int32_t       r         = (high >> qp.result_shift) + (((high & mask) > threshold) ? 1 : 0);
+
+    r += qp.result_offset;
+    r = std::min(std::max(r, std::max(qp.minval, 0)), std::min(qp.maxval, 255));
+
+    return static_cast<uint8_t>(r);
+}
+
+/* Merge variant which requantizes the results to uint8 (see Requantize32)
+ * rather than accumulating them in C.  The results must be complete, i.e.
+ * cover the whole of K.  'row_sums' points at the sums of this batch's
+ * rows of A and 'k_offset' is a_offset * b_offset * K.  */
+template <unsigned int width, unsigned int height, typename Tin>
+inline void MergeRequantize(uint8_t *out, const Tin *in, int ldo, int y0, int ymax, int x0, int xmax, const Requantize32 &qp, const int32_t *row_sums, const int32_t k_offset)
+{
+    int full_y_blocks = (ymax - y0) / height;
+    int y_remainder   = (ymax - y0) % height;
+    int y_blocks      = full_y_blocks + (y_remainder ? 1 : 0);
+
+    int full_x_blocks = (xmax - x0) / width;
+    int x_remainder   = (xmax - x0) % width;
+    int x_blocks      = full_x_blocks + (x_remainder ? 1 : 0);
+
+    for(int y_block = 0; y_block < y_blocks; y_block++)
+    {
+        int ybase = y0 + (y_block * height);
+
+        int fill_rows = (y_block < full_y_blocks) ? height : y_remainder;
+
+        for(int x_block = 0; x_block < x_blocks; x_block++)
+        {
+            int xbase = x0 + (x_block * width);
+
+            int fill_cols = (x_block < full_x_blocks) ? width : x_remainder;
+
+            for(int row = 0; row < fill_rows; row++)
+            {
+                const int32_t row_term = k_offset + ((qp.b_offset != 0) ? qp.b_offset * row_sums[ybase + row] : 0);
+
+                for(int col = 0; col < fill_cols; col++)
+                {
+                    int32_t v = static_cast<int32_t>(in[row * width + col]) + row_term;
+
+                    if(qp.a_offset != 0)
+                    {
+                        v += qp.a_offset * qp.col_sums[xbase + col];
+                    }
+                    if(qp.bias != nullptr)
+                    {
+                        v += qp.bias[xbase + col];
+                    }
+
+                    out[(ybase + row) * ldo + xbase + col] = requantize(v, qp);
+                }
+            }
+
+            in += (width * height);
+        }
+    }
+}
+
 #include "merges/list.hpp"
 
 } // namespace arm_gemm
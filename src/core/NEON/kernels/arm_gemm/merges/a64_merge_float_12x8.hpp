@@ -230,4 +230,92 @@ inline void MergeResults<12, 8>(float *out, const float *in, const int ldout, co
     }
 }
 
+/* Output stage variant: the bias and the activation are applied to the
+ * 12 columns of a row while they are still in registers.  */
+template <>
+inline void MergeResults<12, 8>(float *out, const float *in, const int ldout, const int y0, const int ymax, const int x0, const int xmax, const float alpha, const float beta,
+                                const float *bias, const Activation &act)
+{
+    const float *inptr = in;
+    prefetch_6x(inptr);
+    prefetch_6x(inptr + 96);
+
+    float minval = -std::numeric_limits<float>::infinity();
+    float maxval = std::numeric_limits<float>::infinity();
+    switch(act.type)
+    {
+        case Activation::Type::BoundedReLU:
+            maxval = act.upper_bound;
+            minval = act.lower_bound;
+            break;
+        case Activation::Type::ReLU:
+            minval = 0.0f;
+            break;
+        default:
+            break;
+    }
+
+    const float32x4_t av      = vdupq_n_f32(alpha);
+    const float32x4_t bv      = vdupq_n_f32(beta);
+    const float32x4_t minv    = vdupq_n_f32(minval);
+    const float32x4_t maxv    = vdupq_n_f32(maxval);
+    const bool        reads_c = (beta != 0.0f);
+
+    for(int y = y0; y < ymax; y += 8)
+    {
+        const int rows = std::min(ymax - y, 8);
+
+        for(int i = x0; i < xmax; i += 12)
+        {
+            if((i + 12) <= xmax)
+            {
+                const float32x4_t bias0 = (bias != nullptr) ? vld1q_f32(bias + i) : vdupq_n_f32(0.0f);
+                const float32x4_t bias1 = (bias != nullptr) ? vld1q_f32(bias + i + 4) : vdupq_n_f32(0.0f);
+                const float32x4_t bias2 = (bias != nullptr) ? vld1q_f32(bias + i + 8) : vdupq_n_f32(0.0f);
+
+                for(int row = 0; row < rows; row++)
+                {
+                    float       *outptr = out + ((y + row) * ldout) + i;
+                    const float *rowptr = inptr + (row * 12);
+
+                    float32x4_t v0 = vmlaq_f32(bias0, vld1q_f32(rowptr), av);
+                    float32x4_t v1 = vmlaq_f32(bias1, vld1q_f32(rowptr + 4), av);
+                    float32x4_t v2 = vmlaq_f32(bias2, vld1q_f32(rowptr + 8), av);
+
+                    /* Don't read C when it is overwritten, it might not be initialised. */
+                    if(reads_c)
+                    {
+                        v0 = vmlaq_f32(v0, vld1q_f32(outptr), bv);
+                        v1 = vmlaq_f32(v1, vld1q_f32(outptr + 4), bv);
+                        v2 = vmlaq_f32(v2, vld1q_f32(outptr + 8), bv);
+                    }
+
+                    vst1q_f32(outptr, vminq_f32(vmaxq_f32(v0, minv), maxv));
+                    vst1q_f32(outptr + 4, vminq_f32(vmaxq_f32(v1, minv), maxv));
+                    vst1q_f32(outptr + 8, vminq_f32(vmaxq_f32(v2, minv), maxv));
+                }
+            }
+            else
+            {
+                /* For ragged X, manually copy over the valid results. */
+                for(int row = 0; row < rows; row++)
+                {
+                    float *outptr = out + ((y + row) * ldout) + i;
+
+                    for(int xi = 0; (i + xi) < xmax; xi++)
+                    {
+                        float v = (alpha * inptr[(row * 12) + xi]) + ((bias != nullptr) ? bias[i + xi] : 0.0f);
+                        if(reads_c)
+                        {
+                            v += outptr[xi] * beta;
+                        }
+                        outptr[xi] = std::min(std::max(v, minval), maxval);
+                    }
+                }
+            }
+            inptr += 96;
+        }
+    }
+}
+
 #endif // __aarch64__
\ No newline at end of file
@@ -23,130 +23,75 @@
  */
 #pragma once
 
-#ifdef CYCLE_PROFILING
+#include "arm_gemm.hpp"
 
-#include "../perf.h"
-
-#ifndef NO_MULTI_THREADING
-#include <mutex>
-#endif
+#include <chrono>
 
 namespace arm_gemm
 {
-#ifndef NO_MULTI_THREADING
-extern std::mutex report_mutex;
-#endif
-
+// Times the phases of a GEMM for the ProfileSink set on it, if any.
 class profiler
 {
 private:
-    static const int maxevents         = 100000;
-    unsigned long    times[maxevents]  = {};
-    unsigned long    units[maxevents]  = {};
-    int              events[maxevents] = {};
-    int              currentevent      = 0;
-    int              countfd           = 0;
+    ProfileSink *_sink;
 
     class ScopedProfilerClass
     {
     private:
-        profiler &_parent;
-        bool      legal = false;
+        ProfileSink                          *_sink;
+        ProfilePhase                          _phase;
+        unsigned long                         _units;
+        std::chrono::steady_clock::time_point _start{};
 
     public:
-        ScopedProfilerClass(profiler &prof, int i, unsigned long u)
-            : _parent(prof)
+        ScopedProfilerClass(ProfileSink *sink, ProfilePhase phase, unsigned long units)
+            : _sink(sink), _phase(phase), _units(units)
         {
-            if(prof.currentevent == maxevents)
-                return;
+            if(_sink != nullptr)
+            {
+                _start = std::chrono::steady_clock::now();
+            }
+        }
 
-            prof.events[prof.currentevent] = i;
-            prof.units[prof.currentevent]  = u;
-            legal                          = true;
-            start_counter(prof.countfd);
+        ScopedProfilerClass(const ScopedProfilerClass &) = delete;
+        ScopedProfilerClass &operator=(const ScopedProfilerClass &) = delete;
+
+        /* Only the last owner of the event reports it. */
+        ScopedProfilerClass(ScopedProfilerClass &&other)
+            : _sink(other._sink), _phase(other._phase), _units(other._units), _start(other._start)
+        {
+            other._sink = nullptr;
         }
 
         ~ScopedProfilerClass()
         {
-            if(!legal)
+            if(_sink == nullptr)
+            {
                 return;
+            }
 
-            long long cycs                        = stop_counter(_parent.countfd);
-            _parent.times[_parent.currentevent++] = cycs;
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start);
+            _sink->record(_phase, elapsed.count(), _units);
         }
     };
 
 public:
-    profiler()
+    profiler(ProfileSink *sink)
+        : _sink(sink)
     {
-        countfd = open_cycle_counter();
-    }
-
-    ~profiler()
-    {
-        close(countfd);
-        int           tots[5];
-        unsigned long counts[5];
-        unsigned long tunits[5];
-        const char   *descs[] = { "Prepare A", "Prepare B", "Kernel", "Merge" };
-
-        for(int i = 1; i < 5; i++)
-        {
-            tots[i]   = 0;
-            counts[i] = 0;
-            tunits[i] = 0;
-        }
-
-        for(int i = 0; i < currentevent; i++)
-        {
-            //            printf("%10s: %ld\n", descs[events[i]-1], times[i]);
-            tots[events[i]]++;
-            counts[events[i]] += times[i];
-            tunits[events[i]] += units[i];
-        }
-
-#ifdef NO_MULTI_THREADING
-        printf("Profiled events:\n");
-#else
-        std::lock_guard<std::mutex> lock(report_mutex);
-        printf("Profiled events (cpu %d):\n", sched_getcpu());
-#endif
-
-        printf("%20s  %9s %9s %9s %12s %9s\n", "", "Events", "Total", "Average", "Bytes/MACs", "Per cycle");
-        for(int i = 1; i < 5; i++)
-        {
-            printf("%20s: %9d %9ld %9ld %12lu %9.2f\n", descs[i - 1], tots[i], counts[i], counts[i] / tots[i], tunits[i], (float)tunits[i] / counts[i]);
-        }
     }
 
     template <typename T>
-    void operator()(int i, unsigned long u, T func)
+    void operator()(ProfilePhase phase, unsigned long units, T func)
     {
-        if(currentevent == maxevents)
-        {
-            func();
-        }
-        else
-        {
-            events[currentevent] = i;
-            units[currentevent]  = u;
-            start_counter(countfd);
-            func();
-            long long cycs        = stop_counter(countfd);
-            times[currentevent++] = cycs;
-        }
+        auto p = ScopedProfiler(phase, units);
+        func();
     }
-    ScopedProfilerClass ScopedProfiler(int i, unsigned long u)
+
+    ScopedProfilerClass ScopedProfiler(ProfilePhase phase, unsigned long units)
     {
-        return ScopedProfilerClass(*this, i, u);
+        return ScopedProfilerClass(_sink, phase, units);
     }
 };
 
-#endif // CYCLE_PROFILING
-
 } // namespace arm_gemm
-
-#define PROFILE_PREPA 1
-#define PROFILE_PREPB 2
-#define PROFILE_KERNEL 3
-#define PROFILE_MERGE 4
@@ -41,16 +41,17 @@ bool Graph::remove_node(NodeID nid)
 
     std::unique_ptr<INode> &node = _nodes[nid];
 
-    // Remove node connections
+    // Remove node connections (remove_connection() erases the output edges from the node, iterate over a copy)
     if(node)
     {
         for(auto &input_eid : node->_input_edges)
         {
             remove_connection(input_eid);
         }
-        for(auto &outpud_eid : node->_output_edges)
+        const std::set<EdgeID> output_edges = node->_output_edges;
+        for(auto &output_eid : output_edges)
         {
-            remove_connection(outpud_eid);
+            remove_connection(output_eid);
         }
     }
 
@@ -24,10 +24,27 @@
 #include "arm_compute/graph/GraphContext.h"
 #include <arm_compute/graph.h>
 
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+void log_memory_plan(const char *name, Target target, IMemoryManager *mm)
+{
+    auto *lifetime_mgr = dynamic_cast<OffsetLifetimeManager *>(mm->lifetime_manager());
+    if(lifetime_mgr != nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO(name << " memory of target " << target << ": planned peak " << lifetime_mgr->planned_size()
+                                   << " bytes, blobs laid end to end " << lifetime_mgr->unpacked_size() << " bytes" << std::endl);
+    }
+    ARM_COMPUTE_UNUSED(name, target);
+}
+} // namespace
+
 GraphContext::GraphContext()
     : _config(), _memory_managers()
 {
@@ -73,11 +90,13 @@ void GraphContext::finalize()
         if(mm_obj.second.intra_mm != nullptr)
         {
             mm_obj.second.intra_mm->finalize();
+            log_memory_plan("Function", mm_obj.first, mm_obj.second.intra_mm.get());
         }
         // Finalize cross layer memory manager
         if(mm_obj.second.cross_mm != nullptr)
         {
             mm_obj.second.cross_mm->finalize();
+            log_memory_plan("Transition", mm_obj.first, mm_obj.second.cross_mm.get());
         }
     }
 }
@@ -28,8 +28,13 @@
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/PassManager.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/detail/CrossLayerMemoryManagerHelpers.h"
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/detail/ParallelBranchExecutor.h"
+#include "arm_compute/graph/detail/PipelineExecutor.h"
+
+#include "arm_compute/runtime/Scheduler.h"
 
 namespace arm_compute
 {
@@ -62,13 +67,59 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Apply all mutating passes
     pm.run_all(graph);
 
+    // Configure the tensors added by the mutating passes
+    detail::configure_all_tensors(graph);
+
     // Validate all nodes
     detail::validate_all_nodes(graph);
 
+    // Split the graph in pipeline stages
+    detail::PipelineStages pipeline_stages;
+    if(forced_target == Target::NEON && ctx.config().num_pipeline_stages > 1)
+    {
+        pipeline_stages = detail::configure_pipeline_stages(graph, ctx.config().num_pipeline_stages);
+    }
+    const bool is_pipelined = pipeline_stages.num_stages > 1;
+
+    // The nodes of the pipeline stages and of the independent branches are configured with the scheduler of the thread executing them
+    std::shared_ptr<detail::PipelineExecutor>       pipeline_executor;
+    std::vector<ExecutionSegment>                   segments;
+    std::shared_ptr<detail::ParallelBranchExecutor> branch_executor;
+    std::vector<IScheduler *>                       node_schedulers;
+#if ARM_COMPUTE_CPP_SCHEDULER
+    if(is_pipelined)
+    {
+        pipeline_executor = std::make_shared<detail::PipelineExecutor>(std::move(pipeline_stages), Scheduler::get().num_threads());
+        node_schedulers   = pipeline_executor->node_schedulers();
+    }
+    else if(forced_target == Target::NEON && ctx.config().max_concurrent_branches > 1)
+    {
+        segments = detail::split_execution_segments(graph, ctx.config().max_concurrent_branches);
+        if(!segments.empty())
+        {
+            branch_executor = std::make_shared<detail::ParallelBranchExecutor>(ctx.config().max_concurrent_branches, Scheduler::get().num_threads());
+            node_schedulers = branch_executor->node_schedulers(segments, graph.nodes().size());
+        }
+    }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
     // Configure all nodes
-    auto workload = detail::configure_all_nodes(graph, ctx);
+    auto workload = detail::configure_all_nodes(graph, ctx, node_schedulers);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
+#if ARM_COMPUTE_CPP_SCHEDULER
+    if(pipeline_executor != nullptr)
+    {
+        pipeline_executor->configure(workload);
+        workload.pipeline_executor = std::move(pipeline_executor);
+    }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+    if(branch_executor != nullptr)
+    {
+        detail::configure_execution_segments(workload, segments, std::move(branch_executor));
+    }
+
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
@@ -80,7 +131,8 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     }
 
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if(ctx.config().use_transition_memory_manager)
+    // Pipeline stages run concurrently on different requests so their transition buffers can't be shared
+    if(ctx.config().use_transition_memory_manager && !is_pipelined)
     {
         detail::configure_transition_manager(graph, ctx, workload);
     }
@@ -92,6 +144,19 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Finalize Graph context
     ctx.finalize();
 
+    // Bind the memory groups to their pools once and for all
+    if(ctx.config().use_frozen_memory)
+    {
+        if(is_pipelined || !workload.segments.empty())
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Frozen memory requires a single pool per memory manager: disabled for pipelined or concurrent execution" << std::endl);
+        }
+        else
+        {
+            detail::freeze_memory_managers(ctx);
+        }
+    }
+
     // Register graph
     _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id().get() << std::endl);
@@ -103,23 +168,70 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
 
         // Release all unused const tensors
         detail::release_unused_tensors(graph);
+
+        // Complete the setup of the backends which depends on the first run
+        for(const auto &backend : backends::BackendRegistry::get().backends())
+        {
+            backend.second->complete_backend_context(ctx);
+        }
     }
 }
 
 void GraphManager::execute_graph(Graph &graph)
+{
+    execute_graph(graph, 1);
+}
+
+void GraphManager::execute_graph(Graph &graph, unsigned int num_requests)
 {
     // Check if graph is finalized
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
-    // Call input accessors
-    detail::call_all_input_node_accessors(it->second);
+#if ARM_COMPUTE_CPP_SCHEDULER
+    // Overlap the requests in the pipeline stages
+    if(it->second.pipeline_executor != nullptr)
+    {
+        it->second.pipeline_executor->run(it->second, num_requests);
+        return;
+    }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+    for(unsigned int i = 0; i < num_requests; ++i)
+    {
+        // Call input accessors
+        detail::call_all_input_node_accessors(it->second);
 
-    // Run graph
-    detail::call_all_tasks(it->second);
+        // Run graph
+        detail::call_all_tasks(it->second);
+
+        // Call output accessors
+        detail::call_all_output_node_accessors(it->second);
+    }
+}
+
+std::vector<float> GraphManager::pipeline_stage_occupancy(Graph &graph) const
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+    if(it->second.pipeline_executor != nullptr)
+    {
+        return it->second.pipeline_executor->occupancy();
+    }
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(it);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+    return std::vector<float>();
+}
+
+const MemoryPlan &GraphManager::memory_plan(const Graph &graph) const
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
-    // Call output accessors
-    detail::call_all_output_node_accessors(it->second);
+    return it->second.memory_plan;
 }
 
 void GraphManager::invalidate_graph(Graph &graph)
@@ -0,0 +1,867 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphSerializer.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* defined(__linux__) */
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** File signature */
+constexpr char graph_magic[8] = { 'A', 'C', 'L', 'G', 'R', 'A', 'P', 'H' };
+/** Version of the format, to increase on any change of the records */
+constexpr uint32_t graph_version = 2;
+/** Producer index of the inputs which aren't connected */
+constexpr uint32_t no_producer = std::numeric_limits<uint32_t>::max();
+
+/** Values of an enumeration saved in graph files
+ *
+ * The code saved for a value is its index in the table, so that the files don't depend on the declaration order of the enumeration.
+ *
+ * @note Values must only be appended to the tables
+ */
+template <typename E>
+const std::vector<E> &enum_codes();
+
+template <>
+const std::vector<NodeType> &enum_codes<NodeType>()
+{
+    static const std::vector<NodeType> codes =
+    {
+        NodeType::ActivationLayer, NodeType::BatchNormalizationLayer, NodeType::ConvolutionLayer, NodeType::DepthConcatenateLayer,
+        NodeType::DepthwiseConvolutionLayer, NodeType::EltwiseLayer, NodeType::FlattenLayer, NodeType::FullyConnectedLayer,
+        NodeType::NormalizationLayer, NodeType::PermuteLayer, NodeType::PoolingLayer, NodeType::ReshapeLayer,
+        NodeType::SoftmaxLayer, NodeType::SplitLayer, NodeType::Input, NodeType::Output, NodeType::Const
+    };
+    return codes;
+}
+template <>
+const std::vector<DataType> &enum_codes<DataType>()
+{
+    static const std::vector<DataType> codes =
+    {
+        DataType::UNKNOWN, DataType::U8, DataType::S8, DataType::QS8, DataType::QASYMM8, DataType::U16, DataType::S16, DataType::QS16,
+        DataType::U32, DataType::S32, DataType::QS32, DataType::U64, DataType::S64, DataType::F16, DataType::F32, DataType::F64, DataType::SIZET
+    };
+    return codes;
+}
+template <>
+const std::vector<DataLayout> &enum_codes<DataLayout>()
+{
+    static const std::vector<DataLayout> codes = { DataLayout::UNKNOWN, DataLayout::NCHW, DataLayout::NHWC };
+    return codes;
+}
+template <>
+const std::vector<DimensionRoundingType> &enum_codes<DimensionRoundingType>()
+{
+    static const std::vector<DimensionRoundingType> codes = { DimensionRoundingType::FLOOR, DimensionRoundingType::CEIL };
+    return codes;
+}
+template <>
+const std::vector<ActivationLayerInfo::ActivationFunction> &enum_codes<ActivationLayerInfo::ActivationFunction>()
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+    static const std::vector<ActivationFunction> codes =
+    {
+        ActivationFunction::LOGISTIC, ActivationFunction::TANH, ActivationFunction::RELU, ActivationFunction::BOUNDED_RELU,
+        ActivationFunction::LU_BOUNDED_RELU, ActivationFunction::LEAKY_RELU, ActivationFunction::SOFT_RELU, ActivationFunction::ABS,
+        ActivationFunction::SQUARE, ActivationFunction::SQRT, ActivationFunction::LINEAR
+    };
+    return codes;
+}
+template <>
+const std::vector<ConvolutionMethod> &enum_codes<ConvolutionMethod>()
+{
+    static const std::vector<ConvolutionMethod> codes =
+    {
+        ConvolutionMethod::DEFAULT, ConvolutionMethod::GEMM, ConvolutionMethod::DIRECT, ConvolutionMethod::WINOGRAD, ConvolutionMethod::IMPLICIT_GEMM
+    };
+    return codes;
+}
+template <>
+const std::vector<FastMathHint> &enum_codes<FastMathHint>()
+{
+    static const std::vector<FastMathHint> codes = { FastMathHint::ENABLED, FastMathHint::DISABLED };
+    return codes;
+}
+template <>
+const std::vector<DepthwiseConvolutionMethod> &enum_codes<DepthwiseConvolutionMethod>()
+{
+    static const std::vector<DepthwiseConvolutionMethod> codes = { DepthwiseConvolutionMethod::DEFAULT, DepthwiseConvolutionMethod::GEMV, DepthwiseConvolutionMethod::OPTIMIZED_3x3 };
+    return codes;
+}
+template <>
+const std::vector<EltwiseOperation> &enum_codes<EltwiseOperation>()
+{
+    static const std::vector<EltwiseOperation> codes = { EltwiseOperation::ADD, EltwiseOperation::SUB, EltwiseOperation::MUL };
+    return codes;
+}
+template <>
+const std::vector<ConvertPolicy> &enum_codes<ConvertPolicy>()
+{
+    static const std::vector<ConvertPolicy> codes = { ConvertPolicy::WRAP, ConvertPolicy::SATURATE };
+    return codes;
+}
+template <>
+const std::vector<RoundingPolicy> &enum_codes<RoundingPolicy>()
+{
+    static const std::vector<RoundingPolicy> codes = { RoundingPolicy::TO_ZERO, RoundingPolicy::TO_NEAREST_UP, RoundingPolicy::TO_NEAREST_EVEN };
+    return codes;
+}
+template <>
+const std::vector<NormType> &enum_codes<NormType>()
+{
+    static const std::vector<NormType> codes = { NormType::IN_MAP_1D, NormType::IN_MAP_2D, NormType::CROSS_MAP };
+    return codes;
+}
+template <>
+const std::vector<PoolingType> &enum_codes<PoolingType>()
+{
+    static const std::vector<PoolingType> codes = { PoolingType::MAX, PoolingType::AVG, PoolingType::L2 };
+    return codes;
+}
+
+uint64_t align_offset(uint64_t offset)
+{
+    const uint64_t alignment = GraphSerializer::data_alignment;
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+/** Writer of the node records */
+class RecordWriter
+{
+public:
+    template <typename T>
+    void write(T value)
+    {
+        const auto *ptr = reinterpret_cast<const uint8_t *>(&value);
+        _buffer.insert(_buffer.end(), ptr, ptr + sizeof(T));
+    }
+    template <typename E>
+    void write_enum(E value)
+    {
+        const std::vector<E> &codes = enum_codes<E>();
+        const auto            it    = std::find(codes.begin(), codes.end(), value);
+        ARM_COMPUTE_ERROR_ON_MSG(it == codes.end(), "Value without code in graph files");
+        write<uint32_t>(std::distance(codes.begin(), it));
+    }
+    void write_string(const std::string &str)
+    {
+        write<uint32_t>(str.size());
+        _buffer.insert(_buffer.end(), str.begin(), str.end());
+    }
+    void write_shape(const TensorShape &shape)
+    {
+        write<uint32_t>(shape.num_dimensions());
+        for(size_t i = 0; i < shape.num_dimensions(); ++i)
+        {
+            write<uint32_t>(shape[i]);
+        }
+    }
+    void write_descriptor(const TensorDescriptor &desc)
+    {
+        write_shape(desc.shape);
+        write_enum(desc.data_type);
+        write_enum(desc.layout);
+        write<float>(desc.quant_info.scale);
+        write<int32_t>(desc.quant_info.offset);
+    }
+    void write_pad_stride_info(const PadStrideInfo &info)
+    {
+        write<uint32_t>(info.stride().first);
+        write<uint32_t>(info.stride().second);
+        write<uint32_t>(info.pad_left());
+        write<uint32_t>(info.pad_right());
+        write<uint32_t>(info.pad_top());
+        write<uint32_t>(info.pad_bottom());
+        write_enum(info.round());
+    }
+    void write_activation_info(const ActivationLayerInfo &info)
+    {
+        write<uint8_t>(info.enabled());
+        write_enum(info.activation());
+        write<float>(info.a());
+        write<float>(info.b());
+    }
+    const std::vector<uint8_t> &buffer() const
+    {
+        return _buffer;
+    }
+
+private:
+    std::vector<uint8_t> _buffer{};
+};
+
+/** Bounds checked reader of the node records */
+class RecordReader
+{
+public:
+    RecordReader(const uint8_t *data, size_t size, const std::string &filename)
+        : _data(data), _size(size), _offset(0), _filename(filename)
+    {
+    }
+    const uint8_t *read(size_t size)
+    {
+        if(size > _size - _offset)
+        {
+            ARM_COMPUTE_ERROR("Truncated graph file %s", _filename.c_str());
+        }
+        const uint8_t *ptr = _data + _offset;
+        _offset += size;
+        return ptr;
+    }
+    template <typename T>
+    T read()
+    {
+        T value{};
+        std::memcpy(&value, read(sizeof(T)), sizeof(T));
+        return value;
+    }
+    template <typename E>
+    E read_enum()
+    {
+        const std::vector<E> &codes = enum_codes<E>();
+        const uint32_t        code  = read<uint32_t>();
+        if(code >= codes.size())
+        {
+            ARM_COMPUTE_ERROR("Invalid enumeration value in graph file %s", _filename.c_str());
+        }
+        return codes[code];
+    }
+    std::string read_string()
+    {
+        const uint32_t size = read<uint32_t>();
+        return std::string(reinterpret_cast<const char *>(read(size)), size);
+    }
+    TensorShape read_shape()
+    {
+        const uint32_t num_dimensions = read<uint32_t>();
+        if(num_dimensions > TensorShape::num_max_dimensions)
+        {
+            ARM_COMPUTE_ERROR("Invalid tensor shape in graph file %s", _filename.c_str());
+        }
+        TensorShape shape;
+        for(uint32_t i = 0; i < num_dimensions; ++i)
+        {
+            shape.set(i, read<uint32_t>());
+        }
+        return shape;
+    }
+    TensorDescriptor read_descriptor()
+    {
+        const TensorShape shape     = read_shape();
+        const auto        data_type = read_enum<DataType>();
+        const auto        layout    = read_enum<DataLayout>();
+        const float       scale     = read<float>();
+        const int32_t     offset    = read<int32_t>();
+        return TensorDescriptor(shape, data_type, QuantizationInfo(scale, offset), layout);
+    }
+    PadStrideInfo read_pad_stride_info()
+    {
+        const uint32_t stride_x   = read<uint32_t>();
+        const uint32_t stride_y   = read<uint32_t>();
+        const uint32_t pad_left   = read<uint32_t>();
+        const uint32_t pad_right  = read<uint32_t>();
+        const uint32_t pad_top    = read<uint32_t>();
+        const uint32_t pad_bottom = read<uint32_t>();
+        const auto     round      = read_enum<DimensionRoundingType>();
+        return PadStrideInfo(stride_x, stride_y, pad_left, pad_right, pad_top, pad_bottom, round);
+    }
+    ActivationLayerInfo read_activation_info()
+    {
+        const bool  enabled    = read<uint8_t>() != 0;
+        const auto  activation = read_enum<ActivationLayerInfo::ActivationFunction>();
+        const float a          = read<float>();
+        const float b          = read<float>();
+        return enabled ? ActivationLayerInfo(activation, a, b) : ActivationLayerInfo();
+    }
+
+private:
+    const uint8_t     *_data;
+    size_t             _size;
+    size_t             _offset;
+    const std::string &_filename;
+};
+
+/** Accessor of constant data held by the mapping of a graph file */
+class MappedConstAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data Constant data, sharing the ownership of the mapping
+     * @param[in] size Size of the data in bytes
+     */
+    MappedConstAccessor(std::shared_ptr<uint8_t> data, size_t size)
+        : _data(std::move(data)), _size(size)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        // Nothing to copy if the tensor is backed by the mapping
+        if(tensor.buffer() == _data.get())
+        {
+            return true;
+        }
+
+        const TensorShape &shape        = tensor.info()->tensor_shape();
+        const size_t       element_size = tensor.info()->element_size();
+        ARM_COMPUTE_ERROR_ON_MSG(shape.total_size() * element_size != _size, "Constant data doesn't match the tensor");
+
+        // Copy the rows of the tensor one after the other
+        Window window;
+        window.use_tensor_dimensions(shape);
+        window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        const size_t   row_size = shape[0] * element_size;
+        const uint8_t *src      = _data.get();
+
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            std::memcpy(it.ptr(), src, row_size);
+            src += row_size;
+        },
+        it);
+
+        return true;
+    }
+    std::shared_ptr<IMemoryRegion> importable_memory(const ITensorInfo &info) override
+    {
+        // The backend tensor must be laid out like the data
+        if(!info.padding().empty() || info.total_size() != _size)
+        {
+            return nullptr;
+        }
+        return std::make_shared<MemoryRegion>(_data, _size);
+    }
+
+private:
+    std::shared_ptr<uint8_t> _data;
+    size_t                   _size;
+};
+
+/** Maps a file in memory
+ *
+ * @param[in] filename File to map
+ *
+ * @return The mapping, aligned to @ref GraphSerializer::data_alignment, and its size
+ */
+std::pair<std::shared_ptr<uint8_t>, size_t> map_file(const std::string &filename)
+{
+#if defined(__linux__)
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        ARM_COMPUTE_ERROR("Failed to stat '%s' or empty file", filename.c_str());
+    }
+    // Private writable mapping: the pages stay shared with the page cache unless a backend writes to its constants
+    const size_t size    = st.st_size;
+    void        *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(mapping == MAP_FAILED)
+    {
+        ARM_COMPUTE_ERROR("Failed to map '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::shared_ptr<uint8_t> data(static_cast<uint8_t *>(mapping), [size](uint8_t *ptr)
+    {
+        munmap(ptr, size);
+    });
+    return std::make_pair(std::move(data), size);
+#else  /* defined(__linux__) */
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    fs.seekg(0, std::ios::end);
+    const size_t size = fs.tellg();
+    fs.seekg(0, std::ios::beg);
+    auto region = std::make_shared<MemoryRegion>(size, GraphSerializer::data_alignment);
+    fs.read(static_cast<char *>(region->buffer()), size);
+    return std::make_pair(std::shared_ptr<uint8_t>(region, static_cast<uint8_t *>(region->buffer())), size);
+#endif /* defined(__linux__) */
+}
+
+/** Returns the size of the data of a constant node
+ *
+ * @param[in] node Constant node
+ *
+ * @return The size of the data in bytes, 0 if the constant has no accessor
+ */
+uint64_t const_data_size(INode &node)
+{
+    Tensor *tensor = node.output(0);
+    if(tensor == nullptr || tensor->accessor() == nullptr)
+    {
+        return 0;
+    }
+    return tensor->desc().shape.total_size() * element_size_from_data_type(tensor->desc().data_type);
+}
+
+void serialize_node(RecordWriter &writer, INode &node, const std::vector<uint32_t> &indices, uint64_t &data_offset)
+{
+    const uint32_t index = indices[node.id()];
+    writer.write_enum(node.type());
+    writer.write_string(node.name());
+
+    // Inputs are identified by the index of their producer in the file and its output index
+    writer.write<uint32_t>(node.num_inputs());
+    for(size_t idx = 0; idx < node.num_inputs(); ++idx)
+    {
+        const Edge *edge = node.input_edge(idx);
+        if(edge == nullptr)
+        {
+            writer.write<uint32_t>(no_producer);
+            writer.write<uint32_t>(0);
+            continue;
+        }
+        if(indices[edge->producer_id()] >= index)
+        {
+            ARM_COMPUTE_ERROR("Node %s is added to the graph before the nodes producing its inputs", node.name().c_str());
+        }
+        writer.write<uint32_t>(indices[edge->producer_id()]);
+        writer.write<uint32_t>(edge->producer_idx());
+    }
+
+    switch(node.type())
+    {
+        case NodeType::ActivationLayer:
+            writer.write_activation_info(polymorphic_downcast<ActivationLayerNode *>(&node)->activation_info());
+            break;
+        case NodeType::BatchNormalizationLayer:
+        {
+            auto *bn_node = polymorphic_downcast<BatchNormalizationLayerNode *>(&node);
+            writer.write<float>(bn_node->epsilon());
+            writer.write_activation_info(bn_node->fused_activation());
+            break;
+        }
+        case NodeType::ConvolutionLayer:
+        {
+            auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(&node);
+            writer.write_pad_stride_info(conv_node->convolution_info());
+            writer.write<uint32_t>(conv_node->num_groups());
+            writer.write_enum(conv_node->convolution_method());
+            writer.write_enum(conv_node->fast_math_hint());
+            writer.write<float>(node.output(0)->desc().quant_info.scale);
+            writer.write<int32_t>(node.output(0)->desc().quant_info.offset);
+            writer.write_activation_info(conv_node->fused_activation());
+            break;
+        }
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            auto *dwc_node = polymorphic_downcast<DepthwiseConvolutionLayerNode *>(&node);
+            writer.write_pad_stride_info(dwc_node->convolution_info());
+            writer.write_enum(dwc_node->depthwise_convolution_method());
+            writer.write_activation_info(dwc_node->fused_activation());
+            break;
+        }
+        case NodeType::EltwiseLayer:
+        {
+            auto *eltwise_node = polymorphic_downcast<EltwiseLayerNode *>(&node);
+            writer.write_enum(eltwise_node->eltwise_operation());
+            writer.write_enum(eltwise_node->convert_policy());
+            writer.write_enum(eltwise_node->rounding_policy());
+            break;
+        }
+        case NodeType::FullyConnectedLayer:
+            writer.write<uint32_t>(node.output(0)->desc().shape[0]);
+            writer.write_activation_info(polymorphic_downcast<FullyConnectedLayerNode *>(&node)->fused_activation());
+            break;
+        case NodeType::NormalizationLayer:
+        {
+            const NormalizationLayerInfo norm_info = polymorphic_downcast<NormalizationLayerNode *>(&node)->normalization_info();
+            writer.write_enum(norm_info.type());
+            writer.write<uint32_t>(norm_info.norm_size());
+            writer.write<float>(norm_info.alpha());
+            writer.write<float>(norm_info.beta());
+            writer.write<float>(norm_info.kappa());
+            writer.write<uint8_t>(norm_info.scale_coeff() != norm_info.alpha());
+            break;
+        }
+        case NodeType::PermuteLayer:
+        {
+            const PermutationVector &perm = polymorphic_downcast<PermuteLayerNode *>(&node)->permutation_vector();
+            writer.write<uint32_t>(perm.num_dimensions());
+            for(size_t i = 0; i < perm.num_dimensions(); ++i)
+            {
+                writer.write<uint32_t>(perm[i]);
+            }
+            writer.write_enum(node.output(0)->desc().layout);
+            break;
+        }
+        case NodeType::PoolingLayer:
+        {
+            const PoolingLayerInfo pool_info = polymorphic_downcast<PoolingLayerNode *>(&node)->pooling_info();
+            writer.write_enum(pool_info.pool_type());
+            writer.write<uint8_t>(pool_info.is_global_pooling());
+            writer.write<uint32_t>(pool_info.pool_size().width);
+            writer.write<uint32_t>(pool_info.pool_size().height);
+            writer.write_pad_stride_info(pool_info.pad_stride_info());
+            writer.write<uint8_t>(pool_info.exclude_padding());
+            break;
+        }
+        case NodeType::ReshapeLayer:
+            writer.write_shape(node.output(0)->desc().shape);
+            break;
+        case NodeType::SoftmaxLayer:
+            writer.write<float>(polymorphic_downcast<SoftmaxLayerNode *>(&node)->beta());
+            break;
+        case NodeType::SplitLayer:
+        {
+            auto *split_node = polymorphic_downcast<SplitLayerNode *>(&node);
+            writer.write<uint32_t>(split_node->num_splits());
+            writer.write<uint32_t>(split_node->axis());
+            break;
+        }
+        case NodeType::Input:
+            writer.write_descriptor(node.output(0)->desc());
+            break;
+        case NodeType::Const:
+        {
+            // The data of the constants follows the node records
+            const uint64_t size = const_data_size(node);
+            writer.write_descriptor(node.output(0)->desc());
+            writer.write<uint64_t>(data_offset);
+            writer.write<uint64_t>(size);
+            data_offset = align_offset(data_offset + size);
+            break;
+        }
+        case NodeType::DepthConcatenateLayer:
+        case NodeType::FlattenLayer:
+        case NodeType::Output:
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Node %s can't be serialized", node.name().c_str());
+    }
+}
+
+NodeID deserialize_node(Graph &g, RecordReader &reader, NodeType type, size_t num_inputs, const std::shared_ptr<uint8_t> &data, uint64_t data_size)
+{
+    switch(type)
+    {
+        case NodeType::ActivationLayer:
+            return g.add_node<ActivationLayerNode>(reader.read_activation_info());
+        case NodeType::BatchNormalizationLayer:
+        {
+            const float epsilon = reader.read<float>();
+            return g.add_node<BatchNormalizationLayerNode>(epsilon, reader.read_activation_info());
+        }
+        case NodeType::ConvolutionLayer:
+        {
+            const PadStrideInfo       conv_info      = reader.read_pad_stride_info();
+            const uint32_t            num_groups     = reader.read<uint32_t>();
+            const auto                method         = reader.read_enum<ConvolutionMethod>();
+            const auto                fast_math_hint = reader.read_enum<FastMathHint>();
+            const float               scale          = reader.read<float>();
+            const int32_t             offset         = reader.read<int32_t>();
+            const ActivationLayerInfo fused_act      = reader.read_activation_info();
+
+            const NodeID nid = g.add_node<ConvolutionLayerNode>(conv_info, num_groups, method, fast_math_hint, QuantizationInfo(scale, offset));
+            polymorphic_downcast<ConvolutionLayerNode *>(g.node(nid))->set_fused_activation(fused_act);
+            return nid;
+        }
+        case NodeType::DepthConcatenateLayer:
+            return g.add_node<DepthConcatenateLayerNode>(num_inputs);
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            const PadStrideInfo       conv_info = reader.read_pad_stride_info();
+            const auto                method    = reader.read_enum<DepthwiseConvolutionMethod>();
+            const ActivationLayerInfo fused_act = reader.read_activation_info();
+
+            const NodeID nid = g.add_node<DepthwiseConvolutionLayerNode>(conv_info, method);
+            polymorphic_downcast<DepthwiseConvolutionLayerNode *>(g.node(nid))->set_fused_activation(fused_act);
+            return nid;
+        }
+        case NodeType::EltwiseLayer:
+        {
+            const auto op       = reader.read_enum<EltwiseOperation>();
+            const auto c_policy = reader.read_enum<ConvertPolicy>();
+            const auto r_policy = reader.read_enum<RoundingPolicy>();
+            return g.add_node<EltwiseLayerNode>(op, c_policy, r_policy);
+        }
+        case NodeType::FlattenLayer:
+            return g.add_node<FlattenLayerNode>();
+        case NodeType::FullyConnectedLayer:
+        {
+            const uint32_t            num_outputs = reader.read<uint32_t>();
+            const ActivationLayerInfo fused_act   = reader.read_activation_info();
+
+            const NodeID nid = g.add_node<FullyConnectedLayerNode>(num_outputs);
+            polymorphic_downcast<FullyConnectedLayerNode *>(g.node(nid))->set_fused_activation(fused_act);
+            return nid;
+        }
+        case NodeType::NormalizationLayer:
+        {
+            const auto     norm_type = reader.read_enum<NormType>();
+            const uint32_t norm_size = reader.read<uint32_t>();
+            const float    alpha     = reader.read<float>();
+            const float    beta      = reader.read<float>();
+            const float    kappa     = reader.read<float>();
+            const bool     is_scaled = reader.read<uint8_t>() != 0;
+            return g.add_node<NormalizationLayerNode>(NormalizationLayerInfo(norm_type, norm_size, alpha, beta, kappa, is_scaled));
+        }
+        case NodeType::PermuteLayer:
+        {
+            PermutationVector perm;
+            const uint32_t    num_dimensions = reader.read<uint32_t>();
+            if(num_dimensions > PermutationVector::num_max_dimensions)
+            {
+                ARM_COMPUTE_ERROR("Invalid permutation vector in graph file");
+            }
+            for(uint32_t i = 0; i < num_dimensions; ++i)
+            {
+                perm.set(i, reader.read<uint32_t>());
+            }
+            return g.add_node<PermuteLayerNode>(perm, reader.read_enum<DataLayout>());
+        }
+        case NodeType::PoolingLayer:
+        {
+            const auto          pool_type         = reader.read_enum<PoolingType>();
+            const bool          is_global_pooling = reader.read<uint8_t>() != 0;
+            const uint32_t      pool_width        = reader.read<uint32_t>();
+            const uint32_t      pool_height       = reader.read<uint32_t>();
+            const PadStrideInfo pad_stride_info   = reader.read_pad_stride_info();
+            const bool          exclude_padding   = reader.read<uint8_t>() != 0;
+            return is_global_pooling ? g.add_node<PoolingLayerNode>(PoolingLayerInfo(pool_type)) :
+                   g.add_node<PoolingLayerNode>(PoolingLayerInfo(pool_type, Size2D(pool_width, pool_height), pad_stride_info, exclude_padding));
+        }
+        case NodeType::ReshapeLayer:
+            return g.add_node<ReshapeLayerNode>(reader.read_shape());
+        case NodeType::SoftmaxLayer:
+            return g.add_node<SoftmaxLayerNode>(reader.read<float>());
+        case NodeType::SplitLayer:
+        {
+            const uint32_t num_splits = reader.read<uint32_t>();
+            return g.add_node<SplitLayerNode>(num_splits, reader.read<uint32_t>());
+        }
+        case NodeType::Input:
+            return g.add_node<InputNode>(reader.read_descriptor());
+        case NodeType::Output:
+            return g.add_node<OutputNode>();
+        case NodeType::Const:
+        {
+            const TensorDescriptor desc   = reader.read_descriptor();
+            const uint64_t         offset = reader.read<uint64_t>();
+            const uint64_t         size   = reader.read<uint64_t>();
+            if(offset > data_size || size > data_size - offset)
+            {
+                ARM_COMPUTE_ERROR("Constant data out of the bounds of the graph file");
+            }
+
+            // The constants share the ownership of the mapping
+            const NodeID nid = g.add_node<ConstNode>(desc);
+            if(size != 0)
+            {
+                g.node(nid)->output(0)->set_accessor(support::cpp14::make_unique<MappedConstAccessor>(std::shared_ptr<uint8_t>(data, data.get() + offset), size));
+            }
+            return nid;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Invalid node type in graph file");
+            return EmptyNodeID;
+    }
+}
+} // namespace
+
+constexpr size_t GraphSerializer::data_alignment;
+
+void GraphSerializer::serialize(Graph &g, const std::string &filename)
+{
+    // Index the nodes in the order they are saved
+    std::vector<uint32_t> indices(g.nodes().size(), no_producer);
+    uint32_t              num_nodes = 0;
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr)
+        {
+            indices[node->id()] = num_nodes++;
+        }
+    }
+
+    RecordWriter         writer;
+    std::vector<INode *> const_nodes;
+    uint64_t             data_size = 0;
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr)
+        {
+            serialize_node(writer, *node, indices, data_size);
+            if(node->type() == NodeType::Const)
+            {
+                const_nodes.push_back(node.get());
+            }
+        }
+    }
+
+    std::ofstream fs;
+    fs.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    fs.open(filename, std::ios::out | std::ios::binary);
+
+    // Header and node records
+    const uint64_t records_offset = sizeof(graph_magic) + sizeof(uint32_t) + 2 * sizeof(uint64_t);
+    const uint64_t data_offset    = align_offset(records_offset + writer.buffer().size());
+    const uint64_t nodes_count    = num_nodes;
+    fs.write(graph_magic, sizeof(graph_magic));
+    fs.write(reinterpret_cast<const char *>(&graph_version), sizeof(uint32_t));
+    fs.write(reinterpret_cast<const char *>(&nodes_count), sizeof(uint64_t));
+    fs.write(reinterpret_cast<const char *>(&data_offset), sizeof(uint64_t));
+    fs.write(reinterpret_cast<const char *>(writer.buffer().data()), writer.buffer().size());
+
+    // Data of the constants, read through their accessors
+    const char padding[data_alignment] = {};
+    for(auto &node : const_nodes)
+    {
+        const uint64_t pos = static_cast<uint64_t>(fs.tellp());
+        fs.write(padding, align_offset(pos) - pos);
+
+        const uint64_t size = const_data_size(*node);
+        if(size != 0)
+        {
+            const TensorDescriptor &desc = node->output(0)->desc();
+            TensorInfo              info(desc.shape, 1, desc.data_type, desc.quant_info);
+            info.set_data_layout(desc.layout);
+
+            arm_compute::Tensor tensor;
+            tensor.allocator()->init(info);
+            tensor.allocator()->allocate();
+            node->output(0)->accessor()->access_tensor(tensor);
+            fs.write(reinterpret_cast<const char *>(tensor.buffer()), size);
+        }
+    }
+    const uint64_t pos = static_cast<uint64_t>(fs.tellp());
+    fs.write(padding, align_offset(pos) - pos);
+    fs.close();
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Serialized " << num_nodes << " nodes to " << filename << std::endl);
+}
+
+void GraphSerializer::deserialize(Graph &g, const std::string &filename, Target target)
+{
+    const auto     mapping = map_file(filename);
+    const uint8_t *data    = mapping.first.get();
+    const size_t   size    = mapping.second;
+
+    RecordReader reader(data, size, filename);
+    if(std::memcmp(reader.read(sizeof(graph_magic)), graph_magic, sizeof(graph_magic)) != 0)
+    {
+        ARM_COMPUTE_ERROR("'%s' is not a graph file", filename.c_str());
+    }
+    const uint32_t version = reader.read<uint32_t>();
+    if(version != graph_version)
+    {
+        ARM_COMPUTE_ERROR("Unsupported version %u of graph file %s", version, filename.c_str());
+    }
+    const uint64_t num_nodes   = reader.read<uint64_t>();
+    const uint64_t data_offset = reader.read<uint64_t>();
+    if(data_offset > size || data_offset % data_alignment != 0)
+    {
+        ARM_COMPUTE_ERROR("Invalid data offset in graph file %s", filename.c_str());
+    }
+    const std::shared_ptr<uint8_t> constants(mapping.first, mapping.first.get() + data_offset);
+
+    std::vector<NodeID> nids;
+    for(uint64_t index = 0; index < num_nodes; ++index)
+    {
+        const auto        type = reader.read_enum<NodeType>();
+        const std::string name = reader.read_string();
+
+        std::vector<NodeIdxPair> inputs(reader.read<uint32_t>());
+        for(auto &input : inputs)
+        {
+            const uint32_t producer = reader.read<uint32_t>();
+            if(producer != no_producer && producer >= index)
+            {
+                ARM_COMPUTE_ERROR("Invalid input of node %s in graph file %s", name.c_str(), filename.c_str());
+            }
+            input.node_id = (producer != no_producer) ? nids[producer] : EmptyNodeID;
+            input.index   = reader.read<uint32_t>();
+            if(producer != no_producer && input.index >= g.node(input.node_id)->num_outputs())
+            {
+                ARM_COMPUTE_ERROR("Invalid input of node %s in graph file %s", name.c_str(), filename.c_str());
+            }
+        }
+
+        const NodeID nid  = deserialize_node(g, reader, type, inputs.size(), constants, size - data_offset);
+        INode       *node = g.node(nid);
+        if(node->num_inputs() != inputs.size())
+        {
+            ARM_COMPUTE_ERROR("Invalid number of inputs of node %s in graph file %s", name.c_str(), filename.c_str());
+        }
+        node->set_common_node_parameters(NodeParams{ name, target });
+
+        for(size_t idx = 0; idx < inputs.size(); ++idx)
+        {
+            if(inputs[idx].node_id != EmptyNodeID)
+            {
+                g.add_connection(inputs[idx].node_id, inputs[idx].index, nid, idx);
+            }
+        }
+        nids.push_back(nid);
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Deserialized " << num_nodes << " nodes from " << filename << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
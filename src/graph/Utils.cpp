@@ -80,6 +80,11 @@ PassManager create_default_pass_manager(Target target)
 
     if(target != Target::GC)
     {
+        pm.append(support::cpp14::make_unique<BatchNormalizationFoldingMutator>());
+        if(target == Target::NEON)
+        {
+            pm.append(support::cpp14::make_unique<DataLayoutMutator>());
+        }
         pm.append(support::cpp14::make_unique<InPlaceOperationMutator>());
         pm.append(support::cpp14::make_unique<NodeFusionMutator>());
         pm.append(support::cpp14::make_unique<SplitLayerSubTensorMutator>());
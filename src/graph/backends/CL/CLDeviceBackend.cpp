@@ -116,6 +116,11 @@ void CLDeviceBackend::setup_backend_context(GraphContext &ctx)
     }
 }
 
+void CLDeviceBackend::complete_backend_context(GraphContext &ctx)
+{
+    ARM_COMPUTE_UNUSED(ctx);
+}
+
 bool CLDeviceBackend::is_backend_supported()
 {
     return arm_compute::opencl_is_available();
@@ -167,6 +172,14 @@ arm_compute::Status CLDeviceBackend::validate_node(INode &node)
     return CLNodeValidator::validate(&node);
 }
 
+DataLayoutHint CLDeviceBackend::data_layout_hint(INode &node)
+{
+    ARM_COMPUTE_UNUSED(node);
+
+    // Nodes keep the data layout they were declared with
+    return DataLayoutHint{};
+}
+
 std::shared_ptr<arm_compute::IMemoryManager> CLDeviceBackend::create_memory_manager(MemoryManagerAffinity affinity)
 {
     if(affinity == MemoryManagerAffinity::Offset)
@@ -461,6 +461,40 @@ std::unique_ptr<IFunction> create_normalization_layer(NormalizationLayerNode &no
     return std::move(func);
 }
 
+/** Create a backend permute layer function
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend permute layer function
+ */
+std::unique_ptr<IFunction> create_permute_layer(PermuteLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Creating CL PermuteLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_ERROR_ON(node.num_inputs() != 1);
+    ARM_COMPUTE_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    ICLTensor               *input  = get_backing_tensor(node.input(0));
+    ICLTensor               *output = get_backing_tensor(node.output(0));
+    const PermutationVector &perm   = node.permutation_vector();
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<CLPermute>();
+    func->configure(input, output, perm);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated CLPermute"
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Output data layout: " << output->info()->data_layout()
+                               << std::endl);
+
+    return std::move(func);
+}
+
 /** Create a backend pooling layer function
  *
  * @param[in] node Node to create the backend function for
@@ -592,6 +626,8 @@ std::unique_ptr<IFunction> CLFunctionFactory::create(INode *node, GraphContext &
             return create_fully_connected_layer(*polymorphic_downcast<FullyConnectedLayerNode *>(node), ctx);
         case NodeType::NormalizationLayer:
             return create_normalization_layer(*polymorphic_downcast<NormalizationLayerNode *>(node));
+        case NodeType::PermuteLayer:
+            return create_permute_layer(*polymorphic_downcast<PermuteLayerNode *>(node));
         case NodeType::PoolingLayer:
             return create_pooling_layer(*polymorphic_downcast<PoolingLayerNode *>(node));
         case NodeType::ReshapeLayer:
@@ -50,6 +50,13 @@ void CLSubTensorHandle::free()
     // noop
 }
 
+bool CLSubTensorHandle::import_memory(std::shared_ptr<IMemoryRegion> memory)
+{
+    // Sub-tensors are backed by their parent
+    ARM_COMPUTE_UNUSED(memory);
+    return false;
+}
+
 void CLSubTensorHandle::manage(IMemoryGroup *mg)
 {
     ARM_COMPUTE_UNUSED(mg);
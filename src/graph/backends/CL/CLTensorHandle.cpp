@@ -48,6 +48,13 @@ void CLTensorHandle::free()
     _tensor.allocator()->free();
 }
 
+bool CLTensorHandle::import_memory(std::shared_ptr<IMemoryRegion> memory)
+{
+    // Only host memory can be imported
+    ARM_COMPUTE_UNUSED(memory);
+    return false;
+}
+
 void CLTensorHandle::manage(IMemoryGroup *mg)
 {
     if(mg != nullptr)
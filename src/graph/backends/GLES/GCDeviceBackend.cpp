@@ -78,6 +78,11 @@ void GCDeviceBackend::setup_backend_context(GraphContext &ctx)
     }
 }
 
+void GCDeviceBackend::complete_backend_context(GraphContext &ctx)
+{
+    ARM_COMPUTE_UNUSED(ctx);
+}
+
 bool GCDeviceBackend::is_backend_supported()
 {
     return arm_compute::opengles31_is_available();
@@ -126,6 +131,14 @@ arm_compute::Status GCDeviceBackend::validate_node(INode &node)
     return GCNodeValidator::validate(&node);
 }
 
+DataLayoutHint GCDeviceBackend::data_layout_hint(INode &node)
+{
+    ARM_COMPUTE_UNUSED(node);
+
+    // Nodes keep the data layout they were declared with
+    return DataLayoutHint{};
+}
+
 std::shared_ptr<arm_compute::IMemoryManager> GCDeviceBackend::create_memory_manager(MemoryManagerAffinity affinity)
 {
     if(affinity == MemoryManagerAffinity::Offset)
@@ -78,6 +78,8 @@ Status validate_convolution_layer(ConvolutionLayerNode &node)
     const PadStrideInfo       conv_info      = node.convolution_info();
     const ConvolutionMethod   conv_algorithm = node.convolution_method();
 
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.num_groups() != 1, "Grouped convolutions must be split into a convolution per group");
+
     // Validate function
     if(conv_algorithm == ConvolutionMethod::DIRECT)
     {
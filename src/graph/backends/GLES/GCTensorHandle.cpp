@@ -48,6 +48,13 @@ void GCTensorHandle::free()
     _tensor.allocator()->free();
 }
 
+bool GCTensorHandle::import_memory(std::shared_ptr<IMemoryRegion> memory)
+{
+    // Only host memory can be imported
+    ARM_COMPUTE_UNUSED(memory);
+    return false;
+}
+
 void GCTensorHandle::manage(IMemoryGroup *mg)
 {
     if(mg != nullptr)
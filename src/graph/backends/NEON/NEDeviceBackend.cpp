@@ -35,6 +35,7 @@
 #include "arm_compute/graph/backends/NEON/NETensorHandle.h"
 
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Cast.h"
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
@@ -45,22 +46,77 @@
 
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
+#include <fstream>
+
 namespace arm_compute
 {
 namespace graph
 {
 namespace backends
 {
+namespace
+{
+bool file_exists(const std::string &filename)
+{
+    std::ifstream file(filename);
+    return file.good();
+}
+
+/** Installs a packed weights cache in the scheduler of the calling thread and restores the previous one when going out of scope */
+class WeightsCacheScope final
+{
+public:
+    WeightsCacheScope(NEPackedWeightsCache *cache)
+        : _scheduler(Scheduler::get()), _previous_cache(_scheduler.weights_cache())
+    {
+        _scheduler.set_weights_cache(cache);
+    }
+    ~WeightsCacheScope()
+    {
+        _scheduler.set_weights_cache(_previous_cache);
+    }
+
+private:
+    IScheduler           &_scheduler;
+    NEPackedWeightsCache *_previous_cache;
+};
+} // namespace
+
 /** Register NEON backend */
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
+/** GEMM tuner export file */
+static const std::string gemm_tuner_data_filename = "acl_gemm_tuner.csv";
+
 NEDeviceBackend::NEDeviceBackend()
-    : _allocator()
+    : _gemm_tuner(false), _weights_cache(), _weights_cache_file(), _allocator(), _arena(&_allocator)
+{
+}
+
+NEDeviceBackend::~NEDeviceBackend()
+{
+    if(_gemm_tuner.tune_new_gemms() && !_gemm_tuner.config_table().empty())
+    {
+        _gemm_tuner.save_to_file(gemm_tuner_data_filename);
+    }
+}
+
+void NEDeviceBackend::set_kernel_tuning(bool enable_tuning)
 {
+    _gemm_tuner.set_tune_new_gemms(enable_tuning);
 }
 
 void NEDeviceBackend::initialize_backend()
 {
+    // Load tuner data if available
+    if(_gemm_tuner.config_table().empty() && file_exists(gemm_tuner_data_filename))
+    {
+        _gemm_tuner.load_from_file(gemm_tuner_data_filename);
+    }
+
+    // Setup Scheduler
+    Scheduler::get().set_gemm_tuner(&_gemm_tuner);
 }
 
 void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
@@ -71,6 +127,25 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Setup tuner
+    set_kernel_tuning(ctx.config().use_tuner);
+
+    // Map the weights packed by previous processes, the ones packed by this graph get saved after its first run.
+    // Graphs may be using the mapped weights, so only a single file can be loaded.
+    const std::string &weights_file = ctx.config().packed_weights_file;
+    if(!weights_file.empty() && weights_file != _weights_cache_file)
+    {
+        if(!_weights_cache_file.empty())
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Packed weights already loaded from " << _weights_cache_file << ": " << weights_file << " ignored" << std::endl);
+        }
+        else if(file_exists(weights_file))
+        {
+            _weights_cache.load_from_file(weights_file);
+            _weights_cache_file = weights_file;
+        }
+    }
+
     // Create function level memory manager
     if(ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
@@ -80,10 +155,43 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         mm_ctx.cross_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
 
+        // The allocator of the backend is shared by all the graphs: the ones backed by huge pages get one of their own
+        if(ctx.config().use_huge_pages)
+        {
+            mm_ctx.allocator = std::make_shared<Allocator>(HugePagePolicy::TRANSPARENT);
+            arm_compute::utils::cast::polymorphic_downcast<MemoryManagerOnDemand *>(mm_ctx.intra_mm.get())->set_allocator(mm_ctx.allocator);
+            arm_compute::utils::cast::polymorphic_downcast<MemoryManagerOnDemand *>(mm_ctx.cross_mm.get())->set_allocator(mm_ctx.allocator);
+        }
+
+        // Concurrent branches and pipeline stages need a pool of auxiliary memory each
+        const unsigned int num_pools = std::max(ctx.config().max_concurrent_branches, ctx.config().num_pipeline_stages);
+        if(num_pools > 1)
+        {
+            arm_compute::utils::cast::polymorphic_downcast<MemoryManagerOnDemand *>(mm_ctx.intra_mm.get())->set_num_pools(num_pools);
+        }
+
+        // Lease auxiliary and transition memory from the shared arena so that graphs which
+        // do not run at the same time reuse the same backing memory.
+        // Frozen memory stays bound to the groups, so it can't be leased per execution.
+        if(ctx.config().use_memory_arena && !ctx.config().use_frozen_memory)
+        {
+            arm_compute::utils::cast::polymorphic_downcast<MemoryManagerOnDemand *>(mm_ctx.intra_mm.get())->set_arena(&_arena);
+            arm_compute::utils::cast::polymorphic_downcast<MemoryManagerOnDemand *>(mm_ctx.cross_mm.get())->set_arena(&_arena);
+        }
+
         ctx.insert_memory_management_ctx(std::move(mm_ctx));
     }
 }
 
+void NEDeviceBackend::complete_backend_context(GraphContext &ctx)
+{
+    // Save the weights packed by the first run for the next processes
+    if(!ctx.config().packed_weights_file.empty() && _weights_cache.has_new_entries())
+    {
+        _weights_cache.save_to_file(ctx.config().packed_weights_file);
+    }
+}
+
 bool NEDeviceBackend::is_backend_supported()
 {
     return true;
@@ -123,6 +231,12 @@ std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &n
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring NEON node with ID : " << node.id() << std::endl);
     ARM_COMPUTE_ERROR_ON(node.assigned_target() != Target::NEON);
 
+    // The assembly GEMMs pick the packed weights cache up from the scheduler when configured:
+    // only expose it to the nodes of the graphs sharing their packed weights.
+    // Graphs sharing the cache reuse the weights packed by the graphs still alive.
+    const bool        use_weights_cache = ctx.config().share_packed_weights || !ctx.config().packed_weights_file.empty();
+    WeightsCacheScope weights_cache_scope(use_weights_cache ? &_weights_cache : nullptr);
+
     // Configure node
     return NEFunctionFactory::create(&node, ctx);
 }
@@ -135,6 +249,13 @@ arm_compute::Status NEDeviceBackend::validate_node(INode &node)
     return NENodeValidator::validate(&node);
 }
 
+DataLayoutHint NEDeviceBackend::data_layout_hint(INode &node)
+{
+    ARM_COMPUTE_ERROR_ON(node.assigned_target() != Target::NEON);
+
+    return NENodeValidator::data_layout_hint(&node);
+}
+
 std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_manager(MemoryManagerAffinity affinity)
 {
     std::shared_ptr<ILifetimeManager> lifetime_mgr = nullptr;
@@ -149,32 +149,43 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
         biases->info()->set_data_type(DataType::S32);
     }
 
-    const PadStrideInfo     conv_info      = node.convolution_info();
-    const ConvolutionMethod conv_algorithm = node.convolution_method();
+    const PadStrideInfo       conv_info      = node.convolution_info();
+    const ConvolutionMethod   conv_algorithm = node.convolution_method();
+    const ActivationLayerInfo fused_act      = node.fused_activation();
 
     // Create and configure function (we assume that functions have been validated before creation)
     std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, Target::NEON);
     std::unique_ptr<IFunction>      func;
     std::string                     func_name;
-    if(conv_algorithm == ConvolutionMethod::DIRECT)
+    if(node.num_groups() > 1)
+    {
+        std::tie(func, func_name) = create_named_memory_managed_function<NEGroupedConvolutionLayer>(std::string("NEGroupedConvolutionLayer"), mm,
+                                                                                                    input, weights, biases, output, conv_info, node.num_groups(), fused_act);
+    }
+    else if(conv_algorithm == ConvolutionMethod::DIRECT)
     {
         std::tie(func, func_name) = create_named_memory_managed_function<NEDirectConvolutionLayer>(std::string("NEDirectConvolutionLayer"), mm,
-                                                                                                   input, weights, biases, output, conv_info);
+                                                                                                   input, weights, biases, output, conv_info, fused_act);
     }
     else if(conv_algorithm == ConvolutionMethod::GEMM)
     {
         std::tie(func, func_name) = create_named_memory_managed_function<NEGEMMConvolutionLayer>(std::string("NEGEMMConvolutionLayer"), mm,
-                                                                                                 input, weights, biases, output, conv_info);
+                                                                                                 input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act);
     }
     else if(conv_algorithm == ConvolutionMethod::WINOGRAD)
     {
         std::tie(func, func_name) = create_named_memory_managed_function<NEWinogradConvolutionLayer>(std::string("NEWinogradConvolutionLayer"), mm,
-                                                                                                     input, weights, biases, output, conv_info);
+                                                                                                     input, weights, biases, output, conv_info, fused_act);
+    }
+    else if(conv_algorithm == ConvolutionMethod::IMPLICIT_GEMM)
+    {
+        std::tie(func, func_name) = create_named_memory_managed_function<NEImplicitGEMMConvolutionLayer>(std::string("NEImplicitGEMMConvolutionLayer"), mm,
+                                                                                                         input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act);
     }
     else
     {
         std::tie(func, func_name) = create_named_memory_managed_function<NEConvolutionLayer>(std::string("NEConvolutionLayer"), mm,
-                                                                                             input, weights, biases, output, conv_info);
+                                                                                             input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act);
     }
 
     // Log info
@@ -185,6 +196,8 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
                                << " Input shape: " << input->info()->tensor_shape()
                                << " Weights shape: " << weights->info()->tensor_shape()
                                << " Output shape: " << output->info()->tensor_shape()
+                               << (node.num_groups() > 1 ? " Groups: " + support::cpp11::to_string(node.num_groups()) : "")
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
                                << std::endl);
     return func;
 }
@@ -253,6 +266,7 @@ std::unique_ptr<IFunction> create_depthwise_convolution_layer(DepthwiseConvoluti
 
     const PadStrideInfo              conv_info     = node.convolution_info();
     const DepthwiseConvolutionMethod dwc_algorithm = node.depthwise_convolution_method();
+    const ActivationLayerInfo        fused_act     = node.fused_activation();
 
     // Create and configure function (we assume that functions have been validated before creation)
     std::unique_ptr<IFunction> func;
@@ -260,12 +274,12 @@ std::unique_ptr<IFunction> create_depthwise_convolution_layer(DepthwiseConvoluti
     if(dwc_algorithm == DepthwiseConvolutionMethod::OPTIMIZED_3x3)
     {
         std::tie(func, func_name) = create_named_function<NEDepthwiseConvolutionLayer3x3>(std::string("NEDepthwiseConvolutionLayer3x3"),
-                                                                                          input, weights, biases, output, conv_info);
+                                                                                          input, weights, biases, output, conv_info, 1U, fused_act);
     }
     else
     {
         std::tie(func, func_name) = create_named_function<NEDepthwiseConvolutionLayer>(std::string("NEDepthwiseConvolutionLayer"),
-                                                                                       input, weights, biases, output, conv_info);
+                                                                                       input, weights, biases, output, conv_info, 1U, fused_act);
     }
 
     // Log info
@@ -276,6 +290,7 @@ std::unique_ptr<IFunction> create_depthwise_convolution_layer(DepthwiseConvoluti
                                << " Input shape: " << input->info()->tensor_shape()
                                << " Weights shape: " << weights->info()->tensor_shape()
                                << " Output shape: " << output->info()->tensor_shape()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
                                << std::endl);
     return func;
 }
@@ -384,9 +399,11 @@ std::unique_ptr<IFunction> create_fully_connected_layer(FullyConnectedLayerNode
     ITensor *biases  = get_backing_tensor(node.input(2));
     ITensor *output  = get_backing_tensor(node.output(0));
 
+    const ActivationLayerInfo fused_act = node.fused_activation();
+
     // Create and configure function
     auto func = support::cpp14::make_unique<NEFullyConnectedLayer>(get_memory_manager(ctx, Target::NEON));
-    func->configure(input, weights, biases, output);
+    func->configure(input, weights, biases, output, true /* transpose_weights */, false /* are_weights_reshaped */, fused_act);
     ARM_COMPUTE_ERROR_ON(input == nullptr);
     ARM_COMPUTE_ERROR_ON(weights == nullptr);
     ARM_COMPUTE_ERROR_ON(output == nullptr);
@@ -397,6 +414,7 @@ std::unique_ptr<IFunction> create_fully_connected_layer(FullyConnectedLayerNode
                                << " Input shape: " << input->info()->tensor_shape()
                                << " Weights shape: " << weights->info()->tensor_shape()
                                << " Output shape: " << output->info()->tensor_shape()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
                                << std::endl);
 
     return std::move(func);
@@ -436,6 +454,40 @@ std::unique_ptr<IFunction> create_normalization_layer(NormalizationLayerNode &no
     return std::move(func);
 }
 
+/** Create a backend permute layer function
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend permute layer function
+ */
+std::unique_ptr<IFunction> create_permute_layer(PermuteLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Creating NEON PermuteLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_ERROR_ON(node.num_inputs() != 1);
+    ARM_COMPUTE_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    ITensor                 *input  = get_backing_tensor(node.input(0));
+    ITensor                 *output = get_backing_tensor(node.output(0));
+    const PermutationVector &perm   = node.permutation_vector();
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<NEPermute>();
+    func->configure(input, output, perm);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated NEPermute"
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Output data layout: " << output->info()->data_layout()
+                               << std::endl);
+
+    return std::move(func);
+}
+
 /** Create a backend pooling layer function
  *
  * @param[in] node Node to create the backend function for
@@ -564,6 +616,8 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return create_fully_connected_layer(*polymorphic_downcast<FullyConnectedLayerNode *>(node), ctx);
         case NodeType::NormalizationLayer:
             return create_normalization_layer(*polymorphic_downcast<NormalizationLayerNode *>(node), ctx);
+        case NodeType::PermuteLayer:
+            return create_permute_layer(*polymorphic_downcast<PermuteLayerNode *>(node));
         case NodeType::PoolingLayer:
             return create_pooling_layer(*polymorphic_downcast<PoolingLayerNode *>(node));
         case NodeType::ReshapeLayer:
@@ -26,6 +26,8 @@
 #include "arm_compute/graph/backends/ValidateHelpers.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/NEDepthwiseConvolutionLayer3x3Kernel.h"
 #include "arm_compute/core/utils/misc/Cast.h"
 #include "arm_compute/runtime/NEON/NEFunctions.h"
 
@@ -37,6 +39,119 @@ namespace graph
 {
 namespace backends
 {
+namespace
+{
+/** Creates the backend info of a graph tensor
+ *
+ * @param[in] tensor Graph tensor
+ * @param[in] layout Data layout of the info, the shape of an NCHW tensor is permuted if NHWC
+ *
+ * @return The tensor info
+ */
+TensorInfo make_tensor_info(const Tensor *tensor, DataLayout layout)
+{
+    const TensorDescriptor &desc  = tensor->desc();
+    TensorShape             shape = desc.shape;
+    if(desc.layout == DataLayout::NCHW && layout == DataLayout::NHWC)
+    {
+        permute(shape, PermutationVector(2U, 0U, 1U));
+    }
+
+    TensorInfo info(shape, 1, desc.data_type, desc.quant_info);
+    info.set_data_layout(layout);
+    return info;
+}
+
+DataLayoutHint convolution_layout_hint(ConvolutionLayerNode &node)
+{
+    DataLayoutHint hint;
+
+    // Winograd and direct convolutions only run in NCHW, the implicit GEMM gathers NHWC inputs element by element
+    const ConvolutionMethod method = node.convolution_method();
+    if(node.num_groups() != 1 || (method != ConvolutionMethod::DEFAULT && method != ConvolutionMethod::GEMM))
+    {
+        return hint;
+    }
+
+    const Tensor       *bias_tensor = node.input(2);
+    const TensorInfo    input       = make_tensor_info(node.input(0), DataLayout::NHWC);
+    const TensorInfo    weights     = make_tensor_info(node.input(1), DataLayout::NHWC);
+    const TensorInfo    output      = make_tensor_info(node.output(0), DataLayout::NHWC);
+    const TensorInfo    biases      = (bias_tensor != nullptr) ? make_tensor_info(bias_tensor, bias_tensor->desc().layout) : TensorInfo();
+    const ITensorInfo  *biases_ptr  = (bias_tensor != nullptr) ? &biases : nullptr;
+    const PadStrideInfo conv_info   = node.convolution_info();
+    const bool          fast_math   = node.fast_math_hint() == FastMathHint::ENABLED;
+
+    const Status status = (method == ConvolutionMethod::GEMM) ? NEGEMMConvolutionLayer::validate(&input, &weights, biases_ptr, &output, conv_info) :
+                          NEConvolutionLayer::validate(&input, &weights, biases_ptr, &output, conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), fast_math);
+    if(!bool(status))
+    {
+        return hint;
+    }
+    hint.supports_nhwc = true;
+
+    // NHWC saves the output reshape of the GEMM, and the input reshape of the 1x1 convolutions too.
+    // Winograd convolutions are faster than the GEMM based ones NHWC would fall back to.
+    const TensorInfo                     nchw_input   = make_tensor_info(node.input(0), DataLayout::NCHW);
+    const TensorInfo                     nchw_weights = make_tensor_info(node.input(1), DataLayout::NCHW);
+    const TensorInfo                     nchw_output  = make_tensor_info(node.output(0), DataLayout::NCHW);
+    const arm_compute::ConvolutionMethod nchw_method  = NEConvolutionLayer::get_convolution_method(&nchw_input, &nchw_weights, &nchw_output, conv_info,
+                                                                                                   WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), fast_math);
+    if(method == ConvolutionMethod::DEFAULT && nchw_method == arm_compute::ConvolutionMethod::WINOGRAD)
+    {
+        hint.nhwc_gain = -2;
+    }
+    else
+    {
+        hint.nhwc_gain = (nchw_weights.dimension(0) == 1 && nchw_weights.dimension(1) == 1) ? 2 : 1;
+    }
+
+    return hint;
+}
+
+DataLayoutHint depthwise_convolution_layout_hint(DepthwiseConvolutionLayerNode &node)
+{
+    DataLayoutHint hint;
+
+    // Only the optimized 3x3 depthwise convolution runs in NHWC
+    const TensorDescriptor &weights_desc = node.input(1)->desc();
+    const TensorInfo        input        = make_tensor_info(node.input(0), DataLayout::NHWC);
+    if(weights_desc.shape[0] != 3 || weights_desc.shape[1] != 3
+       || !NEDepthwiseConvolutionLayer3x3Kernel::is_optimized_execution_possible(input.tensor_shape(), node.convolution_info(), input.data_type(), 1, DataLayout::NHWC))
+    {
+        return hint;
+    }
+    hint.supports_nhwc = true;
+
+    // In NCHW the optimized function permutes its input, weights and output, the generic one is much slower
+    hint.nhwc_gain = (node.depthwise_convolution_method() == DepthwiseConvolutionMethod::OPTIMIZED_3x3) ? 2 : 3;
+
+    return hint;
+}
+
+DataLayoutHint batch_normalization_layout_hint(BatchNormalizationLayerNode &node)
+{
+    const TensorInfo input  = make_tensor_info(node.input(0), DataLayout::NHWC);
+    const TensorInfo output = make_tensor_info(node.output(0), DataLayout::NHWC);
+    const TensorInfo mean   = make_tensor_info(node.input(1), node.input(1)->desc().layout);
+    const TensorInfo var    = make_tensor_info(node.input(2), node.input(2)->desc().layout);
+
+    DataLayoutHint hint;
+    hint.supports_nhwc = bool(NEBatchNormalizationLayer::validate(&input, &output, &mean, &var, nullptr, nullptr, node.epsilon(), node.fused_activation()));
+    return hint;
+}
+
+DataLayoutHint pooling_layout_hint(PoolingLayerNode &node)
+{
+    const TensorInfo input  = make_tensor_info(node.input(0), DataLayout::NHWC);
+    const TensorInfo output = make_tensor_info(node.output(0), DataLayout::NHWC);
+
+    DataLayoutHint hint;
+    hint.supports_nhwc = bool(NEPoolingLayer::validate(&input, &output, node.pooling_info()));
+    return hint;
+}
+} // namespace
+
 Status NENodeValidator::validate(INode *node)
 {
     if(node == nullptr)
@@ -48,10 +163,15 @@ Status NENodeValidator::validate(INode *node)
     switch(type)
     {
         case NodeType::ConvolutionLayer:
+            if(polymorphic_downcast<ConvolutionLayerNode *>(node)->num_groups() > 1)
+            {
+                return detail::validate_grouped_convolution_layer<NEGroupedConvolutionLayer>(*polymorphic_downcast<ConvolutionLayerNode *>(node));
+            }
             return detail::validate_convolution_layer<NEConvolutionLayer,
                    NEDirectConvolutionLayer,
                    NEGEMMConvolutionLayer,
-                   NEWinogradConvolutionLayer>(*polymorphic_downcast<ConvolutionLayerNode *>(node));
+                   NEWinogradConvolutionLayer,
+                   NEImplicitGEMMConvolutionLayer>(*polymorphic_downcast<ConvolutionLayerNode *>(node));
         case NodeType::DepthwiseConvolutionLayer:
             return detail::validate_depthwise_convolution_layer<NEDepthwiseConvolutionLayer,
                    NEDepthwiseConvolutionLayer3x3>(*polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node));
@@ -60,6 +180,39 @@ Status NENodeValidator::validate(INode *node)
             return Status{};
     }
 }
+
+DataLayoutHint NENodeValidator::data_layout_hint(INode *node)
+{
+    // Only the F32 NCHW nodes can be switched to NHWC
+    if(node == nullptr || node->num_inputs() == 0 || node->input(0) == nullptr || node->num_outputs() == 0 || node->output(0) == nullptr
+       || node->input(0)->desc().layout != DataLayout::NCHW || node->input(0)->desc().data_type != DataType::F32)
+    {
+        return DataLayoutHint{};
+    }
+
+    NodeType type = node->type();
+    switch(type)
+    {
+        case NodeType::ConvolutionLayer:
+            return convolution_layout_hint(*polymorphic_downcast<ConvolutionLayerNode *>(node));
+        case NodeType::DepthwiseConvolutionLayer:
+            return depthwise_convolution_layout_hint(*polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node));
+        case NodeType::BatchNormalizationLayer:
+            return batch_normalization_layout_hint(*polymorphic_downcast<BatchNormalizationLayerNode *>(node));
+        case NodeType::PoolingLayer:
+            return pooling_layout_hint(*polymorphic_downcast<PoolingLayerNode *>(node));
+        case NodeType::ActivationLayer:
+        case NodeType::EltwiseLayer:
+        {
+            // Element-wise operations run on any data layout
+            DataLayoutHint hint;
+            hint.supports_nhwc = true;
+            return hint;
+        }
+        default:
+            return DataLayoutHint{};
+    }
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
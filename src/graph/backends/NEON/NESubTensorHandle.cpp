@@ -47,6 +47,13 @@ void NESubTensorHandle::free()
     // noop
 }
 
+bool NESubTensorHandle::import_memory(std::shared_ptr<IMemoryRegion> memory)
+{
+    // Sub-tensors are backed by their parent
+    ARM_COMPUTE_UNUSED(memory);
+    return false;
+}
+
 void NESubTensorHandle::manage(IMemoryGroup *mg)
 {
     ARM_COMPUTE_UNUSED(mg);
@@ -48,6 +48,11 @@ void NETensorHandle::free()
     _tensor.allocator()->free();
 }
 
+bool NETensorHandle::import_memory(std::shared_ptr<IMemoryRegion> memory)
+{
+    return bool(_tensor.allocator()->import_memory(Memory(std::move(memory))));
+}
+
 void NETensorHandle::manage(IMemoryGroup *mg)
 {
     if(mg != nullptr)
@@ -29,13 +29,16 @@
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/Workload.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
 
 #include <algorithm>
 #include <map>
+#include <set>
 
 namespace arm_compute
 {
@@ -48,12 +51,14 @@ namespace
 using HandleCountPair     = std::pair<ITensorHandle *, unsigned int>;
 using HandleCounter       = std::map<HandleCountPair::first_type, HandleCountPair::second_type>;
 using TargetHandleCounter = std::map<Target, HandleCounter>;
+using HandleLifetimes     = std::map<ITensorHandle *, std::pair<unsigned int, unsigned int>>;
 
 /** Holds managed IO tensor handles if a task */
 struct TaskHandles
 {
     std::vector<std::pair<ITensorHandle *, IMemoryGroup *>> input_handles  = {}; /**< Input handles to a task */
     std::vector<std::pair<ITensorHandle *, IMemoryGroup *>> output_handles = {}; /**< Output handles of a task */
+    std::vector<NodeID>                                     nodes          = {}; /**< Nodes executed by the task */
 };
 
 /** Returns memory group depending on handle backend type
@@ -124,6 +129,7 @@ TaskHandles get_transition_handles(GraphContext                    &ctx,
     INode &node = *task.node;
 
     TaskHandles transition_handles;
+    transition_handles.nodes.push_back(node.id());
 
     // Add input handles
     for(unsigned int i = 0; i < node.input_edges().size(); ++i)
@@ -181,9 +187,12 @@ void count_input_handles_per_target(const TaskHandles &task_handles, TargetHandl
  *
  * @param[in, out] tasks_handles Tensor handles for each task
  * @param[in]      hc            Data structure that keeps the handles reference count
+ * @param[out]     lifetimes     First and last step at which each handle is used
  */
-void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const HandleCounter &hc)
+void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const HandleCounter &hc, HandleLifetimes &lifetimes)
 {
+    unsigned int step = 0;
+
     // Identify max number of tensors in flight
     HandleCounter tensors_in_flight;
 
@@ -202,6 +211,7 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
                 tensors_in_flight.insert(std::make_pair(parent_handle, hc.at(parent_handle)));
                 // Start of allocation's lifetime
                 parent_handle->manage(handle.second);
+                lifetimes[parent_handle] = std::make_pair(step, step);
             }
         }
     };
@@ -225,8 +235,94 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
                 tensors_in_flight.erase(ihandle);
                 // End of allocation's lifetime
                 ihandle->allocate();
+                lifetimes[ihandle].second = step;
+            }
+        }
+        ++step;
+    }
+}
+
+/** Fills the transition part of the memory plan of a workload
+ *
+ * @param[in]  g             Graph
+ * @param[in]  ctx           Graph context
+ * @param[in]  tasks_handles Tensor handles for each lifetime step
+ * @param[in]  lifetimes     First and last step at which each handle is used
+ * @param[out] plan          Memory plan to fill
+ */
+void fill_transition_memory_plan(Graph &g, GraphContext &ctx, const std::vector<TaskHandles> &tasks_handles, const HandleLifetimes &lifetimes, MemoryPlan &plan)
+{
+    for(const auto &task_handles : tasks_handles)
+    {
+        plan.steps.push_back(task_handles.nodes);
+    }
+
+    std::set<IMemoryGroup *> groups;
+    for(const auto &lifetime : lifetimes)
+    {
+        ITensorHandle *handle = lifetime.first;
+
+        TransitionMemoryPlan transition;
+        transition.target = handle->target();
+        transition.start  = lifetime.second.first;
+        transition.end    = lifetime.second.second;
+        transition.size   = handle->tensor().info()->total_size();
+        for(const auto &tensor : g.tensors())
+        {
+            if(tensor != nullptr && tensor->handle() != nullptr && tensor->handle()->parent_handle() == handle)
+            {
+                transition.tensors.push_back(tensor->id());
+            }
+        }
+
+        // Look up the memory assigned by the lifetime manager
+        MemoryManagerContext *mm_ctx = ctx.memory_management_ctx(handle->target());
+        if(mm_ctx != nullptr && mm_ctx->cross_mm != nullptr)
+        {
+            auto *lifetime_mgr = dynamic_cast<ISimpleLifetimeManager *>(mm_ctx->cross_mm->lifetime_manager());
+            if(lifetime_mgr != nullptr)
+            {
+                transition.mapping_type = lifetime_mgr->mapping_type();
+                lifetime_mgr->find_mapping(mm_ctx->cross_group.get(), &handle->tensor(), transition.mapping, transition.size);
+
+                // Account for the memory of each transition group once
+                if(groups.insert(mm_ctx->cross_group.get()).second)
+                {
+                    for(const auto &footprint : lifetime_mgr->footprints())
+                    {
+                        if(footprint.group == mm_ctx->cross_group.get())
+                        {
+                            plan.transition_peak += footprint.size;
+                        }
+                    }
+                }
+            }
+        }
+
+        plan.transitions.push_back(std::move(transition));
+    }
+
+    std::sort(std::begin(plan.transitions), std::end(plan.transitions), [](const TransitionMemoryPlan & a, const TransitionMemoryPlan & b)
+    {
+        return (a.start != b.start) ? (a.start < b.start) : (a.tensors < b.tensors);
+    });
+
+    // Find the step with the most transition memory in use
+    for(unsigned int step = 0; step < plan.steps.size(); ++step)
+    {
+        size_t step_size = 0;
+        for(const auto &transition : plan.transitions)
+        {
+            if(transition.start <= step && step <= transition.end)
+            {
+                step_size += transition.size;
             }
         }
+        if(step_size > plan.peak_step_size)
+        {
+            plan.peak_step      = step;
+            plan.peak_step_size = step_size;
+        }
     }
 }
 } // namespace
@@ -249,7 +345,41 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
         count_input_handles_per_target(tasks_handles.back(), target_handle_count);
     }
 
+    // The tasks of the concurrent branches of a segment are seen as a single task,
+    // so that none of their transition buffers share memory
+    if(!workload.segments.empty())
+    {
+        std::vector<TaskHandles> segments_handles;
+        for(auto &segment : workload.segments)
+        {
+            if(segment.branches.size() > 1)
+            {
+                TaskHandles segment_handles;
+                for(auto &branch : segment.branches)
+                {
+                    for(auto task_id : branch)
+                    {
+                        auto &task_handles = tasks_handles[task_id];
+                        segment_handles.input_handles.insert(std::end(segment_handles.input_handles), std::begin(task_handles.input_handles), std::end(task_handles.input_handles));
+                        segment_handles.output_handles.insert(std::end(segment_handles.output_handles), std::begin(task_handles.output_handles), std::end(task_handles.output_handles));
+                        segment_handles.nodes.insert(std::end(segment_handles.nodes), std::begin(task_handles.nodes), std::end(task_handles.nodes));
+                    }
+                }
+                segments_handles.push_back(std::move(segment_handles));
+            }
+            else
+            {
+                for(auto task_id : segment.branches.front())
+                {
+                    segments_handles.push_back(std::move(tasks_handles[task_id]));
+                }
+            }
+        }
+        tasks_handles = std::move(segments_handles);
+    }
+
     // Setup memory managers
+    HandleLifetimes lifetimes;
     for(auto &hc : target_handle_count)
     {
         MemoryManagerContext *mm_ctx = ctx.memory_management_ctx(hc.first);
@@ -258,10 +388,15 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
             if(mm_ctx->cross_mm != nullptr && mm_ctx->cross_group != nullptr)
             {
                 // Manage and allocate tensors
-                configure_handle_lifetime(tasks_handles, hc.second);
+                configure_handle_lifetime(tasks_handles, hc.second, lifetimes);
             }
         }
     }
+
+    // Expose the resulting plan
+    workload.memory_plan.transitions.clear();
+    workload.memory_plan.steps.clear();
+    fill_transition_memory_plan(g, ctx, tasks_handles, lifetimes, workload.memory_plan);
 }
 } // namespace detail
 } // namespace graph
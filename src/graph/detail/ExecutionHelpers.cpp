@@ -27,7 +27,19 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/detail/ParallelBranchExecutor.h"
+
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IPoolManager.h"
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
 
 namespace arm_compute
 {
@@ -35,6 +47,100 @@ namespace graph
 {
 namespace detail
 {
+namespace
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+/** Collects the indexed nodes a node depends on, looking through the nodes which aren't indexed
+ *
+ * @param[in]      node          Node to inspect
+ * @param[in]      node_to_index Index of the indexed nodes
+ * @param[in, out] cache         Dependencies of the nodes already inspected
+ *
+ * @return Indices of the nodes the node depends on
+ */
+const std::set<unsigned int> &get_node_dependencies(const INode &node, const std::map<NodeID, unsigned int> &node_to_index, std::map<NodeID, std::set<unsigned int>> &cache)
+{
+    auto it = cache.find(node.id());
+    if(it != std::end(cache))
+    {
+        return it->second;
+    }
+
+    std::set<unsigned int> deps;
+    for(const auto &eid : node.input_edges())
+    {
+        const Edge *edge = node.graph()->edge(eid);
+        if(edge != nullptr && edge->producer() != nullptr)
+        {
+            const INode *producer = edge->producer();
+            auto         index_it = node_to_index.find(producer->id());
+            if(index_it != std::end(node_to_index))
+            {
+                deps.insert(index_it->second);
+            }
+            else
+            {
+                const auto &producer_deps = get_node_dependencies(*producer, node_to_index, cache);
+                deps.insert(std::begin(producer_deps), std::end(producer_deps));
+            }
+        }
+    }
+
+    return cache.emplace(node.id(), std::move(deps)).first->second;
+}
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+/** Returns the function level lifetime manager of a target if it can report memory footprints
+ *
+ * @param[in] ctx    Graph context
+ * @param[in] target Target
+ *
+ * @return Lifetime manager, nullptr if not available
+ */
+ISimpleLifetimeManager *get_intra_lifetime_manager(GraphContext &ctx, Target target)
+{
+    MemoryManagerContext *mm_ctx = ctx.memory_management_ctx(target);
+    if(mm_ctx == nullptr || mm_ctx->intra_mm == nullptr)
+    {
+        return nullptr;
+    }
+    return dynamic_cast<ISimpleLifetimeManager *>(mm_ctx->intra_mm->lifetime_manager());
+}
+
+/** Installs a scheduler on the calling thread for the lifetime of the object */
+class ThreadLocalSchedulerScope final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] scheduler Scheduler to install. If nullptr the scheduler of the calling thread is left untouched.
+     */
+    explicit ThreadLocalSchedulerScope(IScheduler *scheduler)
+        : _is_installed(scheduler != nullptr)
+    {
+        if(_is_installed)
+        {
+            Scheduler::set_thread_local(scheduler);
+        }
+    }
+    /** Prevent instances of this class from being copied */
+    ThreadLocalSchedulerScope(const ThreadLocalSchedulerScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    ThreadLocalSchedulerScope &operator=(const ThreadLocalSchedulerScope &) = delete;
+    /** Destructor: goes back to the active scheduler */
+    ~ThreadLocalSchedulerScope()
+    {
+        if(_is_installed)
+        {
+            Scheduler::set_thread_local(nullptr);
+        }
+    }
+
+private:
+    bool _is_installed;
+};
+} // namespace
+
 void default_initialize_backends()
 {
     for(const auto &backend : backends::BackendRegistry::get().backends())
@@ -45,11 +151,10 @@ void default_initialize_backends()
 
 void validate_all_nodes(Graph &g)
 {
-    auto &nodes = g.nodes();
-
-    // Create tasks
-    for(auto &node : nodes)
+    // Create tasks in execution order, the mutating passes may have added nodes consumed by nodes with smaller IDs
+    for(auto &nid : topological_sort(g))
     {
+        INode *node = g.node(nid);
         if(node != nullptr)
         {
             Target assigned_target = node->assigned_target();
@@ -67,7 +172,7 @@ void configure_all_tensors(Graph &g)
 
     for(auto &tensor : tensors)
     {
-        if(tensor)
+        if(tensor && tensor->handle() == nullptr)
         {
             Target target  = tensor->desc().target;
             auto   backend = backends::BackendRegistry::get().find_backend(target);
@@ -105,6 +210,29 @@ void allocate_all_output_tensors(INode &node)
     }
 }
 
+void import_or_allocate_const_tensor(INode &node)
+{
+    Tensor *tensor = node.output(0);
+    if(tensor == nullptr || tensor->bound_edges().empty())
+    {
+        return;
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(!tensor->handle(), "Tensor handle is not configured!");
+
+    // Back the constant with the memory its accessor already holds the data in, if any
+    ITensorHandle   *handle   = tensor->handle();
+    ITensorAccessor *accessor = tensor->accessor();
+    if(accessor != nullptr)
+    {
+        std::shared_ptr<IMemoryRegion> memory = accessor->importable_memory(*handle->tensor().info());
+        if(memory != nullptr && handle->import_memory(std::move(memory)))
+        {
+            return;
+        }
+    }
+    handle->allocate();
+}
+
 void allocate_const_tensors(Graph &g)
 {
     for(auto &node : g.nodes())
@@ -114,6 +242,8 @@ void allocate_const_tensors(Graph &g)
             switch(node->type())
             {
                 case NodeType::Const:
+                    import_or_allocate_const_tensor(*node);
+                    break;
                 case NodeType::Input:
                     allocate_all_output_tensors(*node);
                     break;
@@ -139,35 +269,56 @@ void allocate_all_tensors(Graph &g)
     }
 }
 
-ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx)
+ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<IScheduler *> &node_schedulers)
 {
     ExecutionWorkload workload;
     workload.graph = &g;
     workload.ctx   = &ctx;
 
-    auto &nodes = g.nodes();
-
-    // Create tasks
-    for(auto &node : nodes)
+    // Create tasks in execution order, the mutating passes may have added nodes consumed by nodes with smaller IDs
+    for(auto &nid : topological_sort(g))
     {
+        INode *node = g.node(nid);
         if(node != nullptr)
         {
             Target assigned_target = node->assigned_target();
             auto   backend         = backends::BackendRegistry::get().find_backend(assigned_target);
             ARM_COMPUTE_ERROR_ON_MSG(!backend, "Requested backend doesn't exist!");
-            auto func = backend->configure_node(*node, ctx);
+
+            // Keep track of the auxiliary memory the function requires
+            ISimpleLifetimeManager *lifetime_mgr   = get_intra_lifetime_manager(ctx, assigned_target);
+            const size_t            num_footprints = (lifetime_mgr != nullptr) ? lifetime_mgr->footprints().size() : 0;
+
+            std::unique_ptr<IFunction> func;
+            {
+                // The functions read the number of threads and the assembly GEMM settings from the scheduler
+                ThreadLocalSchedulerScope scheduler_scope(nid < node_schedulers.size() ? node_schedulers[nid] : nullptr);
+                func = backend->configure_node(*node, ctx);
+            }
             if(func != nullptr)
             {
                 ExecutionTask task;
                 task.task = std::move(func);
-                task.node = node.get();
+                task.node = node;
                 workload.tasks.push_back(std::move(task));
             }
+
+            if(lifetime_mgr != nullptr && lifetime_mgr->footprints().size() > num_footprints)
+            {
+                FunctionMemoryPlan function_plan;
+                function_plan.node = node->id();
+                for(auto it = std::begin(lifetime_mgr->footprints()) + num_footprints; it != std::end(lifetime_mgr->footprints()); ++it)
+                {
+                    function_plan.size += it->size;
+                }
+                workload.memory_plan.function_peak = std::max(workload.memory_plan.function_peak, function_plan.size);
+                workload.memory_plan.functions.push_back(function_plan);
+            }
         }
     }
 
     // Add inputs and outputs
-    for(auto &node : nodes)
+    for(auto &node : g.nodes())
     {
         if(node != nullptr && node->type() == NodeType::Input)
         {
@@ -225,6 +376,213 @@ void call_all_input_node_accessors(ExecutionWorkload &workload)
     }
 }
 
+std::vector<ExecutionSegment> split_execution_segments(Graph &g, unsigned int max_concurrent_branches)
+{
+    std::vector<ExecutionSegment> segments;
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+    if(max_concurrent_branches <= 1)
+    {
+        return segments;
+    }
+
+    // Only the compute nodes can create a task
+    std::vector<const INode *> nodes;
+    for(auto &nid : topological_sort(g))
+    {
+        const INode *node = g.node(nid);
+        if(node != nullptr && node->type() != NodeType::Input && node->type() != NodeType::Output && node->type() != NodeType::Const)
+        {
+            nodes.push_back(node);
+        }
+    }
+    const unsigned int num_nodes = nodes.size();
+    if(num_nodes == 0)
+    {
+        return segments;
+    }
+
+    // Build the dependencies between nodes
+    std::map<NodeID, unsigned int> node_to_index;
+    for(unsigned int i = 0; i < num_nodes; ++i)
+    {
+        node_to_index[nodes[i]->id()] = i;
+    }
+
+    std::map<NodeID, std::set<unsigned int>> cache;
+    std::vector<std::set<unsigned int>>      deps(num_nodes);
+    std::vector<unsigned int>                num_ready_consumers(num_nodes, 0);
+    for(unsigned int i = 0; i < num_nodes; ++i)
+    {
+        deps[i] = get_node_dependencies(*nodes[i], node_to_index, cache);
+        if(!deps[i].empty())
+        {
+            // Count the nodes that can start as soon as this dependency completes
+            ARM_COMPUTE_ERROR_ON_MSG(*deps[i].rbegin() >= i, "Nodes are not in topological order!");
+            ++num_ready_consumers[*deps[i].rbegin()];
+        }
+    }
+
+    // Union-find of the nodes of the current range
+    std::vector<unsigned int> parent(num_nodes);
+    auto find = [&](unsigned int id)
+    {
+        while(parent[id] != id)
+        {
+            parent[id] = parent[parent[id]];
+            id         = parent[id];
+        }
+        return id;
+    };
+
+    // Emits the nodes [begin, end) as a segment: one branch per connected component
+    auto emit_segment = [&](unsigned int begin, unsigned int end)
+    {
+        std::map<unsigned int, unsigned int> root_to_branch;
+        ExecutionSegment segment;
+        for(unsigned int i = begin; i < end; ++i)
+        {
+            const unsigned int root = find(i);
+            if(root_to_branch.find(root) == std::end(root_to_branch))
+            {
+                root_to_branch[root] = segment.branches.size();
+                segment.branches.emplace_back();
+            }
+            segment.branches[root_to_branch[root]].push_back(nodes[i]->id());
+        }
+
+        // Merge consecutive sequential segments
+        if(segment.branches.size() == 1 && !segments.empty() && segments.back().branches.size() == 1)
+        {
+            auto &branch = segments.back().branches.front();
+            branch.insert(std::end(branch), std::begin(segment.branches.front()), std::end(segment.branches.front()));
+        }
+        else if(!segment.branches.empty())
+        {
+            segments.push_back(std::move(segment));
+        }
+    };
+
+    unsigned int begin          = 0;
+    unsigned int num_components = 0;
+    for(unsigned int i = 0; i < num_nodes; ++i)
+    {
+        // A node joining several branches of the range starts a new range
+        std::set<unsigned int> roots;
+        for(auto dep : deps[i])
+        {
+            if(dep >= begin)
+            {
+                roots.insert(find(dep));
+            }
+        }
+        if(roots.size() > 1)
+        {
+            emit_segment(begin, i);
+            begin          = i;
+            num_components = 0;
+            roots.clear();
+        }
+
+        // Add the node to the range
+        parent[i] = i;
+        ++num_components;
+        for(auto root : roots)
+        {
+            parent[root] = i;
+            --num_components;
+        }
+
+        // A node forking a chain of nodes ends the range, so that its consumers start independent branches
+        if(num_ready_consumers[i] > 1 && num_components == 1)
+        {
+            emit_segment(begin, i + 1);
+            begin          = i + 1;
+            num_components = 0;
+        }
+    }
+    emit_segment(begin, num_nodes);
+
+    const bool has_parallel_segments = std::any_of(std::begin(segments), std::end(segments), [](const ExecutionSegment & segment)
+    {
+        return segment.branches.size() > 1;
+    });
+    if(!has_parallel_segments)
+    {
+        segments.clear();
+    }
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(g, max_concurrent_branches);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+    return segments;
+}
+
+void configure_execution_segments(ExecutionWorkload &workload, const std::vector<ExecutionSegment> &node_segments, std::shared_ptr<ParallelBranchExecutor> branch_executor)
+{
+    workload.segments.clear();
+    workload.branch_executor = std::move(branch_executor);
+
+    std::map<NodeID, unsigned int> node_to_task;
+    for(unsigned int i = 0; i < workload.tasks.size(); ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(workload.tasks[i].node == nullptr);
+        node_to_task[workload.tasks[i].node->id()] = i;
+    }
+
+    for(const auto &node_segment : node_segments)
+    {
+        ExecutionSegment segment;
+        bool             has_tasks = false;
+        for(const auto &node_branch : node_segment.branches)
+        {
+            segment.branches.emplace_back();
+            for(auto nid : node_branch)
+            {
+                auto it = node_to_task.find(nid);
+                if(it != std::end(node_to_task))
+                {
+                    segment.branches.back().push_back(it->second);
+                    has_tasks = true;
+                }
+            }
+        }
+        if(!has_tasks)
+        {
+            continue;
+        }
+
+        // Merge consecutive sequential segments
+        if(segment.branches.size() == 1 && !workload.segments.empty() && workload.segments.back().branches.size() == 1)
+        {
+            auto &branch = workload.segments.back().branches.front();
+            branch.insert(std::end(branch), std::begin(segment.branches.front()), std::end(segment.branches.front()));
+        }
+        else
+        {
+            workload.segments.push_back(std::move(segment));
+        }
+    }
+}
+
+void freeze_memory_managers(GraphContext &ctx)
+{
+    auto freeze = [](IMemoryManager * mm)
+    {
+        if(mm != nullptr && mm->pool_manager() != nullptr)
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(mm->pool_manager()->num_pools() != 1, "Only memory managers with a single pool can be frozen!");
+            mm->pool_manager()->freeze();
+        }
+    };
+
+    for(auto &mm_ctx : ctx.memory_managers())
+    {
+        freeze(mm_ctx.second.intra_mm.get());
+        freeze(mm_ctx.second.cross_mm.get());
+    }
+}
+
 void prepare_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
@@ -249,9 +607,32 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
-    for(auto &task : workload.tasks)
+    if(workload.segments.empty())
     {
-        task();
+        for(auto &task : workload.tasks)
+        {
+            task();
+        }
+    }
+    else
+    {
+        for(auto &segment : workload.segments)
+        {
+#if ARM_COMPUTE_CPP_SCHEDULER
+            if(segment.branches.size() > 1 && workload.branch_executor != nullptr)
+            {
+                workload.branch_executor->run(workload, segment);
+                continue;
+            }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+            for(auto &branch : segment.branches)
+            {
+                for(auto task_id : branch)
+                {
+                    workload.tasks[task_id]();
+                }
+            }
+        }
     }
 
     // Release memory for the transition buffers
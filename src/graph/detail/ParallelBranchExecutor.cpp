@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/ParallelBranchExecutor.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/graph/Workload.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+ParallelBranchExecutor::ParallelBranchExecutor(unsigned int num_branches, unsigned int num_threads)
+    : _schedulers(), _jobs(num_branches), _threads(), _workload(nullptr), _mtx(), _work_cv(), _done_cv(), _generation(0), _pending(0), _exit(false), _exception(nullptr)
+{
+    ARM_COMPUTE_ERROR_ON(num_branches == 0);
+
+    // Share the threads between the branches: each branch thread takes part in the execution of its kernels
+    const unsigned int total_threads      = (num_threads == 0) ? std::max(1u, std::thread::hardware_concurrency()) : num_threads;
+    const unsigned int threads_per_branch = std::max(1u, total_threads / num_branches);
+
+    // The functions query the assembly GEMM settings from the scheduler they are configured with
+    const IScheduler &caller_scheduler = Scheduler::get();
+    for(unsigned int i = 0; i < num_branches; ++i)
+    {
+        _schedulers.emplace_back(support::cpp14::make_unique<CPPScheduler>());
+        _schedulers.back()->set_num_threads(threads_per_branch);
+        _schedulers.back()->set_gemm_tuner(caller_scheduler.gemm_tuner());
+        _schedulers.back()->set_gemm_profiler(caller_scheduler.gemm_profiler());
+    }
+    for(unsigned int i = 0; i < num_branches; ++i)
+    {
+        _threads.emplace_back(&ParallelBranchExecutor::worker_loop, this, i);
+    }
+}
+
+ParallelBranchExecutor::~ParallelBranchExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _exit = true;
+    }
+    _work_cv.notify_all();
+    for(auto &thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+void ParallelBranchExecutor::run(ExecutionWorkload &workload, const ExecutionSegment &segment)
+{
+    // The functions query the assembly GEMM settings from the scheduler they run on
+    const IScheduler &caller_scheduler = Scheduler::get();
+    for(auto &scheduler : _schedulers)
+    {
+        scheduler->set_gemm_tuner(caller_scheduler.gemm_tuner());
+        scheduler->set_weights_cache(caller_scheduler.weights_cache());
+        scheduler->set_gemm_profiler(caller_scheduler.gemm_profiler());
+    }
+
+    std::unique_lock<std::mutex> lock(_mtx);
+
+    // Assign the branches to the threads
+    const unsigned int num_threads = _threads.size();
+    for(unsigned int i = 0; i < segment.branches.size(); ++i)
+    {
+        _jobs[i % num_threads].push_back(&segment.branches[i]);
+    }
+
+    _workload  = &workload;
+    _pending   = std::min<unsigned int>(segment.branches.size(), num_threads);
+    _exception = nullptr;
+    ++_generation;
+    _work_cv.notify_all();
+
+    _done_cv.wait(lock, [&]()
+    {
+        return _pending == 0;
+    });
+
+    if(_exception != nullptr)
+    {
+        std::exception_ptr exception = _exception;
+        _exception                   = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+std::vector<IScheduler *> ParallelBranchExecutor::node_schedulers(const std::vector<ExecutionSegment> &segments, size_t num_nodes) const
+{
+    std::vector<IScheduler *> schedulers(num_nodes, nullptr);
+    for(const auto &segment : segments)
+    {
+        if(segment.branches.size() <= 1)
+        {
+            continue;
+        }
+
+        // The i-th branch is executed by the thread i % num_branches()
+        for(unsigned int i = 0; i < segment.branches.size(); ++i)
+        {
+            for(auto nid : segment.branches[i])
+            {
+                ARM_COMPUTE_ERROR_ON(nid >= num_nodes);
+                schedulers[nid] = _schedulers[i % _schedulers.size()].get();
+            }
+        }
+    }
+    return schedulers;
+}
+
+unsigned int ParallelBranchExecutor::num_branches() const
+{
+    return _threads.size();
+}
+
+void ParallelBranchExecutor::worker_loop(unsigned int id)
+{
+    // Functions executed on this thread split their kernels on the scheduler of the branch
+    Scheduler::set_thread_local(_schedulers[id].get());
+
+    unsigned int generation = 0;
+    while(true)
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _work_cv.wait(lock, [&]()
+        {
+            return _exit || generation != _generation;
+        });
+        if(_exit)
+        {
+            break;
+        }
+        generation = _generation;
+
+        std::vector<const std::vector<unsigned int> *> branches;
+        std::swap(branches, _jobs[id]);
+        if(branches.empty())
+        {
+            continue;
+        }
+
+        ExecutionWorkload &workload = *_workload;
+        lock.unlock();
+
+        try
+        {
+            for(const auto *branch : branches)
+            {
+                for(auto task_id : *branch)
+                {
+                    workload.tasks[task_id]();
+                }
+            }
+        }
+        catch(...)
+        {
+            lock.lock();
+            if(_exception == nullptr)
+            {
+                _exception = std::current_exception();
+            }
+            lock.unlock();
+        }
+
+        lock.lock();
+        if(--_pending == 0)
+        {
+            _done_cv.notify_one();
+        }
+    }
+
+    Scheduler::set_thread_local(nullptr);
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
@@ -0,0 +1,600 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/PipelineExecutor.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <set>
+#include <thread>
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+namespace
+{
+/** Estimates the cost of a node
+ *
+ * @param[in] node Node to inspect
+ *
+ * @return Number of multiply-accumulates for the nodes with weights, number of output elements otherwise
+ */
+double estimate_node_cost(const INode &node)
+{
+    const Tensor *output = node.num_outputs() > 0 ? node.output(0) : nullptr;
+    if(output == nullptr)
+    {
+        return 0.;
+    }
+
+    const TensorDescriptor &output_desc  = output->desc();
+    const double            num_elements = output_desc.shape.total_size();
+    const Tensor           *weights      = node.num_inputs() > 1 ? node.input(1) : nullptr;
+
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            // Each output element accumulates the weights of its channel
+            const double num_channels = get_dimension_size(output_desc, DataLayoutDimension::CHANNEL);
+            return (weights != nullptr && num_channels > 0) ? num_elements * weights->desc().shape.total_size() / num_channels : num_elements;
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            const double num_outputs = output_desc.shape.x();
+            return (weights != nullptr && num_outputs > 0) ? num_elements * weights->desc().shape.total_size() / num_outputs : num_elements;
+        }
+        default:
+            return num_elements;
+    }
+}
+
+/** Checks if a node only provides data to the graph
+ *
+ * @param[in] node Node to inspect
+ *
+ * @return True if the node is an input, output or const node
+ */
+bool is_data_node(const INode &node)
+{
+    return node.type() == NodeType::Input || node.type() == NodeType::Output || node.type() == NodeType::Const;
+}
+} // namespace
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+PipelineStages configure_pipeline_stages(Graph &g, unsigned int num_stages)
+{
+    PipelineStages stages;
+    stages.node_stages.resize(g.nodes().size(), 0);
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+    if(num_stages <= 1)
+    {
+        return stages;
+    }
+
+    // Position of the nodes in execution order: input and const nodes come first, output nodes last
+    constexpr int             first_position = -1;
+    constexpr int             last_position  = std::numeric_limits<int>::max();
+    std::vector<int>          positions(g.nodes().size(), first_position);
+    std::vector<const INode *> compute_nodes;
+    for(auto &nid : topological_sort(g))
+    {
+        const INode *node = g.node(nid);
+        if(node != nullptr)
+        {
+            if(node->type() == NodeType::Output)
+            {
+                positions[node->id()] = last_position;
+            }
+            else if(!is_data_node(*node))
+            {
+                positions[node->id()] = compute_nodes.size();
+                compute_nodes.push_back(node);
+            }
+        }
+    }
+    const int num_compute_nodes = compute_nodes.size();
+    if(num_compute_nodes < 2)
+    {
+        return stages;
+    }
+
+    // Handles backing sub-tensors
+    std::set<ITensorHandle *> parent_handles;
+    for(auto &tensor : g.tensors())
+    {
+        if(tensor != nullptr && tensor->handle() != nullptr && tensor->handle()->is_subtensor())
+        {
+            parent_handles.insert(tensor->handle()->parent_handle());
+        }
+    }
+
+    // Invalidate the boundaries that can't be crossed: a boundary after position i is invalid if invalid[i] > 0
+    std::vector<int> invalid(num_compute_nodes + 1, 0);
+    auto invalidate = [&](int begin, int end)
+    {
+        begin = std::max(begin, 0);
+        end   = std::min(end, num_compute_nodes - 1);
+        for(int i = begin; i < end; ++i)
+        {
+            ++invalid[i];
+        }
+    };
+    for(auto &tensor : g.tensors())
+    {
+        if(tensor == nullptr || tensor->bound_edges().empty())
+        {
+            continue;
+        }
+
+        // Find the range of positions of the writers and the readers of the tensor
+        int  first_writer = last_position;
+        int  last_writer  = first_position;
+        int  last_reader  = first_position;
+        bool is_const     = false;
+        for(auto &eid : tensor->bound_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if(edge != nullptr)
+            {
+                is_const     = is_const || (edge->producer()->type() == NodeType::Const);
+                first_writer = std::min(first_writer, positions[edge->producer_id()]);
+                last_writer  = std::max(last_writer, positions[edge->producer_id()]);
+                last_reader  = std::max(last_reader, positions[edge->consumer_id()]);
+            }
+        }
+        if(is_const)
+        {
+            continue;
+        }
+
+        const ITensorHandle *handle          = tensor->handle();
+        const bool           can_be_copied   = (handle != nullptr) && (tensor->desc().target == Target::NEON) && !handle->is_subtensor()
+                                               && (parent_handles.find(tensor->handle()) == std::end(parent_handles)) && (last_reader != last_position);
+        invalidate(first_writer, can_be_copied ? last_writer : last_reader);
+    }
+
+    // Pick the valid boundaries closest to an even split of the cost
+    std::vector<double> cumulative_cost(num_compute_nodes);
+    double              total_cost = 0.;
+    for(int i = 0; i < num_compute_nodes; ++i)
+    {
+        total_cost += estimate_node_cost(*compute_nodes[i]);
+        cumulative_cost[i] = total_cost;
+    }
+
+    std::vector<int> boundaries;
+    for(unsigned int s = 1; s < num_stages; ++s)
+    {
+        const double target   = total_cost * s / num_stages;
+        int          boundary = -1;
+        for(int i = boundaries.empty() ? 0 : boundaries.back() + 1; i < num_compute_nodes - 1; ++i)
+        {
+            if(invalid[i] == 0 && (boundary < 0 || std::abs(cumulative_cost[i] - target) < std::abs(cumulative_cost[boundary] - target)))
+            {
+                boundary = i;
+            }
+        }
+        if(boundary < 0)
+        {
+            break;
+        }
+        boundaries.push_back(boundary);
+    }
+    stages.num_stages = boundaries.size() + 1;
+    if(stages.num_stages == 1)
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Couldn't find a boundary to split the graph in pipeline stages" << std::endl);
+        return stages;
+    }
+
+    // Assign the nodes to the stages
+    auto stage_of_position = [&](int position)
+    {
+        return std::upper_bound(std::begin(boundaries), std::end(boundaries), position - 1) - std::begin(boundaries);
+    };
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr)
+        {
+            const int position           = positions[node->id()];
+            stages.node_stages[node->id()] = (position == last_position) ? stages.num_stages - 1 : (position == first_position) ? 0 : stage_of_position(position);
+        }
+    }
+
+    // Give a separate tensor to the consumer stages of each tensor crossing a boundary
+    const size_t num_tensors = g.tensors().size();
+    for(size_t tid = 0; tid < num_tensors; ++tid)
+    {
+        Tensor *tensor = g.tensor(tid);
+        if(tensor == nullptr)
+        {
+            continue;
+        }
+
+        std::map<unsigned int, std::vector<EdgeID>> consumer_edges;
+        unsigned int                                producer_stage = 0;
+        for(auto &eid : tensor->bound_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if(edge != nullptr && edge->producer()->type() != NodeType::Const)
+            {
+                producer_stage = stages.node_stages[edge->producer_id()];
+                consumer_edges[stages.node_stages[edge->consumer_id()]].push_back(eid);
+            }
+        }
+
+        for(auto &stage_edges : consumer_edges)
+        {
+            if(stage_edges.first == producer_stage)
+            {
+                continue;
+            }
+
+            Tensor *dst = g.tensor(g.create_tensor(tensor->desc()));
+            for(auto &eid : stage_edges.second)
+            {
+                tensor->unbind_edge(eid);
+                g.edge(eid)->update_bound_tensor(dst);
+                dst->bind_edge(eid);
+            }
+
+            auto backend = backends::BackendRegistry::get().find_backend(dst->desc().target);
+            ARM_COMPUTE_ERROR_ON_MSG(!backend, "Requested backend doesn't exist!");
+            dst->set_handle(backend->create_tensor(*dst));
+
+            PipelineTransfer transfer;
+            transfer.src            = tensor;
+            transfer.dst            = dst;
+            transfer.producer_stage = producer_stage;
+            transfer.consumer_stage = stage_edges.first;
+            stages.transfers.push_back(transfer);
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Split graph in " << stages.num_stages << " pipeline stages with "
+                               << stages.transfers.size() << " transfers" << std::endl);
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(num_stages);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+    return stages;
+}
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+PipelineExecutor::PipelineExecutor(PipelineStages stages, unsigned int num_threads)
+    : _stages(std::move(stages)), _stage_tasks(_stages.num_stages), _transfer_buffers(), _schedulers(), _threads(), _workload(nullptr), _num_requests(0), _generation(0), _pending(0), _exit(false),
+      _done(), _busy_time(), _total_time(0.), _abort(false), _exception(nullptr), _mtx(), _cv()
+{
+    ARM_COMPUTE_ERROR_ON(_stages.num_stages == 0);
+
+    // Share the threads between the stages
+    // The functions query the assembly GEMM settings from the scheduler they are configured with
+    const IScheduler  &caller_scheduler  = Scheduler::get();
+    const unsigned int total_threads     = (num_threads == 0) ? std::max(1u, std::thread::hardware_concurrency()) : num_threads;
+    const unsigned int threads_per_stage = std::max(1u, total_threads / _stages.num_stages);
+    for(unsigned int i = 0; i < _stages.num_stages; ++i)
+    {
+        _schedulers.emplace_back(support::cpp14::make_unique<CPPScheduler>());
+        _schedulers.back()->set_num_threads(threads_per_stage);
+        _schedulers.back()->set_gemm_tuner(caller_scheduler.gemm_tuner());
+        _schedulers.back()->set_gemm_profiler(caller_scheduler.gemm_profiler());
+    }
+    for(unsigned int i = 0; i < _stages.num_stages; ++i)
+    {
+        _threads.emplace_back(&PipelineExecutor::worker_loop, this, i);
+    }
+}
+
+PipelineExecutor::~PipelineExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _exit = true;
+    }
+    _cv.notify_all();
+    for(auto &thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+std::vector<IScheduler *> PipelineExecutor::node_schedulers() const
+{
+    std::vector<IScheduler *> schedulers;
+    for(auto stage : _stages.node_stages)
+    {
+        schedulers.push_back(_schedulers[stage].get());
+    }
+    return schedulers;
+}
+
+void PipelineExecutor::configure(const ExecutionWorkload &workload)
+{
+    // Assign the tasks to the stages
+    for(unsigned int i = 0; i < workload.tasks.size(); ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(workload.tasks[i].node == nullptr);
+        _stage_tasks[_stages.node_stages[workload.tasks[i].node->id()]].push_back(i);
+    }
+
+    // Group the transfers by source tensor: its consumer stages read the buffer written by the producer stage
+    std::map<Tensor *, unsigned int> src_to_buffers;
+    for(const auto &transfer : _stages.transfers)
+    {
+        ARM_COMPUTE_ERROR_ON(transfer.src == nullptr || transfer.dst == nullptr);
+        auto it = src_to_buffers.find(transfer.src);
+        if(it == std::end(src_to_buffers))
+        {
+            it = src_to_buffers.emplace(transfer.src, _transfer_buffers.size()).first;
+            _transfer_buffers.emplace_back();
+            _transfer_buffers.back().src            = transfer.src->handle();
+            _transfer_buffers.back().producer_stage = transfer.producer_stage;
+        }
+        _transfer_buffers[it->second].dsts.push_back(transfer.dst->handle());
+        _transfer_buffers[it->second].consumer_stages.push_back(transfer.consumer_stage);
+    }
+
+    for(auto &transfer : _transfer_buffers)
+    {
+        // The tensors share their buffers, so they need the same strides: give them the padding all their functions require
+        ITensorInfo *src_info = transfer.src->tensor().info();
+        PaddingSize  padding  = src_info->padding();
+        for(auto *dst : transfer.dsts)
+        {
+            const PaddingSize &dst_padding = dst->tensor().info()->padding();
+            padding.top                    = std::max(padding.top, dst_padding.top);
+            padding.right                  = std::max(padding.right, dst_padding.right);
+            padding.bottom                 = std::max(padding.bottom, dst_padding.bottom);
+            padding.left                   = std::max(padding.left, dst_padding.left);
+        }
+        src_info->extend_padding(padding);
+        for(auto *dst : transfer.dsts)
+        {
+            dst->tensor().info()->extend_padding(padding);
+            ARM_COMPUTE_ERROR_ON(dst->tensor().info()->total_size() != src_info->total_size());
+        }
+
+        // A buffer is written again once the furthest consumer stage is done with it: one buffer per request in flight in between
+        const unsigned int furthest_stage = *std::max_element(std::begin(transfer.consumer_stages), std::end(transfer.consumer_stages));
+        const unsigned int num_buffers    = furthest_stage - transfer.producer_stage + 1;
+        for(unsigned int i = 0; i < num_buffers; ++i)
+        {
+            transfer.buffers.push_back(std::make_shared<MemoryRegion>(src_info->total_size(), Allocator::cache_line_size));
+        }
+
+        // Import the first buffer, so that the tensors are not allocated with the others
+        bool is_imported = transfer.src->import_memory(transfer.buffers.front());
+        for(auto *dst : transfer.dsts)
+        {
+            is_imported = dst->import_memory(transfer.buffers.front()) && is_imported;
+        }
+        ARM_COMPUTE_ERROR_ON_MSG(!is_imported, "Tensors crossing a stage boundary must be backed by imported memory!");
+        ARM_COMPUTE_UNUSED(is_imported);
+    }
+}
+
+void PipelineExecutor::run(ExecutionWorkload &workload, unsigned int num_requests)
+{
+    const unsigned int num_stages = _stages.num_stages;
+
+    // The functions query the assembly GEMM settings from the scheduler they run on
+    const IScheduler &caller_scheduler = Scheduler::get();
+    for(auto &scheduler : _schedulers)
+    {
+        scheduler->set_gemm_tuner(caller_scheduler.gemm_tuner());
+        scheduler->set_weights_cache(caller_scheduler.weights_cache());
+        scheduler->set_gemm_profiler(caller_scheduler.gemm_profiler());
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(_mtx);
+    _workload     = &workload;
+    _num_requests = num_requests;
+    _done         = std::vector<unsigned int>(num_stages, 0);
+    _busy_time    = std::vector<double>(num_stages, 0.);
+    _abort        = false;
+    _exception    = nullptr;
+    _pending      = num_stages;
+    ++_generation;
+    _cv.notify_all();
+
+    _cv.wait(lock, [&]()
+    {
+        return _pending == 0;
+    });
+
+    _total_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if(_exception != nullptr)
+    {
+        std::exception_ptr exception = _exception;
+        _exception                   = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+unsigned int PipelineExecutor::num_stages() const
+{
+    return _stages.num_stages;
+}
+
+std::vector<float> PipelineExecutor::occupancy() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    std::vector<float> occupancy(_busy_time.size(), 0.f);
+    for(unsigned int i = 0; i < _busy_time.size() && _total_time > 0.; ++i)
+    {
+        occupancy[i] = _busy_time[i] / _total_time;
+    }
+    return occupancy;
+}
+
+void PipelineExecutor::worker_loop(unsigned int stage)
+{
+    // Functions executed on this thread split their kernels on the scheduler of the stage
+    Scheduler::set_thread_local(_schedulers[stage].get());
+
+    unsigned int generation = 0;
+    while(true)
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _cv.wait(lock, [&]()
+        {
+            return _exit || generation != _generation;
+        });
+        if(_exit)
+        {
+            break;
+        }
+        generation = _generation;
+
+        ExecutionWorkload &workload     = *_workload;
+        const unsigned int num_requests = _num_requests;
+        lock.unlock();
+
+        stage_loop(workload, stage, num_requests);
+
+        lock.lock();
+        --_pending;
+        lock.unlock();
+        _cv.notify_all();
+    }
+
+    Scheduler::set_thread_local(nullptr);
+}
+
+void PipelineExecutor::stage_loop(ExecutionWorkload &workload, unsigned int stage, unsigned int num_requests)
+{
+    const bool is_first_stage = (stage == 0);
+    const bool is_last_stage  = (stage == _stages.num_stages - 1);
+
+    for(unsigned int request = 0; request < num_requests; ++request)
+    {
+        {
+            // Wait for the previous stage to produce the request and for the consumer stages to be done with the buffers of the request
+            std::unique_lock<std::mutex> lock(_mtx);
+            _cv.wait(lock, [&]()
+            {
+                const bool is_produced = is_first_stage || _done[stage - 1] > request;
+                const bool is_free     = std::all_of(std::begin(_transfer_buffers), std::end(_transfer_buffers), [&](const TransferBuffers & transfer)
+                {
+                    return transfer.producer_stage != stage || std::all_of(std::begin(transfer.consumer_stages), std::end(transfer.consumer_stages), [&](unsigned int consumer)
+                    {
+                        return _done[consumer] + transfer.buffers.size() > request;
+                    });
+                });
+                return _abort || (is_produced && is_free);
+            });
+            if(_abort)
+            {
+                break;
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        try
+        {
+            // Hand the buffers of the request over to the tensors of the stage
+            for(auto &transfer : _transfer_buffers)
+            {
+                const auto &buffer = transfer.buffers[request % transfer.buffers.size()];
+                if(transfer.producer_stage == stage)
+                {
+                    transfer.src->import_memory(buffer);
+                }
+                for(unsigned int i = 0; i < transfer.dsts.size(); ++i)
+                {
+                    if(transfer.consumer_stages[i] == stage)
+                    {
+                        transfer.dsts[i]->import_memory(buffer);
+                    }
+                }
+            }
+
+            if(is_first_stage)
+            {
+                call_all_input_node_accessors(workload);
+            }
+            for(auto task_id : _stage_tasks[stage])
+            {
+                workload.tasks[task_id]();
+            }
+            if(is_last_stage)
+            {
+                call_all_output_node_accessors(workload);
+            }
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            if(_exception == nullptr)
+            {
+                _exception = std::current_exception();
+            }
+            _abort = true;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _busy_time[stage] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            _done[stage] = request + 1;
+        }
+        _cv.notify_all();
+    }
+
+    _cv.notify_all();
+}
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
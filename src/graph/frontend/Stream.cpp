@@ -49,6 +49,21 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+void Stream::run(unsigned int num_requests)
+{
+    _manager.execute_graph(_g, num_requests);
+}
+
+std::vector<float> Stream::pipeline_stage_occupancy()
+{
+    return _manager.pipeline_stage_occupancy(_g);
+}
+
+const MemoryPlan &Stream::memory_plan() const
+{
+    return _manager.memory_plan(_g);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/BatchNormalizationFoldingMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+
+#include <array>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Batch normalization folded into a convolution, its parameters are loaded by the first accessor needing them */
+class FoldedBatchNormalization final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] epsilon   Epsilon of the batch normalization
+     * @param[in] channels  Number of channels
+     * @param[in] accessors Accessors of the mean, variance, beta and gamma. Beta and gamma can be nullptr, they then default to 0 and 1.
+     */
+    FoldedBatchNormalization(float epsilon, size_t channels, std::array<ITensorAccessorUPtr, 4> accessors)
+        : _epsilon(epsilon), _channels(channels), _accessors(std::move(accessors)), _scale(), _shift(), _is_loaded(false)
+    {
+    }
+    /** Scale of each channel: gamma / sqrt(variance + epsilon)
+     *
+     * @return The scales
+     */
+    const std::vector<float> &scale()
+    {
+        load();
+        return _scale;
+    }
+    /** Shift of each channel: beta - mean * scale
+     *
+     * @return The shifts
+     */
+    const std::vector<float> &shift()
+    {
+        load();
+        return _shift;
+    }
+
+private:
+    std::vector<float> read(ITensorAccessor *accessor, float default_value) const
+    {
+        if(accessor == nullptr)
+        {
+            return std::vector<float>(_channels, default_value);
+        }
+
+        arm_compute::Tensor tensor;
+        tensor.allocator()->init(TensorInfo(TensorShape(_channels), 1, DataType::F32));
+        tensor.allocator()->allocate();
+        accessor->access_tensor(tensor);
+
+        const auto *ptr = reinterpret_cast<const float *>(tensor.buffer());
+        return std::vector<float>(ptr, ptr + _channels);
+    }
+
+    void load()
+    {
+        if(_is_loaded)
+        {
+            return;
+        }
+
+        const std::vector<float> mean  = read(_accessors[0].get(), 0.f);
+        const std::vector<float> var   = read(_accessors[1].get(), 1.f);
+        const std::vector<float> beta  = read(_accessors[2].get(), 0.f);
+        const std::vector<float> gamma = read(_accessors[3].get(), 1.f);
+
+        _scale.resize(_channels);
+        _shift.resize(_channels);
+        for(size_t c = 0; c < _channels; ++c)
+        {
+            _scale[c] = gamma[c] / std::sqrt(var[c] + _epsilon);
+            _shift[c] = beta[c] - mean[c] * _scale[c];
+        }
+
+        _is_loaded = true;
+    }
+
+    float                              _epsilon;
+    size_t                             _channels;
+    std::array<ITensorAccessorUPtr, 4> _accessors;
+    std::vector<float>                 _scale;
+    std::vector<float>                 _shift;
+    bool                               _is_loaded;
+};
+
+/** Accessor scaling the weights loaded by another accessor by the folded batch normalization */
+class FoldedWeightsAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] weights     Accessor of the weights
+     * @param[in] batch_norm  Folded batch normalization
+     * @param[in] channel_idx Dimension of the weights indexing the output channels
+     */
+    FoldedWeightsAccessor(ITensorAccessorUPtr weights, std::shared_ptr<FoldedBatchNormalization> batch_norm, size_t channel_idx)
+        : _weights(std::move(weights)), _batch_norm(std::move(batch_norm)), _channel_idx(channel_idx)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        const bool                ret   = _weights->access_tensor(tensor);
+        const std::vector<float> &scale = _batch_norm->scale();
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            *reinterpret_cast<float *>(it.ptr()) *= scale[id[_channel_idx]];
+        },
+        it);
+
+        return ret;
+    }
+
+private:
+    ITensorAccessorUPtr                       _weights;
+    std::shared_ptr<FoldedBatchNormalization> _batch_norm;
+    size_t                                    _channel_idx;
+};
+
+/** Accessor scaling and shifting the bias loaded by another accessor, if any, by the folded batch normalization */
+class FoldedBiasAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] bias       Accessor of the bias, nullptr if the convolution had none
+     * @param[in] batch_norm Folded batch normalization
+     */
+    FoldedBiasAccessor(ITensorAccessorUPtr bias, std::shared_ptr<FoldedBatchNormalization> batch_norm)
+        : _bias(std::move(bias)), _batch_norm(std::move(batch_norm))
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        const bool                ret   = (_bias != nullptr) ? _bias->access_tensor(tensor) : true;
+        const std::vector<float> &scale = _batch_norm->scale();
+        const std::vector<float> &shift = _batch_norm->shift();
+
+        for(size_t c = 0; c < scale.size(); ++c)
+        {
+            auto *ptr = reinterpret_cast<float *>(tensor.ptr_to_element(Coordinates(c)));
+            *ptr      = ((_bias != nullptr) ? *ptr * scale[c] : 0.f) + shift[c];
+        }
+
+        return ret;
+    }
+
+private:
+    ITensorAccessorUPtr                       _bias;
+    std::shared_ptr<FoldedBatchNormalization> _batch_norm;
+};
+
+/** Returns the constant node producing an input of a node if its output has an accessor and no other consumer
+ *
+ * @param[in] node Node
+ * @param[in] idx  Input index
+ *
+ * @return The constant node, nullptr if the input isn't connected to such a node
+ */
+INode *get_exclusive_const_input(INode &node, size_t idx)
+{
+    const Edge *edge = node.input_edge(idx);
+    if(edge == nullptr || edge->producer() == nullptr)
+    {
+        return nullptr;
+    }
+
+    INode *producer = edge->producer();
+    if(producer->type() != NodeType::Const || producer->output_edges().size() != 1 || producer->output(0)->accessor() == nullptr)
+    {
+        return nullptr;
+    }
+
+    return producer;
+}
+
+void fold_batch_normalization(Graph &g, BatchNormalizationLayerNode &bn_node)
+{
+    // The input must be produced by a convolution feeding only the batch normalization
+    const Edge *input_edge = bn_node.input_edge(0);
+    if(input_edge == nullptr || input_edge->producer() == nullptr || input_edge->producer()->output_edges().size() != 1 || bn_node.fused_activation().enabled())
+    {
+        return;
+    }
+
+    INode     *conv_node = input_edge->producer();
+    const bool is_conv   = conv_node->type() == NodeType::ConvolutionLayer;
+    if(!is_conv && conv_node->type() != NodeType::DepthwiseConvolutionLayer)
+    {
+        return;
+    }
+
+    // The weights, bias and batch normalization parameters must be constants the folding can be applied to as they are loaded
+    INode *weights_node = get_exclusive_const_input(*conv_node, 1);
+    INode *bias_node    = get_exclusive_const_input(*conv_node, 2);
+    if(weights_node == nullptr || (bias_node == nullptr && conv_node->input_edge(2) != nullptr) || bn_node.input(0)->desc().data_type != DataType::F32
+       || weights_node->output(0)->desc().data_type != DataType::F32)
+    {
+        return;
+    }
+
+    std::array<INode *, 4> bn_param_nodes{ { nullptr, nullptr, nullptr, nullptr } };
+    for(size_t i = 0; i < bn_param_nodes.size(); ++i)
+    {
+        bn_param_nodes[i] = get_exclusive_const_input(bn_node, i + 1);
+        if(bn_param_nodes[i] == nullptr && bn_node.input_edge(i + 1) != nullptr)
+        {
+            return;
+        }
+    }
+    // The mean and variance are mandatory
+    if(bn_param_nodes[0] == nullptr || bn_param_nodes[1] == nullptr)
+    {
+        return;
+    }
+
+    // Output channels index the batches of the weights of convolutions and the channels of the weights of depthwise convolutions
+    const TensorDescriptor &weights_desc = weights_node->output(0)->desc();
+    const size_t            channel_idx  = get_dimension_idx(weights_desc, is_conv ? DataLayoutDimension::BATCHES : DataLayoutDimension::CHANNEL);
+    const size_t            channels     = weights_desc.shape[channel_idx];
+    if(channels != bn_node.input(1)->desc().shape.total_size())
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding Batch Normalization node with ID : " << bn_node.id()
+                                  << " into Convolution node with ID : " << conv_node->id() << std::endl);
+
+    // Move the batch normalization parameters to the folded batch normalization
+    std::array<ITensorAccessorUPtr, 4> bn_accessors;
+    for(size_t i = 0; i < bn_param_nodes.size(); ++i)
+    {
+        if(bn_param_nodes[i] != nullptr)
+        {
+            bn_accessors[i] = bn_param_nodes[i]->output(0)->extract_accessor();
+            g.remove_node(bn_param_nodes[i]->id());
+        }
+    }
+    auto batch_norm = std::make_shared<FoldedBatchNormalization>(bn_node.epsilon(), channels, std::move(bn_accessors));
+
+    // Scale the weights and bias as they are loaded
+    Tensor *weights = weights_node->output(0);
+    weights->set_accessor(support::cpp14::make_unique<FoldedWeightsAccessor>(weights->extract_accessor(), batch_norm, channel_idx));
+    if(bias_node != nullptr)
+    {
+        Tensor *bias = bias_node->output(0);
+        bias->set_accessor(support::cpp14::make_unique<FoldedBiasAccessor>(bias->extract_accessor(), batch_norm));
+    }
+    else
+    {
+        TensorDescriptor bias_desc = weights_desc;
+        bias_desc.shape            = TensorShape(channels);
+
+        NodeParams bias_params = { conv_node->name().empty() ? "" : conv_node->name() + "Bias", conv_node->assigned_target() };
+        NodeID     bias_nid    = GraphBuilder::add_const_node(g, bias_params, bias_desc, support::cpp14::make_unique<FoldedBiasAccessor>(nullptr, batch_norm));
+        g.node(bias_nid)->set_assigned_target(conv_node->assigned_target());
+        g.add_connection(bias_nid, 0, conv_node->id(), 2);
+    }
+
+    // Get driving nodes of the batch normalization, which the convolution now drives, along with the output accessor if any
+    std::vector<NodeIdxPair> bn_driving_nodes;
+    for(auto &bn_output_edge_id : bn_node.output_edges())
+    {
+        auto bn_output_edge = g.edge(bn_output_edge_id);
+        if(bn_output_edge != nullptr)
+        {
+            ARM_COMPUTE_ERROR_ON(bn_output_edge->consumer() == nullptr);
+            bn_driving_nodes.push_back({ bn_output_edge->consumer_id(), bn_output_edge->consumer_idx() });
+        }
+    }
+    Tensor *bn_output = bn_node.output(0);
+    if(bn_output != nullptr && bn_output != conv_node->output(0) && bn_output->accessor() != nullptr)
+    {
+        conv_node->output(0)->set_accessor(bn_output->extract_accessor());
+    }
+
+    // Remove batch normalization node
+    const NodeID conv_nid = conv_node->id();
+    g.remove_node(bn_node.id());
+
+    // Update convolution node outputs
+    for(auto &driving_node : bn_driving_nodes)
+    {
+        g.add_connection(conv_nid, 0, driving_node.node_id, driving_node.index);
+    }
+}
+} // namespace
+
+const char *BatchNormalizationFoldingMutator::name()
+{
+    return "BatchNormalizationFoldingMutator";
+}
+
+void BatchNormalizationFoldingMutator::mutate(Graph &g)
+{
+    // Nodes are added while folding, so iterate over the IDs rather than the node container
+    const size_t num_nodes = g.nodes().size();
+    for(NodeID nid = 0; nid < num_nodes; ++nid)
+    {
+        INode *node = g.node(nid);
+        if(node != nullptr && node->type() == NodeType::BatchNormalizationLayer)
+        {
+            fold_batch_normalization(g, *arm_compute::utils::cast::polymorphic_downcast<BatchNormalizationLayerNode *>(node));
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
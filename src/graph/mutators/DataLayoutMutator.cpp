@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/DataLayoutMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Accessor loading a constant in NCHW through another accessor and storing it in NHWC */
+class NHWCConstAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor Accessor of the NCHW constant
+     * @param[in] shape    NCHW shape of the constant
+     */
+    NHWCConstAccessor(ITensorAccessorUPtr accessor, TensorShape shape)
+        : _accessor(std::move(accessor)), _shape(shape)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        TensorInfo nchw_info(_shape, 1, tensor.info()->data_type(), tensor.info()->quantization_info());
+        nchw_info.set_data_layout(DataLayout::NCHW);
+
+        arm_compute::Tensor nchw_tensor;
+        nchw_tensor.allocator()->init(nchw_info);
+        nchw_tensor.allocator()->allocate();
+        const bool ret = _accessor->access_tensor(nchw_tensor);
+
+        // Move the channels to the first dimension
+        const size_t element_size = tensor.info()->element_size();
+
+        Window window;
+        window.use_tensor_dimensions(_shape);
+
+        Iterator it(&nchw_tensor, window);
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            std::memcpy(tensor.ptr_to_element(Coordinates(id[2], id[0], id[1], id[3])), it.ptr(), element_size);
+        },
+        it);
+
+        return ret;
+    }
+
+private:
+    ITensorAccessorUPtr _accessor;
+    TensorShape         _shape;
+};
+
+/** Connected nodes switched to NHWC together */
+struct Subgraph
+{
+    std::vector<NodeID> nodes{};   /**< Nodes of the subgraph, in ascending order */
+    std::set<TensorID>  inputs{};  /**< Tensors produced outside of the subgraph and permuted to NHWC */
+    std::set<TensorID>  outputs{}; /**< Tensors produced by the subgraph and permuted back to NCHW */
+    int                 gain{ 0 }; /**< Tensor passes saved by the nodes running in NHWC */
+};
+
+/** Checks if a node is in a set of nodes
+ *
+ * @param[in] nodes Flags of the nodes in the set, the nodes added to the graph since are not in it
+ * @param[in] nid   Node ID
+ *
+ * @return True if the node is in the set
+ */
+bool contains(const std::vector<bool> &nodes, NodeID nid)
+{
+    return nid < nodes.size() && nodes[nid];
+}
+
+/** Checks if an input of a node is permuted when it runs in NHWC
+ *
+ * @param[in] node Node
+ * @param[in] idx  Input index
+ *
+ * @return True for the activations and weights, false for the one dimensional biases and batch normalization parameters
+ */
+bool is_permuted_input(const INode &node, size_t idx)
+{
+    return (idx == 0) || (idx == 1 && node.type() != NodeType::BatchNormalizationLayer);
+}
+
+/** Checks if a node can be switched to NHWC
+ *
+ * @param[in]  node Node to check
+ * @param[out] gain Tensor passes the node saves in NHWC
+ *
+ * @return True if the backend of the node can execute it in NHWC and its constant inputs can be permuted as they are loaded
+ */
+bool is_nhwc_candidate(INode &node, int &gain)
+{
+    backends::IDeviceBackend *backend = backends::BackendRegistry::get().find_backend(node.assigned_target());
+    if(backend == nullptr)
+    {
+        return false;
+    }
+
+    const DataLayoutHint hint = backend->data_layout_hint(node);
+    if(!hint.supports_nhwc)
+    {
+        return false;
+    }
+
+    for(size_t idx = 0; idx < node.num_inputs(); ++idx)
+    {
+        const Edge *edge = node.input_edge(idx);
+        if(!is_permuted_input(node, idx))
+        {
+            continue;
+        }
+        if(edge == nullptr || edge->producer() == nullptr)
+        {
+            return false;
+        }
+        if(edge->producer()->type() == NodeType::Const && edge->producer()->output_edges().size() != 1)
+        {
+            return false;
+        }
+    }
+
+    gain = hint.nhwc_gain;
+    return true;
+}
+
+/** Creates the backend handle of a tensor again after a change of its descriptor
+ *
+ * @param[in] tensor Tensor to update
+ */
+void update_handle(Tensor &tensor)
+{
+    backends::IDeviceBackend *backend = backends::BackendRegistry::get().find_backend(tensor.desc().target);
+    ARM_COMPUTE_ERROR_ON_MSG(backend == nullptr, "Requested backend doesn't exist!");
+    tensor.set_handle(backend->create_tensor(tensor));
+}
+
+/** Adds a permute node to the graph
+ *
+ * @param[in] g      Graph
+ * @param[in] name   Name of the node
+ * @param[in] target Target of the node
+ * @param[in] nhwc   Permutes from NCHW to NHWC if true else from NHWC to NCHW
+ *
+ * @return The ID of the permute node
+ */
+NodeID add_permute_node(Graph &g, const std::string &name, Target target, bool nhwc)
+{
+    const NodeID nid = nhwc ? g.add_node<PermuteLayerNode>(PermutationVector(2U, 0U, 1U), DataLayout::NHWC) :
+                       g.add_node<PermuteLayerNode>(PermutationVector(1U, 2U, 0U), DataLayout::NCHW);
+    INode *node = g.node(nid);
+    node->set_common_node_parameters(NodeParams{ name, target });
+    node->set_assigned_target(target);
+
+    return nid;
+}
+
+/** Switches a subgraph to NHWC
+ *
+ * @param[in]      g             Graph
+ * @param[in]      subgraph      Subgraph to switch
+ * @param[in]      in_subgraph   Flags of the nodes of the subgraph
+ * @param[in, out] nhwc_permutes Permute nodes of the tensors already permuted to NHWC, shared by the subgraphs
+ */
+void switch_to_nhwc(Graph &g, const Subgraph &subgraph, const std::vector<bool> &in_subgraph, std::map<TensorID, NodeID> &nhwc_permutes)
+{
+    std::vector<Tensor *> updated_tensors;
+
+    // Permute the constants as they are loaded
+    for(auto &nid : subgraph.nodes)
+    {
+        INode *node = g.node(nid);
+        for(size_t idx = 0; idx < node->num_inputs(); ++idx)
+        {
+            const Edge *edge = node->input_edge(idx);
+            if(is_permuted_input(*node, idx) && edge->producer()->type() == NodeType::Const)
+            {
+                Tensor           *tensor     = edge->tensor();
+                const TensorShape nchw_shape = tensor->desc().shape;
+                permute(tensor->desc().shape, PermutationVector(2U, 0U, 1U));
+                tensor->desc().layout = DataLayout::NHWC;
+                if(tensor->accessor() != nullptr)
+                {
+                    tensor->set_accessor(support::cpp14::make_unique<NHWCConstAccessor>(tensor->extract_accessor(), nchw_shape));
+                }
+                updated_tensors.push_back(tensor);
+            }
+        }
+    }
+
+    // Permute the inputs once for all the nodes consuming them
+    std::vector<NodeID> input_permutes;
+    for(auto &tid : subgraph.inputs)
+    {
+        std::vector<const Edge *> edges;
+        for(auto &eid : g.tensor(tid)->bound_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if(edge != nullptr && contains(in_subgraph, edge->consumer_id()) && is_permuted_input(*edge->consumer(), edge->consumer_idx()))
+            {
+                edges.push_back(edge);
+            }
+        }
+        ARM_COMPUTE_ERROR_ON(edges.empty());
+
+        NodeID permute_nid = EmptyNodeID;
+        if(nhwc_permutes.count(tid) != 0)
+        {
+            permute_nid = nhwc_permutes[tid];
+        }
+        else
+        {
+            INode *producer = edges.front()->producer();
+            permute_nid     = add_permute_node(g, producer->name().empty() ? "" : producer->name() + "ToNHWC", producer->assigned_target(), true);
+            g.add_connection(producer->id(), edges.front()->producer_idx(), permute_nid, 0);
+            nhwc_permutes[tid] = permute_nid;
+            input_permutes.push_back(permute_nid);
+        }
+
+        for(auto &edge : edges)
+        {
+            const NodeID consumer_nid = edge->consumer_id();
+            const size_t consumer_idx = edge->consumer_idx();
+            g.remove_connection(edge->id());
+            g.add_connection(permute_nid, 0, consumer_nid, consumer_idx);
+        }
+    }
+
+    // Permute back the outputs consumed outside of the subgraph, the NCHW tensors keep their accessors
+    std::vector<NodeID> output_permutes;
+    for(auto &nid : subgraph.nodes)
+    {
+        INode *node = g.node(nid);
+        for(size_t idx = 0; idx < node->num_outputs(); ++idx)
+        {
+            Tensor *tensor = node->output(idx);
+            if(tensor == nullptr)
+            {
+                continue;
+            }
+            updated_tensors.push_back(tensor);
+            if(subgraph.outputs.count(tensor->id()) == 0)
+            {
+                continue;
+            }
+
+            std::vector<const Edge *> edges;
+            for(auto &eid : tensor->bound_edges())
+            {
+                const Edge *edge = g.edge(eid);
+                if(edge != nullptr && (!contains(in_subgraph, edge->consumer_id()) || !is_permuted_input(*edge->consumer(), edge->consumer_idx())))
+                {
+                    edges.push_back(edge);
+                }
+            }
+
+            const NodeID permute_nid = add_permute_node(g, node->name().empty() ? "" : node->name() + "ToNCHW", node->assigned_target(), false);
+            g.add_connection(nid, idx, permute_nid, 0);
+
+            Tensor *nchw_tensor = g.node(permute_nid)->output(0);
+            if(tensor->accessor() != nullptr)
+            {
+                nchw_tensor->set_accessor(tensor->extract_accessor());
+            }
+            for(auto &edge : edges)
+            {
+                const NodeID consumer_nid = edge->consumer_id();
+                const size_t consumer_idx = edge->consumer_idx();
+                g.remove_connection(edge->id());
+                g.add_connection(permute_nid, 0, consumer_nid, consumer_idx);
+            }
+            output_permutes.push_back(permute_nid);
+        }
+    }
+
+    // Propagate the descriptors in topological order, producers being added to the graph before their consumers
+    for(auto &nid : input_permutes)
+    {
+        g.node(nid)->forward_descriptors();
+    }
+    for(auto &nid : subgraph.nodes)
+    {
+        INode *node = g.node(nid);
+        node->forward_descriptors();
+
+        // Only the optimized depthwise convolution runs in NHWC
+        if(node->type() == NodeType::DepthwiseConvolutionLayer)
+        {
+            arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node)->set_depthwise_convolution_method(DepthwiseConvolutionMethod::OPTIMIZED_3x3);
+        }
+    }
+    for(auto &nid : output_permutes)
+    {
+        g.node(nid)->forward_descriptors();
+    }
+
+    // Create the backend tensors of the new and permuted tensors
+    for(auto &nid : input_permutes)
+    {
+        updated_tensors.push_back(g.node(nid)->output(0));
+    }
+    for(auto &nid : output_permutes)
+    {
+        updated_tensors.push_back(g.node(nid)->output(0));
+    }
+    for(auto &tensor : updated_tensors)
+    {
+        update_handle(*tensor);
+    }
+}
+} // namespace
+
+const char *DataLayoutMutator::name()
+{
+    return "DataLayoutMutator";
+}
+
+void DataLayoutMutator::mutate(Graph &g)
+{
+    // Find the nodes which can run in NHWC
+    const size_t      num_nodes = g.nodes().size();
+    std::vector<bool> is_candidate(num_nodes, false);
+    std::vector<int>  gains(num_nodes, 0);
+    for(NodeID nid = 0; nid < num_nodes; ++nid)
+    {
+        INode *node = g.node(nid);
+        if(node != nullptr && node->type() != NodeType::Const)
+        {
+            is_candidate[nid] = is_nhwc_candidate(*node, gains[nid]);
+        }
+    }
+
+    // Group them in connected subgraphs
+    std::vector<bool>          is_visited(num_nodes, false);
+    std::map<TensorID, NodeID> nhwc_permutes;
+    for(NodeID root = 0; root < num_nodes; ++root)
+    {
+        if(!is_candidate[root] || is_visited[root])
+        {
+            continue;
+        }
+
+        Subgraph            subgraph;
+        std::vector<NodeID> stack{ root };
+        is_visited[root] = true;
+        while(!stack.empty())
+        {
+            const NodeID nid = stack.back();
+            stack.pop_back();
+            subgraph.nodes.push_back(nid);
+            subgraph.gain += gains[nid];
+
+            INode *node = g.node(nid);
+            for(size_t idx = 0; idx < node->num_inputs(); ++idx)
+            {
+                const Edge *edge = node->input_edge(idx);
+                if(edge != nullptr && is_permuted_input(*node, idx) && contains(is_candidate, edge->producer_id()) && !is_visited[edge->producer_id()])
+                {
+                    is_visited[edge->producer_id()] = true;
+                    stack.push_back(edge->producer_id());
+                }
+            }
+            for(auto &eid : node->output_edges())
+            {
+                const Edge *edge = g.edge(eid);
+                if(edge != nullptr && is_permuted_input(*edge->consumer(), edge->consumer_idx()) && contains(is_candidate, edge->consumer_id()) && !is_visited[edge->consumer_id()])
+                {
+                    is_visited[edge->consumer_id()] = true;
+                    stack.push_back(edge->consumer_id());
+                }
+            }
+        }
+        std::sort(subgraph.nodes.begin(), subgraph.nodes.end());
+
+        std::vector<bool> in_subgraph(num_nodes, false);
+        for(auto &nid : subgraph.nodes)
+        {
+            in_subgraph[nid] = true;
+        }
+
+        // Find the tensors crossing the boundaries of the subgraph
+        for(auto &nid : subgraph.nodes)
+        {
+            INode *node = g.node(nid);
+            for(size_t idx = 0; idx < node->num_inputs(); ++idx)
+            {
+                const Edge *edge = node->input_edge(idx);
+                if(is_permuted_input(*node, idx) && !contains(in_subgraph, edge->producer_id()) && edge->producer()->type() != NodeType::Const)
+                {
+                    subgraph.inputs.insert(edge->tensor_id());
+                }
+            }
+            for(size_t idx = 0; idx < node->num_outputs(); ++idx)
+            {
+                Tensor *tensor = node->output(idx);
+                if(tensor == nullptr)
+                {
+                    continue;
+                }
+                bool is_output = tensor->accessor() != nullptr;
+                for(auto &eid : tensor->bound_edges())
+                {
+                    const Edge *edge = g.edge(eid);
+                    is_output        = is_output || (edge != nullptr && (!contains(in_subgraph, edge->consumer_id()) || !is_permuted_input(*edge->consumer(), edge->consumer_idx())));
+                }
+                if(is_output)
+                {
+                    subgraph.outputs.insert(tensor->id());
+                }
+            }
+        }
+
+        // Each permutation costs a pass over its tensor
+        const int num_permutes = static_cast<int>(subgraph.inputs.size() + subgraph.outputs.size());
+        if(subgraph.gain <= num_permutes)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Switching " << subgraph.nodes.size() << " nodes from node with ID : " << root
+                                      << " to NHWC, saving " << subgraph.gain << " tensor passes for " << num_permutes << " permutations" << std::endl);
+        switch_to_nhwc(g, subgraph, in_subgraph, nhwc_permutes);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -50,10 +50,22 @@ void InPlaceOperationMutator::mutate(Graph &g)
             // Check if parent has a single output if yes then force in place calculation else not
             if((input_edge != nullptr) && (input_edge->producer() != nullptr) && (input_edge->producer()->output_edges().size() == 1))
             {
+                // The accessor of the output, e.g. of a graph output, moves to the input tensor unless it already has one
+                auto    tensor = input_edge->tensor();
+                Tensor *output = node->output(0);
+                if(output != nullptr && output->accessor() != nullptr && tensor->accessor() != nullptr)
+                {
+                    continue;
+                }
+
                 ARM_COMPUTE_LOG_GRAPH_VERBOSE("Switching to in-place computation for the node with ID : "
                                               << node->id() << " and name : " << node->name() << std::endl);
+                if(output != nullptr && output->accessor() != nullptr)
+                {
+                    tensor->set_accessor(output->extract_accessor());
+                }
+
                 // Update output
-                auto tensor = input_edge->tensor();
                 node->set_output_tensor(tensor->id(), 0);
             }
         }
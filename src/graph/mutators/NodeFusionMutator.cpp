@@ -27,31 +27,41 @@
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/Cast.h"
 
+#include <functional>
+
 namespace arm_compute
 {
 namespace graph
 {
-namespace detail
+namespace
 {
-void fuse_batch_norm_with_activation(Graph &g)
+/** Fuses the activation layers following nodes of a given type into them
+ *
+ * @param[in] g         Graph to perform operation fusion on
+ * @param[in] node_type Type of the nodes to fuse the activations into
+ * @param[in] prec      Returns true if the given node can apply a fused activation
+ */
+template <typename N>
+void fuse_node_with_activation(Graph &g, NodeType node_type, const std::function<bool(INode &)> &prec)
 {
     // Not interested in the order of nodes
     for(auto &node : g.nodes())
     {
-        // Check if the node is batch norm and not a branching node
-        if(node && node->type() == NodeType::BatchNormalizationLayer && node->output_edges().size() == 1)
+        // Check if the node is of the requested type and not a branching node
+        if(node && node->type() == node_type && node->output_edges().size() == 1 && prec(*node))
         {
             auto output_edge_id = *node->output_edges().begin();
             auto output_edge    = g.edge(output_edge_id);
             // Check if following node is an activation layer node
             if((output_edge != nullptr) && (output_edge->consumer() != nullptr) && (output_edge->consumer()->type() == NodeType::ActivationLayer))
             {
-                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing Batch Normalization node with ID : " << output_edge->producer_id()
+                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing node with ID : " << output_edge->producer_id()
                                               << " with Activation Layer node with ID : " << output_edge->consumer_id() << std::endl);
 
-                auto *bn_node  = arm_compute::utils::cast::polymorphic_downcast<BatchNormalizationLayerNode *>(output_edge->producer());
+                auto *n_node   = arm_compute::utils::cast::polymorphic_downcast<N *>(output_edge->producer());
                 auto *act_node = arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(output_edge->consumer());
 
                 // Get driving nodes of activation node
@@ -66,21 +76,69 @@ void fuse_batch_norm_with_activation(Graph &g)
                     }
                 }
 
-                // Set activation info to batch normalization
-                bn_node->set_fused_activation(act_node->activation_info());
+                // Keep the accessor of the activation's output (e.g. when it feeds an output node)
+                Tensor *act_output = act_node->output(0);
+                if(act_output != nullptr && act_output->accessor() != nullptr)
+                {
+                    n_node->output(0)->set_accessor(act_output->extract_accessor());
+                }
+
+                // Set activation info to the fused node
+                n_node->set_fused_activation(act_node->activation_info());
 
                 // Remove activation node
                 g.remove_node(act_node->id());
 
-                // Update batch normalization node outputs
+                // Update fused node outputs
                 for(auto &driving_node : act_driving_nodes)
                 {
-                    g.add_connection(bn_node->id(), 0, driving_node.node_id, driving_node.index);
+                    g.add_connection(n_node->id(), 0, driving_node.node_id, driving_node.index);
                 }
             }
         }
     }
 }
+
+/** Checks if a node's function can apply a fused activation
+ *
+ * @note The NEON convolution, depthwise convolution and fully connected functions either apply the activation
+ *       in the output stage of their GEMM or run it in-place on their output
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the activation can be fused else false
+ */
+bool is_activation_fusable_on_neon(INode &node)
+{
+    const Tensor *output = node.output(0);
+    return (node.assigned_target() == Target::NEON) && (output != nullptr) && !is_data_type_quantized_asymmetric(output->desc().data_type);
+}
+} // namespace
+
+namespace detail
+{
+void fuse_batch_norm_with_activation(Graph &g)
+{
+    fuse_node_with_activation<BatchNormalizationLayerNode>(g, NodeType::BatchNormalizationLayer, [](INode &)
+    {
+        return true;
+    });
+}
+
+void fuse_convolution_with_activation(Graph &g)
+{
+    fuse_node_with_activation<ConvolutionLayerNode>(g, NodeType::ConvolutionLayer, is_activation_fusable_on_neon);
+}
+
+void fuse_depthwise_convolution_with_activation(Graph &g)
+{
+    fuse_node_with_activation<DepthwiseConvolutionLayerNode>(g, NodeType::DepthwiseConvolutionLayer, is_activation_fusable_on_neon);
+}
+
+void fuse_fully_connected_with_activation(Graph &g)
+{
+    fuse_node_with_activation<FullyConnectedLayerNode>(g, NodeType::FullyConnectedLayer, is_activation_fusable_on_neon);
+}
 } // namespace detail
 
 const char *NodeFusionMutator::name()
@@ -91,6 +149,9 @@ const char *NodeFusionMutator::name()
 void NodeFusionMutator::mutate(Graph &g)
 {
     detail::fuse_batch_norm_with_activation(g);
+    detail::fuse_convolution_with_activation(g);
+    detail::fuse_depthwise_convolution_with_activation(g);
+    detail::fuse_fully_connected_with_activation(g);
 }
 } // namespace graph
 } // namespace arm_compute
@@ -29,6 +29,8 @@
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 
+#include <map>
+
 namespace arm_compute
 {
 namespace graph
@@ -51,6 +53,14 @@ void DotGraphVisitor::visit(ConvolutionLayerNode &n)
 {
     std::stringstream ss;
     ss << n.convolution_method();
+    if(n.num_groups() > 1)
+    {
+        ss << R"( \n Groups: )" << n.num_groups();
+    }
+    if(n.fused_activation().enabled())
+    {
+        ss << R"( \n )" << n.fused_activation().activation();
+    }
     _info = ss.str();
 }
 
@@ -65,6 +75,10 @@ void DotGraphVisitor::visit(DepthwiseConvolutionLayerNode &n)
 {
     std::stringstream ss;
     ss << n.depthwise_convolution_method();
+    if(n.fused_activation().enabled())
+    {
+        ss << R"( \n )" << n.fused_activation().activation();
+    }
     _info = ss.str();
 }
 
@@ -75,6 +89,13 @@ void DotGraphVisitor::visit(EltwiseLayerNode &n)
     _info = ss.str();
 }
 
+void DotGraphVisitor::visit(FullyConnectedLayerNode &n)
+{
+    std::stringstream ss;
+    ss << (n.fused_activation().enabled() ? to_string(n.fused_activation().activation()) : "");
+    _info = ss.str();
+}
+
 void DotGraphVisitor::visit(NormalizationLayerNode &n)
 {
     std::stringstream ss;
@@ -103,6 +124,11 @@ const std::string &DotGraphVisitor::info() const
     return _info;
 }
 
+DotGraphPrinter::DotGraphPrinter(const MemoryPlan *memory_plan)
+    : _memory_plan(memory_plan)
+{
+}
+
 void DotGraphPrinter::print(const Graph &g, std::ostream &os)
 {
     // Print header
@@ -133,6 +159,15 @@ void DotGraphPrinter::print_footer(const Graph &g, std::ostream &os)
 
 void DotGraphPrinter::print_nodes(const Graph &g, std::ostream &os)
 {
+    std::map<NodeID, size_t> function_sizes;
+    if(_memory_plan != nullptr)
+    {
+        for(const auto &function : _memory_plan->functions)
+        {
+            function_sizes[function.node] = function.size;
+        }
+    }
+
     for(const auto &n : g.nodes())
     {
         if(n)
@@ -147,6 +182,12 @@ void DotGraphPrinter::print_nodes(const Graph &g, std::ostream &os)
             std::string name             = n->name().empty() ? node_id : n->name();
             auto        node_description = _dot_node_visitor.info();
 
+            auto function_it = function_sizes.find(n->id());
+            if(function_it != std::end(function_sizes))
+            {
+                node_description += R"( \n aux: )" + support::cpp11::to_string(function_it->second) + " B";
+            }
+
             os << R"([label = ")" << name << R"( \n )" << n->assigned_target() << R"( \n )" << node_description << R"("])";
             os << ";\n";
         }
@@ -155,6 +196,18 @@ void DotGraphPrinter::print_nodes(const Graph &g, std::ostream &os)
 
 void DotGraphPrinter::print_edges(const Graph &g, std::ostream &os)
 {
+    std::map<TensorID, const TransitionMemoryPlan *> transitions;
+    if(_memory_plan != nullptr)
+    {
+        for(const auto &transition : _memory_plan->transitions)
+        {
+            for(const auto &tid : transition.tensors)
+            {
+                transitions[tid] = &transition;
+            }
+        }
+    }
+
     for(const auto &e : g.edges())
     {
         if(e)
@@ -164,7 +217,16 @@ void DotGraphPrinter::print_edges(const Graph &g, std::ostream &os)
             os << source_node_id << " -> " << sink_node_id << " ";
             const Tensor *t = e->tensor();
             ARM_COMPUTE_ERROR_ON(t == nullptr);
-            os << R"([label = ")" << t->desc().shape << R"( \n )" << t->desc().data_type << R"( \n )" << t->desc().layout << R"("])";
+            os << R"([label = ")" << t->desc().shape << R"( \n )" << t->desc().data_type << R"( \n )" << t->desc().layout;
+
+            auto transition_it = transitions.find(t->id());
+            if(transition_it != std::end(transitions))
+            {
+                const TransitionMemoryPlan &transition = *transition_it->second;
+                os << R"( \n )" << ((transition.mapping_type == MappingType::OFFSETS) ? "offset " : "blob ") << transition.mapping;
+                os << R"( \n )" << transition.size << " B, steps " << transition.start << "-" << transition.end;
+            }
+            os << R"("])";
             os << ";\n";
         }
     }
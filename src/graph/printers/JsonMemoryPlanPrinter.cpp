@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/printers/JsonMemoryPlanPrinter.h"
+
+#include "arm_compute/graph/Edge.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+std::string quoted(const std::string &str)
+{
+    std::string out = "\"";
+    for(const char c : str)
+    {
+        if(c == '"' || c == '\\')
+        {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out + "\"";
+}
+
+std::string node_name(const Graph &g, NodeID nid)
+{
+    const INode *node = g.node(nid);
+    if(node == nullptr || node->name().empty())
+    {
+        return std::string("n") + support::cpp11::to_string(nid);
+    }
+    return node->name();
+}
+
+std::string producer_name(const Graph &g, const std::vector<TensorID> &tensors)
+{
+    const Tensor *tensor = tensors.empty() ? nullptr : g.tensor(tensors.front());
+    if(tensor != nullptr)
+    {
+        for(const auto &eid : tensor->bound_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if(edge != nullptr)
+            {
+                return quoted(node_name(g, edge->producer_id()));
+            }
+        }
+    }
+    return "null";
+}
+
+template <typename T>
+void print_list(std::ostream &os, const std::vector<T> &list)
+{
+    os << "[";
+    for(size_t i = 0; i < list.size(); ++i)
+    {
+        os << (i != 0 ? ", " : "") << list[i];
+    }
+    os << "]";
+}
+} // namespace
+
+JsonMemoryPlanPrinter::JsonMemoryPlanPrinter(const MemoryPlan &memory_plan)
+    : _memory_plan(memory_plan)
+{
+}
+
+void JsonMemoryPlanPrinter::print(const Graph &g, std::ostream &os)
+{
+    const MemoryPlan &plan = _memory_plan;
+
+    os << "{\n";
+    os << "  \"graph\": " << quoted(g.name()) << ",\n";
+    os << "  \"transition_peak\": " << plan.transition_peak << ",\n";
+    os << "  \"peak_step\": " << plan.peak_step << ",\n";
+    os << "  \"peak_step_size\": " << plan.peak_step_size << ",\n";
+    os << "  \"function_peak\": " << plan.function_peak << ",\n";
+
+    // Lifetime steps
+    os << "  \"steps\": [";
+    for(size_t i = 0; i < plan.steps.size(); ++i)
+    {
+        os << (i != 0 ? "," : "") << "\n    [";
+        for(size_t j = 0; j < plan.steps[i].size(); ++j)
+        {
+            os << (j != 0 ? ", " : "") << quoted(node_name(g, plan.steps[i][j]));
+        }
+        os << "]";
+    }
+    os << (plan.steps.empty() ? "" : "\n  ") << "],\n";
+
+    // Transition buffers
+    os << "  \"transitions\": [";
+    for(size_t i = 0; i < plan.transitions.size(); ++i)
+    {
+        const TransitionMemoryPlan &transition = plan.transitions[i];
+        std::stringstream           target;
+        target << transition.target;
+
+        os << (i != 0 ? "," : "") << "\n    { ";
+        os << "\"tensors\": ";
+        print_list(os, transition.tensors);
+        os << ", \"producer\": " << producer_name(g, transition.tensors);
+        os << ", \"target\": " << quoted(target.str());
+        os << ", \"size\": " << transition.size;
+        os << ", \"start\": " << transition.start;
+        os << ", \"end\": " << transition.end;
+        os << ", " << ((transition.mapping_type == MappingType::OFFSETS) ? "\"offset\": " : "\"blob\": ") << transition.mapping;
+        os << " }";
+    }
+    os << (plan.transitions.empty() ? "" : "\n  ") << "],\n";
+
+    // Auxiliary memory of the functions
+    os << "  \"functions\": [";
+    for(size_t i = 0; i < plan.functions.size(); ++i)
+    {
+        const FunctionMemoryPlan &function = plan.functions[i];
+        os << (i != 0 ? "," : "") << "\n    { ";
+        os << "\"node\": " << quoted(node_name(g, function.node));
+        os << ", \"size\": " << function.size;
+        os << " }";
+    }
+    os << (plan.functions.empty() ? "" : "\n  ") << "]\n";
+    os << "}\n";
+}
+} // namespace graph
+} // namespace arm_compute
@@ -27,23 +27,145 @@
 #include "arm_compute/core/Error.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif /* defined(__linux__) */
 
 using namespace arm_compute;
 
+namespace
+{
+/** Allocates memory aligned to the given alignment
+ *
+ * The pointer returned by ::operator new is stored right before the aligned pointer.
+ *
+ * @param[in] size      Size to allocate
+ * @param[in] alignment Alignment of the returned pointer. Must be a power of 2.
+ *
+ * @return A pointer to the allocated memory
+ */
+void *aligned_allocate(size_t size, size_t alignment)
+{
+    auto *const     raw     = static_cast<uint8_t *>(::operator new(size + alignment - 1 + sizeof(void *)));
+    const uintptr_t start   = reinterpret_cast<uintptr_t>(raw + sizeof(void *));
+    auto *const     aligned = reinterpret_cast<uint8_t *>((start + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1));
+
+    reinterpret_cast<void **>(aligned)[-1] = raw;
+    return aligned;
+}
+
+/** Frees memory allocated with @ref aligned_allocate
+ *
+ * @param[in] ptr Pointer returned by @ref aligned_allocate
+ */
+void aligned_free(void *ptr)
+{
+    ::operator delete(reinterpret_cast<void **>(ptr)[-1]);
+}
+
+/** Rounds an alignment up to a power of 2 not smaller than a cache line
+ *
+ * @param[in] alignment Requested alignment
+ *
+ * @return Alignment to use
+ */
+size_t effective_alignment(size_t alignment)
+{
+    size_t result = Allocator::cache_line_size;
+    while(result < alignment)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+} // namespace
+
+constexpr size_t Allocator::cache_line_size;
+constexpr size_t Allocator::huge_page_size;
+
+Allocator::Allocator()
+    : Allocator(HugePagePolicy::NONE)
+{
+}
+
+Allocator::Allocator(HugePagePolicy huge_pages, size_t huge_page_threshold)
+    : _huge_pages(huge_pages), _huge_page_threshold(huge_page_threshold), _mtx(), _mapped_regions()
+{
+}
+
+void Allocator::set_huge_pages(HugePagePolicy huge_pages, size_t huge_page_threshold)
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _huge_pages          = huge_pages;
+    _huge_page_threshold = huge_page_threshold;
+}
+
+HugePagePolicy Allocator::huge_pages() const
+{
+    return _huge_pages;
+}
+
 void *Allocator::allocate(size_t size, size_t alignment)
 {
-    ARM_COMPUTE_UNUSED(alignment);
-    return ::operator new(size);
+    alignment = effective_alignment(alignment);
+
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    if(_huge_pages == HugePagePolicy::NONE || size < _huge_page_threshold)
+    {
+        return aligned_allocate(size, alignment);
+    }
+
+#if defined(__linux__)
+#if defined(MAP_HUGETLB)
+    if(_huge_pages == HugePagePolicy::EXPLICIT && alignment <= huge_page_size)
+    {
+        // Map the region from the pool of reserved huge pages
+        const size_t mapped_size = ((size + huge_page_size - 1) / huge_page_size) * huge_page_size;
+        void        *ptr         = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if(ptr != MAP_FAILED)
+        {
+            _mapped_regions.emplace(ptr, mapped_size);
+            return ptr;
+        }
+    }
+#endif /* defined(MAP_HUGETLB) */
+
+    // Transparent huge pages can only back huge page aligned ranges
+    void *ptr = aligned_allocate(size, std::max(alignment, huge_page_size));
+#if defined(MADV_HUGEPAGE)
+    madvise(ptr, size, MADV_HUGEPAGE);
+#endif /* defined(MADV_HUGEPAGE) */
+    return ptr;
+#else  /* defined(__linux__) */
+    return aligned_allocate(size, alignment);
+#endif /* defined(__linux__) */
 }
 
 void Allocator::free(void *ptr)
 {
-    ::operator delete(ptr);
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+#if defined(__linux__)
+    auto it = _mapped_regions.find(ptr);
+    if(it != std::end(_mapped_regions))
+    {
+        munmap(it->first, it->second);
+        _mapped_regions.erase(it);
+        return;
+    }
+#endif /* defined(__linux__) */
+    aligned_free(ptr);
 }
 
 std::unique_ptr<IMemoryRegion> Allocator::make_region(size_t size, size_t alignment)
 {
-    ARM_COMPUTE_UNUSED(alignment);
-    return arm_compute::support::cpp14::make_unique<MemoryRegion>(size);
-}
\ No newline at end of file
+    return arm_compute::support::cpp14::make_unique<MemoryRegion>(size, effective_alignment(alignment));
+}
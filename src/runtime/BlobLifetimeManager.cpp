@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <numeric>
 #include <vector>
 
 using namespace arm_compute;
@@ -47,6 +48,12 @@ std::unique_ptr<IMemoryPool> BlobLifetimeManager::create_pool(IAllocator *alloca
     return support::cpp14::make_unique<BlobMemoryPool>(allocator, _blobs);
 }
 
+std::unique_ptr<IMemoryPool> BlobLifetimeManager::create_pool(MemoryArena *arena)
+{
+    ARM_COMPUTE_ERROR_ON(arena == nullptr);
+    return support::cpp14::make_unique<BlobMemoryPool>(arena, _blobs);
+}
+
 MappingType BlobLifetimeManager::mapping_type() const
 {
     return MappingType::BLOBS;
@@ -68,6 +75,8 @@ void BlobLifetimeManager::update_blobs_and_mappings()
         return b.max_size;
     });
 
+    _footprints.push_back(GroupFootprint{ _active_group, std::accumulate(std::begin(group_sizes), std::end(group_sizes), static_cast<size_t>(0)) });
+
     // Update blob sizes
     size_t max_size = std::max(_blobs.size(), group_sizes.size());
     _blobs.resize(max_size, 0);
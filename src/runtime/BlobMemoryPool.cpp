@@ -26,6 +26,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/MemoryArena.h"
 #include "arm_compute/runtime/Types.h"
 #include "support/ToolchainSupport.h"
 
@@ -34,20 +35,32 @@
 using namespace arm_compute;
 
 BlobMemoryPool::BlobMemoryPool(IAllocator *allocator, std::vector<size_t> blob_sizes)
-    : _allocator(allocator), _blobs(), _blob_sizes(std::move(blob_sizes))
+    : _allocator(allocator), _arena(nullptr), _blobs(), _blob_sizes(std::move(blob_sizes))
 {
     ARM_COMPUTE_ERROR_ON(!allocator);
     allocate_blobs(_blob_sizes);
 }
 
+BlobMemoryPool::BlobMemoryPool(MemoryArena *arena, std::vector<size_t> blob_sizes)
+    : _allocator(nullptr), _arena(arena), _blobs(), _blob_sizes(std::move(blob_sizes))
+{
+    ARM_COMPUTE_ERROR_ON(!arena);
+}
+
 BlobMemoryPool::~BlobMemoryPool()
 {
-    ARM_COMPUTE_ERROR_ON(!_allocator);
     free_blobs();
 }
 
 void BlobMemoryPool::acquire(MemoryMappings &handles)
 {
+    // Lease the blobs for the duration of the acquisition
+    if(_arena != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(!_blobs.empty(), "Memory pool is already acquired!");
+        allocate_blobs(_blob_sizes);
+    }
+
     // Set memory to handlers
     for(auto &handle : handles)
     {
@@ -63,6 +76,12 @@ void BlobMemoryPool::release(MemoryMappings &handles)
         ARM_COMPUTE_ERROR_ON(handle.first == nullptr);
         *handle.first = nullptr;
     }
+
+    // Return the blobs to the arena
+    if(_arena != nullptr)
+    {
+        free_blobs();
+    }
 }
 
 MappingType BlobMemoryPool::mapping_type() const
@@ -72,27 +91,38 @@ MappingType BlobMemoryPool::mapping_type() const
 
 std::unique_ptr<IMemoryPool> BlobMemoryPool::duplicate()
 {
+    if(_arena != nullptr)
+    {
+        return support::cpp14::make_unique<BlobMemoryPool>(_arena, _blob_sizes);
+    }
     ARM_COMPUTE_ERROR_ON(!_allocator);
     return support::cpp14::make_unique<BlobMemoryPool>(_allocator, _blob_sizes);
 }
 
 void BlobMemoryPool::allocate_blobs(const std::vector<size_t> &sizes)
 {
-    ARM_COMPUTE_ERROR_ON(!_allocator);
+    ARM_COMPUTE_ERROR_ON(!_allocator && !_arena);
 
     for(const auto &size : sizes)
     {
-        _blobs.push_back(_allocator->allocate(size, 0));
+        _blobs.push_back((_arena != nullptr) ? _arena->lease(size) : _allocator->allocate(size, 0));
     }
 }
 
 void BlobMemoryPool::free_blobs()
 {
-    ARM_COMPUTE_ERROR_ON(!_allocator);
+    ARM_COMPUTE_ERROR_ON(!_allocator && !_arena);
 
     for(auto &blob : _blobs)
     {
-        _allocator->free(blob);
+        if(_arena != nullptr)
+        {
+            _arena->release(blob);
+        }
+        else
+        {
+            _allocator->free(blob);
+        }
     }
     _blobs.clear();
 }
\ No newline at end of file
@@ -28,8 +28,11 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/CPUUtils.h"
+#include "support/ToolchainSupport.h"
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <iostream>
 #include <mutex>
 #include <system_error>
@@ -37,6 +40,361 @@
 
 namespace arm_compute
 {
+namespace
+{
+/** Default number of chunks per thread used by the dynamic strategy */
+constexpr unsigned int default_dynamic_workloads_per_thread = 4;
+/** Number of kernels which can be submitted asynchronously without waiting for the oldest one */
+constexpr unsigned int max_async_kernels = 16;
+
+/** Hint the CPU that the calling thread is busy-waiting */
+inline void cpu_relax()
+{
+#if defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::
+                             : "memory");
+#elif defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__("pause" ::
+                             : "memory");
+#endif /* defined(__aarch64__) || defined(__arm__) */
+}
+} // namespace
+
+/** Lock-free range of window chunks owned by one thread of the pool.
+ *
+ * The owner pops chunks from the front of the range while idle threads steal chunks from its back.
+ * Both ends of the range are packed in a single 64-bit word so that they can be updated by a single compare-and-swap.
+ */
+class WorkStealingRange
+{
+public:
+    /** Default constructor: empty range */
+    WorkStealingRange()
+        : _range(0)
+    {
+    }
+    /** Set the chunks owned by the thread
+     *
+     * @param[in] begin Index of the first chunk.
+     * @param[in] end   Index one past the last chunk.
+     */
+    void reset(unsigned int begin, unsigned int end)
+    {
+        _range.store(pack(begin, end), std::memory_order_relaxed);
+    }
+    /** Pop a chunk from the front of the range (Used by the owner)
+     *
+     * @param[out] index Index of the popped chunk.
+     *
+     * @return False if the range is empty.
+     */
+    bool pop_front(unsigned int &index)
+    {
+        uint64_t range = _range.load(std::memory_order_relaxed);
+        while(begin_of(range) < end_of(range))
+        {
+            if(_range.compare_exchange_weak(range, pack(begin_of(range) + 1, end_of(range)), std::memory_order_relaxed))
+            {
+                index = begin_of(range);
+                return true;
+            }
+        }
+        return false;
+    }
+    /** Steal a chunk from the back of the range (Used by the other threads)
+     *
+     * @param[out] index Index of the stolen chunk.
+     *
+     * @return False if the range is empty.
+     */
+    bool steal_back(unsigned int &index)
+    {
+        uint64_t range = _range.load(std::memory_order_relaxed);
+        while(begin_of(range) < end_of(range))
+        {
+            if(_range.compare_exchange_weak(range, pack(begin_of(range), end_of(range) - 1), std::memory_order_relaxed))
+            {
+                index = end_of(range) - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static uint64_t pack(unsigned int begin, unsigned int end)
+    {
+        return (static_cast<uint64_t>(begin) << 32) | static_cast<uint64_t>(end);
+    }
+    static unsigned int begin_of(uint64_t range)
+    {
+        return static_cast<unsigned int>(range >> 32);
+    }
+    static unsigned int end_of(uint64_t range)
+    {
+        return static_cast<unsigned int>(range & 0xFFFFFFFF);
+    }
+
+    std::atomic<uint64_t> _range;
+};
+
+/** Work sent to a thread of the pool other than a single window of a kernel */
+class IThreadWorkload
+{
+public:
+    /** Default destructor */
+    virtual ~IThreadWorkload() = default;
+    /** Execute the workload
+     *
+     * @param[in] info Info about the executing thread.
+     */
+    virtual void run(const ThreadInfo &info) = 0;
+};
+
+/** Chunks of a kernel's window shared between the threads of the pool when the dynamic strategy is used */
+class WorkStealingFeeder final : public IThreadWorkload
+{
+public:
+    /** Constructor: distribute the chunks evenly among the threads
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] max_window      Window to split.
+     * @param[in] split_dimension Dimension along which to split the window.
+     * @param[in] num_windows     Number of chunks to split the window in.
+     * @param[in] ranges          Ranges of chunks, one per thread.
+     * @param[in] num_threads     Number of threads taking part in the execution.
+     */
+    WorkStealingFeeder(ICPPKernel *kernel, const Window &max_window, unsigned int split_dimension, unsigned int num_windows,
+                       std::vector<WorkStealingRange> &ranges, unsigned int num_threads)
+        : _kernel(kernel), _max_window(max_window), _split_dimension(split_dimension), _num_windows(num_windows), _ranges(ranges)
+    {
+        ARM_COMPUTE_ERROR_ON(ranges.size() < num_threads);
+        for(unsigned int t = 0; t < num_threads; ++t)
+        {
+            _ranges[t].reset(t * num_windows / num_threads, (t + 1) * num_windows / num_threads);
+        }
+    }
+    /** Run the chunks owned by the calling thread, then steal and run the chunks left by the other threads
+     *
+     * @param[in] info Info about the calling thread.
+     */
+    void run(const ThreadInfo &info) override
+    {
+        unsigned int index = 0;
+
+        WorkStealingRange &own_range = _ranges[info.thread_id];
+        while(own_range.pop_front(index))
+        {
+            run_window(index, info);
+        }
+
+        for(int i = 1; i < info.num_threads; ++i)
+        {
+            WorkStealingRange &victim_range = _ranges[(info.thread_id + i) % info.num_threads];
+            while(victim_range.steal_back(index))
+            {
+                run_window(index, info);
+            }
+        }
+    }
+
+private:
+    void run_window(unsigned int index, const ThreadInfo &info) const
+    {
+        const Window win = _max_window.split_window(_split_dimension, index, _num_windows);
+        win.validate();
+        _kernel->run(win, info);
+    }
+
+    ICPPKernel                     *_kernel;
+    const Window                   &_max_window;
+    unsigned int                    _split_dimension;
+    unsigned int                    _num_windows;
+    std::vector<WorkStealingRange> &_ranges;
+};
+
+/** Queue of kernel windows submitted asynchronously
+ *
+ * The queue is drained by the threads of the pool and by the thread waiting for a submitted kernel.
+ * The states of the kernels and the queued windows are stored in rings allocated by @ref configure,
+ * so that submitting a kernel doesn't allocate.
+ */
+class AsyncKernelQueue final : public IThreadWorkload
+{
+public:
+    /** Default constructor: empty queue, @ref configure must be called before pushing windows */
+    AsyncKernelQueue()
+        : _m(), _chunks(), _head(0), _size(0), _states(max_async_kernels), _next_state(0), _next_ticket(0), _draining()
+    {
+    }
+    /** Allocate the storage of the windows for a number of threads
+     *
+     * @note Must only be called while the queue is empty and no thread of the pool drains it.
+     *
+     * @param[in] num_threads Maximum number of windows a kernel is split in.
+     */
+    void configure(unsigned int num_threads)
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        ARM_COMPUTE_ERROR_ON(_size != 0);
+        _chunks.resize(max_async_kernels * num_threads);
+        _head = 0;
+        _draining.assign(num_threads, false);
+    }
+    /** Get a state for a new kernel
+     *
+     * The states are used in turn: the queue is drained until the kernel which used the state last has completed.
+     *
+     * @return The state of the new kernel, with a ticket different from the ones of the previous kernels.
+     */
+    IScheduler::AsyncState *acquire_state()
+    {
+        IScheduler::AsyncState &state = _states[_next_state];
+        _next_state                   = (_next_state + 1) % _states.size();
+
+        while(state.pending.load(std::memory_order_acquire) != 0)
+        {
+            if(!run_one())
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        state.exception = nullptr;
+        state.ticket    = ++_next_ticket;
+        return &state;
+    }
+    /** Push the windows of a kernel to the queue
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] split_dimension Dimension along which to split the kernel's window.
+     * @param[in] info            Info to pass to the kernel. info.num_threads is the number of windows to split the kernel's window in.
+     * @param[in] state           State returned by @ref acquire_state to update as the windows get executed.
+     */
+    void push(ICPPKernel *kernel, unsigned int split_dimension, ThreadInfo info, IScheduler::AsyncState *state)
+    {
+        const Window &max_window = kernel->window();
+        state->pending.store(info.num_threads, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(_m);
+        // Only the kernels of the acquired states have windows in the queue
+        ARM_COMPUTE_ERROR_ON(_size + info.num_threads > _chunks.size());
+        for(int t = 0; t < info.num_threads; ++t)
+        {
+            info.thread_id = t;
+            _chunks[(_head + _size) % _chunks.size()] = Chunk{ kernel, info.num_threads == 1 ? max_window : max_window.split_window(split_dimension, t, info.num_threads), info, state };
+            ++_size;
+        }
+    }
+    /** Mark a thread of the pool as draining the queue
+     *
+     * A thread stops draining under the queue's lock once it finds the queue empty,
+     * so a thread still marked as draining is guaranteed to see the windows pushed before this call.
+     *
+     * @param[in] thread_id Index of the thread in the pool.
+     *
+     * @return False if the thread is already draining the queue, true if it must be started.
+     */
+    bool start_draining(unsigned int thread_id)
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        ARM_COMPUTE_ERROR_ON(thread_id >= _draining.size());
+        if(_draining[thread_id])
+        {
+            return false;
+        }
+        _draining[thread_id] = true;
+        return true;
+    }
+    /** Pop a window from the queue and execute it (Used by the calling thread)
+     *
+     * @return False if the queue was empty.
+     */
+    bool run_one()
+    {
+        Chunk chunk{};
+        if(!pop(chunk, -1))
+        {
+            return false;
+        }
+        execute(chunk);
+        return true;
+    }
+    /** Drain the queue (Used by the threads of the pool)
+     *
+     * @param[in] info Info about the calling thread: only thread_id is used, each window carries its own info.
+     */
+    void run(const ThreadInfo &info) override
+    {
+        Chunk chunk{};
+        while(pop(chunk, info.thread_id))
+        {
+            execute(chunk);
+        }
+    }
+
+private:
+    struct Chunk
+    {
+        ICPPKernel             *kernel;
+        Window                  window;
+        ThreadInfo              info;
+        IScheduler::AsyncState *state;
+    };
+
+    /** Pop a window from the queue
+     *
+     * @param[out] chunk     Popped window.
+     * @param[in]  thread_id Index of the calling thread in the pool, -1 for the thread which submits the kernels.
+     *
+     * @return False if the queue was empty, in which case a thread of the pool stops draining.
+     */
+    bool pop(Chunk &chunk, int thread_id)
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        if(_size == 0)
+        {
+            if(thread_id >= 0)
+            {
+                _draining[thread_id] = false;
+            }
+            return false;
+        }
+        chunk = _chunks[_head];
+        _head = (_head + 1) % _chunks.size();
+        --_size;
+        return true;
+    }
+    void execute(Chunk &chunk)
+    {
+        try
+        {
+            chunk.window.validate();
+            chunk.kernel->run(chunk.window, chunk.info);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            if(chunk.state->exception == nullptr)
+            {
+                chunk.state->exception = std::current_exception();
+            }
+        }
+
+        // Publishes the result of the window (And the exception if any) to the waiting thread
+        chunk.state->pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    std::mutex                          _m;
+    std::vector<Chunk>                  _chunks;
+    size_t                              _head;
+    size_t                              _size;
+    std::vector<IScheduler::AsyncState> _states;
+    size_t                              _next_state;
+    uint64_t                            _next_ticket;
+    std::vector<bool>                   _draining;
+};
+
 class Thread
 {
 public:
@@ -57,22 +415,53 @@ public:
      */
     void start(ICPPKernel *kernel, const Window &window, const ThreadInfo &info);
 
+    /** Request the worker thread to start executing the given workload
+     * This function will return as soon as the workload has been sent to the worker thread.
+     * wait() needs to be called to ensure the execution is complete.
+     */
+    void start(IThreadWorkload *workload, const ThreadInfo &info);
+
     /** Wait for the current kernel execution to complete. */
     void wait();
 
     /** Function ran by the worker thread. */
     void worker_thread();
 
+    /** Set the number of polling iterations to busy-wait for before parking on the condition variable
+     *
+     * @param[in] spin_budget Number of polling iterations.
+     */
+    void set_spin_budget(unsigned int spin_budget);
+
 private:
-    std::thread             _thread;
-    ICPPKernel             *_kernel{ nullptr };
-    Window                  _window;
-    ThreadInfo              _info;
-    std::mutex              _m;
-    std::condition_variable _cv;
-    bool                    _wait_for_work{ false };
-    bool                    _job_complete{ true };
-    std::exception_ptr      _current_exception;
+    /** Publish a new job to the worker thread and wake it up if it is parked */
+    void notify_work();
+    /** Busy-wait for a condition then park on the condition variable until it becomes true
+     *
+     * @param[in] parked    Flag raised while parked, used by the other side to know whether it must notify.
+     * @param[in] condition Condition to wait for.
+     */
+    template <typename Condition>
+    void spin_then_park(std::atomic<bool> &parked, Condition &&condition);
+    /** Wake up the other side if it is parked
+     *
+     * @param[in] parked Flag raised by the other side while parked.
+     */
+    void unpark(const std::atomic<bool> &parked);
+
+    std::thread               _thread;
+    ICPPKernel               *_kernel{ nullptr };
+    IThreadWorkload          *_workload{ nullptr };
+    Window                    _window;
+    ThreadInfo                _info;
+    std::mutex                _m;
+    std::condition_variable   _cv;
+    std::atomic<unsigned int> _work_generation{ 0 };
+    std::atomic<unsigned int> _done_generation{ 0 };
+    std::atomic<bool>         _worker_parked{ false };
+    std::atomic<bool>         _caller_parked{ false };
+    std::atomic<unsigned int> _spin_budget{ 0 };
+    std::exception_ptr        _current_exception;
 };
 
 Thread::Thread()
@@ -86,70 +475,165 @@ Thread::~Thread()
     // Make sure worker thread has ended
     if(_thread.joinable())
     {
-        start(nullptr, Window(), ThreadInfo());
+        start(static_cast<ICPPKernel *>(nullptr), Window(), ThreadInfo());
         _thread.join();
     }
 }
 
 void Thread::start(ICPPKernel *kernel, const Window &window, const ThreadInfo &info)
 {
-    _kernel = kernel;
-    _window = window;
-    _info   = info;
+    _kernel   = kernel;
+    _workload = nullptr;
+    _window   = window;
+    _info     = info;
+
+    notify_work();
+}
+
+void Thread::start(IThreadWorkload *workload, const ThreadInfo &info)
+{
+    _kernel   = nullptr;
+    _workload = workload;
+    _info     = info;
+
+    notify_work();
+}
+
+void Thread::set_spin_budget(unsigned int spin_budget)
+{
+    _spin_budget.store(spin_budget, std::memory_order_relaxed);
+}
+
+void Thread::notify_work()
+{
+    // The increment publishes the job set up by start() to the worker thread
+    _work_generation.fetch_add(1);
+    unpark(_worker_parked);
+}
 
+template <typename Condition>
+void Thread::spin_then_park(std::atomic<bool> &parked, Condition &&condition)
+{
+    const unsigned int spin_budget = _spin_budget.load(std::memory_order_relaxed);
+    for(unsigned int i = 0; i < spin_budget; ++i)
     {
-        std::lock_guard<std::mutex> lock(_m);
-        _wait_for_work = true;
-        _job_complete  = false;
+        if(condition())
+        {
+            return;
+        }
+        cpu_relax();
     }
-    _cv.notify_one();
+
+    std::unique_lock<std::mutex> lock(_m);
+    parked.store(true);
+    _cv.wait(lock, condition);
+    parked.store(false);
 }
 
-void Thread::wait()
+void Thread::unpark(const std::atomic<bool> &parked)
 {
+    // The other side raises its flag before checking the condition under the lock:
+    // if the flag isn't raised yet it will see the update made before calling this function.
+    if(parked.load())
     {
-        std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _job_complete; });
+        {
+            std::lock_guard<std::mutex> lock(_m);
+        }
+        _cv.notify_all();
     }
+}
+
+void Thread::wait()
+{
+    // Only the calling thread starts jobs, so the current generation is the one of the last job sent
+    const unsigned int generation = _work_generation.load(std::memory_order_relaxed);
+    spin_then_park(_caller_parked, [&] { return _done_generation.load() == generation; });
 
+    // The thread can be waited for again without a new job (See CPPScheduler::barrier): only report the exception once
     if(_current_exception)
     {
-        std::rethrow_exception(_current_exception);
+        std::exception_ptr exception = _current_exception;
+        _current_exception           = nullptr;
+        std::rethrow_exception(exception);
     }
 }
 
 void Thread::worker_thread()
 {
+    unsigned int generation = 0;
     while(true)
     {
-        std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _wait_for_work; });
-        _wait_for_work = false;
+        spin_then_park(_worker_parked, [&] { return _work_generation.load() != generation; });
+        ++generation;
 
         _current_exception = nullptr;
 
         // Time to exit
-        if(_kernel == nullptr)
+        if(_kernel == nullptr && _workload == nullptr)
         {
             return;
         }
 
         try
         {
-            _window.validate();
-            _kernel->run(_window, _info);
+            if(_workload != nullptr)
+            {
+                _workload->run(_info);
+            }
+            else
+            {
+                _window.validate();
+                _kernel->run(_window, _info);
+            }
         }
         catch(...)
         {
             _current_exception = std::current_exception();
         }
 
-        _job_complete = true;
-        lock.unlock();
-        _cv.notify_one();
+        // The store publishes the result of the job (And its exception if any) to the calling thread
+        _done_generation.store(generation);
+        unpark(_caller_parked);
     }
 }
 
+namespace
+{
+/** Waits for the threads of the pool to complete their job
+ *
+ * The jobs may refer to the stack of the calling thread: all the threads are waited for before any exception is rethrown.
+ *
+ * @param[in] threads   Threads to wait for.
+ * @param[in] exception Exception thrown by the calling thread while taking part in the job, if any.
+ */
+void wait_for_threads(std::list<Thread> &threads, std::exception_ptr exception)
+{
+    for(auto &thread : threads)
+    {
+        try
+        {
+            thread.wait();
+        }
+        catch(const std::system_error &e)
+        {
+            std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+        }
+        catch(...)
+        {
+            if(exception == nullptr)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+    if(exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+} // namespace
+
 CPPScheduler &CPPScheduler::get()
 {
     static CPPScheduler scheduler;
@@ -158,15 +642,34 @@ CPPScheduler &CPPScheduler::get()
 
 CPPScheduler::CPPScheduler()
     : _num_threads(num_threads_hint()),
-      _threads(_num_threads - 1)
+      _dynamic_workloads_per_thread(default_dynamic_workloads_per_thread),
+      _spin_budget(0),
+      _threads(_num_threads - 1),
+      _ranges(_num_threads),
+      _async_queue(support::cpp14::make_unique<AsyncKernelQueue>()),
+      _async_pending(false)
 {
     get_cpu_configuration(_cpu_info);
+    _async_queue->configure(_num_threads);
+}
+
+CPPScheduler::~CPPScheduler()
+{
+    barrier();
 }
 
 void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
+    // Threads can't be destroyed while they execute asynchronous work
+    barrier();
+
     _num_threads = num_threads == 0 ? num_threads_hint() : num_threads;
     _threads.resize(_num_threads - 1);
+    _ranges = std::vector<WorkStealingRange>(_num_threads);
+    _async_queue->configure(_num_threads);
+
+    // Newly created threads need to know about the spin budget
+    set_spin_budget(_spin_budget);
 }
 
 unsigned int CPPScheduler::num_threads() const
@@ -174,17 +677,116 @@ unsigned int CPPScheduler::num_threads() const
     return _num_threads;
 }
 
-void CPPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
+void CPPScheduler::set_dynamic_workloads_per_thread(unsigned int num_workloads)
+{
+    ARM_COMPUTE_ERROR_ON(num_workloads == 0);
+    _dynamic_workloads_per_thread = num_workloads;
+}
+
+unsigned int CPPScheduler::dynamic_workloads_per_thread() const
+{
+    return _dynamic_workloads_per_thread;
+}
+
+void CPPScheduler::set_spin_budget(unsigned int spin_budget)
+{
+    _spin_budget = spin_budget;
+    for(auto &thread : _threads)
+    {
+        thread.set_spin_budget(spin_budget);
+    }
+}
+
+unsigned int CPPScheduler::spin_budget() const
+{
+    return _spin_budget;
+}
+
+IScheduler::Token CPPScheduler::submit(ICPPKernel *kernel, const Hints &hints)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    ThreadInfo info;
+    info.cpu_info = &_cpu_info;
+
+    const unsigned int num_iterations = kernel->window().num_iterations(hints.split_dimension());
+    info.num_threads                  = kernel->is_parallelisable() ? std::min(num_iterations, _num_threads) : 1;
+
+    if(num_iterations == 0)
+    {
+        return Token();
+    }
+
+    AsyncState *state = _async_queue->acquire_state();
+    _async_queue->push(kernel, hints.split_dimension(), info, state);
+    _async_pending = true;
+
+    // Start the threads which aren't draining the queue: the draining ones will pick the new windows up once done with their current ones
+    int t = 0;
+    for(auto &thread : _threads)
+    {
+        if(_async_queue->start_draining(t))
+        {
+            // The thread might have found the queue empty but not be done publishing the end of its previous job yet
+            thread.wait();
+            info.thread_id = t;
+            thread.start(_async_queue.get(), info);
+        }
+        ++t;
+    }
+
+    return Token(state);
+}
+
+void CPPScheduler::wait(const Token &token)
+{
+    while(!token.is_complete())
+    {
+        // Help draining the queue rather than idling
+        if(!_async_queue->run_one())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    if(token.state() != nullptr && token.state()->exception != nullptr)
+    {
+        std::rethrow_exception(token.state()->exception);
+    }
+}
+
+void CPPScheduler::barrier()
+{
+    if(!_async_pending)
+    {
+        return;
+    }
+
+    while(_async_queue->run_one())
+    {
+    }
+    for(auto &thread : _threads)
+    {
+        thread.wait();
+    }
+    _async_pending = false;
+}
+
+void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 
+    // Threads must be done with the asynchronous work before being sent a synchronous job
+    barrier();
+
     /** [Scheduler example] */
     ThreadInfo info;
     info.cpu_info = &_cpu_info;
 
-    const Window      &max_window     = kernel->window();
-    const unsigned int num_iterations = max_window.num_iterations(split_dimension);
-    info.num_threads                  = std::min(num_iterations, _num_threads);
+    const unsigned int split_dimension = hints.split_dimension();
+    const Window      &max_window      = kernel->window();
+    const unsigned int num_iterations  = max_window.num_iterations(split_dimension);
+    info.num_threads                   = std::min(num_iterations, _num_threads);
 
     if(num_iterations == 0)
     {
@@ -195,6 +797,35 @@ void CPPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
     {
         kernel->run(max_window, info);
     }
+    else if(hints.strategy() == StrategyHint::DYNAMIC)
+    {
+        const unsigned int num_windows = std::min(num_iterations, info.num_threads * _dynamic_workloads_per_thread);
+        WorkStealingFeeder feeder(kernel, max_window, split_dimension, num_windows, _ranges, info.num_threads);
+
+        int  t         = 0;
+        auto thread_it = _threads.begin();
+
+        for(; t < info.num_threads - 1; ++t, ++thread_it)
+        {
+            info.thread_id = t;
+            thread_it->start(&feeder, info);
+        }
+
+        // Main thread takes part in the execution and steals from the others once done with its own chunks
+        std::exception_ptr exception = nullptr;
+        info.thread_id               = t;
+        try
+        {
+            feeder.run(info);
+        }
+        catch(...)
+        {
+            exception = std::current_exception();
+        }
+
+        // The threads use the feeder until they are done
+        wait_for_threads(_threads, exception);
+    }
     else
     {
         int  t         = 0;
@@ -208,21 +839,19 @@ void CPPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
         }
 
         // Run last part on main thread
-        Window win     = max_window.split_window(split_dimension, t, info.num_threads);
-        info.thread_id = t;
-        kernel->run(win, info);
-
+        std::exception_ptr exception = nullptr;
+        Window             win       = max_window.split_window(split_dimension, t, info.num_threads);
+        info.thread_id               = t;
         try
         {
-            for(auto &thread : _threads)
-            {
-                thread.wait();
-            }
+            kernel->run(win, info);
         }
-        catch(const std::system_error &e)
+        catch(...)
         {
-            std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+            exception = std::current_exception();
         }
+
+        wait_for_threads(_threads, exception);
     }
     /** [Scheduler example] */
 }
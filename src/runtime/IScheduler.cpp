@@ -23,6 +23,7 @@
  */
 #include "arm_compute/runtime/IScheduler.h"
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/CPUUtils.h"
 
 namespace arm_compute
@@ -43,4 +44,50 @@ unsigned int IScheduler::num_threads_hint() const
 {
     return _num_threads_hint;
 }
+
+void IScheduler::set_gemm_tuner(NEGEMMTuner *tuner)
+{
+    _gemm_tuner = tuner;
+}
+
+NEGEMMTuner *IScheduler::gemm_tuner() const
+{
+    return _gemm_tuner;
+}
+
+void IScheduler::set_weights_cache(NEPackedWeightsCache *cache)
+{
+    _weights_cache = cache;
+}
+
+NEPackedWeightsCache *IScheduler::weights_cache() const
+{
+    return _weights_cache;
+}
+
+void IScheduler::set_gemm_profiler(NEGEMMProfiler *profiler)
+{
+    _gemm_profiler = profiler;
+}
+
+NEGEMMProfiler *IScheduler::gemm_profiler() const
+{
+    return _gemm_profiler;
+}
+
+IScheduler::Token IScheduler::submit(ICPPKernel *kernel, const Hints &hints)
+{
+    schedule(kernel, hints);
+    return Token();
+}
+
+void IScheduler::wait(const Token &token)
+{
+    ARM_COMPUTE_UNUSED(token);
+    ARM_COMPUTE_ERROR_ON_MSG(!token.is_complete(), "Token submitted to a different scheduler");
+}
+
+void IScheduler::barrier()
+{
+}
 } // namespace arm_compute
@@ -37,7 +37,7 @@
 using namespace arm_compute;
 
 ISimpleLifetimeManager::ISimpleLifetimeManager()
-    : _active_group(nullptr), _active_elements(), _free_blobs(), _occupied_blobs(), _finalized_groups()
+    : _active_group(nullptr), _active_elements(), _free_blobs(), _occupied_blobs(), _finalized_groups(), _lifetime_events(0), _footprints()
 {
 }
 
@@ -68,6 +68,7 @@ void ISimpleLifetimeManager::start_lifetime(void *obj)
 
     // Insert object in groups and mark its finalized state to false
     _active_elements.insert(std::make_pair(obj, obj));
+    _active_elements[obj].start = _lifetime_events++;
 }
 
 void ISimpleLifetimeManager::end_lifetime(void *obj, void **handle, size_t size)
@@ -83,6 +84,7 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, void **handle, size_t size)
     el.handle   = handle;
     el.size     = size;
     el.status   = true;
+    el.end      = _lifetime_events++;
 
     // Find object in the occupied lists
     auto occupied_blob_it = std::find_if(std::begin(_occupied_blobs), std::end(_occupied_blobs), [&obj](const Blob & b)
@@ -112,6 +114,7 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, void **handle, size_t size)
         _active_elements.clear();
         _active_group = nullptr;
         _free_blobs.clear();
+        _lifetime_events = 0;
     }
 }
 
@@ -122,3 +125,34 @@ bool ISimpleLifetimeManager::are_all_finalized() const
         return !e.second.status;
     });
 }
+
+const std::vector<ISimpleLifetimeManager::GroupFootprint> &ISimpleLifetimeManager::footprints() const
+{
+    return _footprints;
+}
+
+bool ISimpleLifetimeManager::find_mapping(IMemoryGroup *group, void *obj, size_t &mapping, size_t &size) const
+{
+    const auto group_it = _finalized_groups.find(group);
+    if(group_it == std::end(_finalized_groups))
+    {
+        return false;
+    }
+
+    const auto element_it = group_it->second.find(obj);
+    if(element_it == std::end(group_it->second))
+    {
+        return false;
+    }
+
+    const auto &group_mappings = group->mappings();
+    const auto  mapping_it     = group_mappings.find(element_it->second.handle);
+    if(mapping_it == std::end(group_mappings))
+    {
+        return false;
+    }
+
+    mapping = mapping_it->second;
+    size    = element_it->second.size;
+    return true;
+}
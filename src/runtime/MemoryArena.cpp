@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoryArena.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IAllocator.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+
+MemoryArena::MemoryArena(IAllocator *allocator)
+    : _allocator(allocator), _slabs(), _mtx()
+{
+    ARM_COMPUTE_ERROR_ON(!allocator);
+}
+
+MemoryArena::~MemoryArena()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(num_leases() != 0, "Memory arena destroyed while slabs are still leased!");
+    for(auto &slab : _slabs)
+    {
+        _allocator->free(slab.ptr);
+    }
+    _slabs.clear();
+}
+
+void *MemoryArena::lease(size_t size)
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    // Best fit: smallest idle slab that is large enough
+    Slab *best    = nullptr;
+    Slab *largest = nullptr;
+    for(auto &slab : _slabs)
+    {
+        if(slab.leased)
+        {
+            continue;
+        }
+        if(slab.size >= size && (best == nullptr || slab.size < best->size))
+        {
+            best = &slab;
+        }
+        if(largest == nullptr || slab.size > largest->size)
+        {
+            largest = &slab;
+        }
+    }
+
+    if(best == nullptr)
+    {
+        if(largest != nullptr)
+        {
+            // Grow the largest idle slab instead of adding a new one
+            _allocator->free(largest->ptr);
+            largest->ptr  = _allocator->allocate(size, 0);
+            largest->size = size;
+            best          = largest;
+        }
+        else
+        {
+            _slabs.push_back(Slab{ _allocator->allocate(size, 0), size, false });
+            best = &_slabs.back();
+        }
+    }
+
+    best->leased = true;
+    return best->ptr;
+}
+
+void MemoryArena::release(void *slab)
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    auto it = std::find_if(std::begin(_slabs), std::end(_slabs), [&](const Slab & s)
+    {
+        return s.ptr == slab;
+    });
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_slabs) || !it->leased, "Slab is not leased from this arena!");
+    it->leased = false;
+}
+
+void MemoryArena::trim()
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    for(auto &slab : _slabs)
+    {
+        if(!slab.leased)
+        {
+            _allocator->free(slab.ptr);
+        }
+    }
+    _slabs.erase(std::remove_if(std::begin(_slabs), std::end(_slabs), [](const Slab & s)
+    {
+        return !s.leased;
+    }),
+    std::end(_slabs));
+}
+
+size_t MemoryArena::resident_size() const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    size_t total = 0;
+    for(const auto &slab : _slabs)
+    {
+        total += slab.size;
+    }
+    return total;
+}
+
+size_t MemoryArena::num_slabs() const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _slabs.size();
+}
+
+size_t MemoryArena::num_leases() const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return std::count_if(std::begin(_slabs), std::end(_slabs), [](const Slab & s)
+    {
+        return s.leased;
+    });
+}
@@ -32,7 +32,7 @@
 using namespace arm_compute;
 
 MemoryManagerOnDemand::MemoryManagerOnDemand(std::shared_ptr<ILifetimeManager> lifetime_manager, std::shared_ptr<IPoolManager> pool_manager)
-    : _lifetime_mgr(std::move(lifetime_manager)), _pool_mgr(std::move(pool_manager)), _allocator(nullptr), _is_finalized(false), _num_pools(1)
+    : _allocator_owner(nullptr), _lifetime_mgr(std::move(lifetime_manager)), _pool_mgr(std::move(pool_manager)), _allocator(nullptr), _arena(nullptr), _is_finalized(false), _num_pools(1)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!_lifetime_mgr, "Lifetime manager not specified correctly!");
     ARM_COMPUTE_ERROR_ON_MSG(!_pool_mgr, "Pool manager not specified correctly!");
@@ -56,6 +56,19 @@ void MemoryManagerOnDemand::set_allocator(IAllocator *allocator)
     _allocator = allocator;
 }
 
+void MemoryManagerOnDemand::set_allocator(std::shared_ptr<IAllocator> allocator)
+{
+    set_allocator(allocator.get());
+    _allocator_owner = std::move(allocator);
+}
+
+void MemoryManagerOnDemand::set_arena(MemoryArena *arena)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(is_finalized(), "Memory manager is already finalized!");
+    ARM_COMPUTE_ERROR_ON(arena == nullptr);
+    _arena = arena;
+}
+
 ILifetimeManager *MemoryManagerOnDemand::lifetime_manager()
 {
     return _lifetime_mgr.get();
@@ -72,10 +85,10 @@ void MemoryManagerOnDemand::finalize()
     ARM_COMPUTE_ERROR_ON(!_lifetime_mgr);
     ARM_COMPUTE_ERROR_ON(!_pool_mgr);
     ARM_COMPUTE_ERROR_ON_MSG(!_lifetime_mgr->are_all_finalized(), "All the objects have not been finalized! ");
-    ARM_COMPUTE_ERROR_ON(_allocator == nullptr);
+    ARM_COMPUTE_ERROR_ON(_allocator == nullptr && _arena == nullptr);
 
     // Create pools
-    auto pool_template = _lifetime_mgr->create_pool(_allocator);
+    auto pool_template = (_arena != nullptr) ? _lifetime_mgr->create_pool(_arena) : _lifetime_mgr->create_pool(_allocator);
     for(int i = _num_pools; i > 1; --i)
     {
         auto pool = pool_template->duplicate();
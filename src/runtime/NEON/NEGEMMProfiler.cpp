@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMProfiler.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <mutex>
+#include <utility>
+
+using namespace arm_compute;
+
+double NEGEMMProfiler::GEMMMeasurement::gflops() const
+{
+    if(time_ns == 0)
+    {
+        return 0.0;
+    }
+
+    const double macs = static_cast<double>(shape.M) * shape.N * shape.K * shape.batches * shape.multis;
+    return 2.0 * macs / time_ns;
+}
+
+uint64_t NEGEMMProfiler::GEMMMeasurement::bytes() const
+{
+    return phase(arm_gemm::ProfilePhase::PrepareA).units + phase(arm_gemm::ProfilePhase::PrepareB).units + phase(arm_gemm::ProfilePhase::Merge).units;
+}
+
+NEGEMMProfiler::Run::Run(std::string layer, const GEMMShape &shape)
+    : _layer(std::move(layer)), _shape(shape), _start(std::chrono::steady_clock::now()), _time_ns(0), _phases()
+{
+}
+
+void NEGEMMProfiler::Run::record(arm_gemm::ProfilePhase phase, uint64_t time_ns, uint64_t units)
+{
+    ARM_COMPUTE_ERROR_ON(phase >= arm_gemm::ProfilePhase::NumPhases);
+
+    AtomicPhase &p = _phases[static_cast<size_t>(phase)];
+    p.events.fetch_add(1, std::memory_order_relaxed);
+    p.time_ns.fetch_add(time_ns, std::memory_order_relaxed);
+    p.units.fetch_add(units, std::memory_order_relaxed);
+}
+
+void NEGEMMProfiler::Run::stop()
+{
+    _time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+}
+
+NEGEMMProfiler::GEMMMeasurement NEGEMMProfiler::Run::measurement() const
+{
+    GEMMMeasurement m;
+    m.layer   = _layer;
+    m.shape   = _shape;
+    m.time_ns = _time_ns;
+    for(size_t i = 0; i < num_phases; ++i)
+    {
+        m.phases[i].events  = _phases[i].events.load(std::memory_order_relaxed);
+        m.phases[i].time_ns = _phases[i].time_ns.load(std::memory_order_relaxed);
+        m.phases[i].units   = _phases[i].units.load(std::memory_order_relaxed);
+    }
+    return m;
+}
+
+NEGEMMProfiler::NEGEMMProfiler()
+    : _runs(), _layer(), _mtx()
+{
+}
+
+void NEGEMMProfiler::set_layer(std::string layer)
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _layer = std::move(layer);
+}
+
+arm_gemm::ProfileSink *NEGEMMProfiler::start_run(const GEMMShape &shape)
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _runs.emplace_back(_layer, shape);
+    return &_runs.back();
+}
+
+void NEGEMMProfiler::stop_run(arm_gemm::ProfileSink *run)
+{
+    ARM_COMPUTE_ERROR_ON(run == nullptr);
+
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    static_cast<Run *>(run)->stop();
+}
+
+std::vector<NEGEMMProfiler::GEMMMeasurement> NEGEMMProfiler::measurements() const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    std::vector<GEMMMeasurement> measurements;
+    measurements.reserve(_runs.size());
+    for(const auto &run : _runs)
+    {
+        measurements.emplace_back(run.measurement());
+    }
+    return measurements;
+}
+
+void NEGEMMProfiler::clear()
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _runs.clear();
+}
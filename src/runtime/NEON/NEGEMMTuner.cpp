@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+
+#include "arm_compute/core/Error.h"
+#include "support/ToolchainSupport.h"
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Number of timed runs of each candidate configuration, the fastest one is kept */
+constexpr unsigned int num_timed_runs = 3;
+
+const std::array<std::pair<arm_gemm::GemmMethod, const char *>, 6> gemm_methods =
+{
+    {
+        { arm_gemm::GemmMethod::DEFAULT, "default" },
+        { arm_gemm::GemmMethod::GEMV_PRETRANSPOSED, "gemv_pretransposed" },
+        { arm_gemm::GemmMethod::GEMV_NATIVE_TRANSPOSED, "gemv_native_transposed" },
+        { arm_gemm::GemmMethod::GEMM_NATIVE, "gemm_native" },
+        { arm_gemm::GemmMethod::GEMM_INTERLEAVED, "gemm_interleaved" },
+        { arm_gemm::GemmMethod::GEMM_INTERLEAVED_BATCHED, "gemm_interleaved_batched" },
+    }
+};
+
+std::string method_to_string(arm_gemm::GemmMethod method)
+{
+    for(const auto &m : gemm_methods)
+    {
+        if(m.first == method)
+        {
+            return m.second;
+        }
+    }
+    ARM_COMPUTE_ERROR("Unknown GEMM method");
+}
+
+bool method_from_string(const std::string &name, arm_gemm::GemmMethod &method)
+{
+    for(const auto &m : gemm_methods)
+    {
+        if(name == m.second)
+        {
+            method = m.first;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string cpu_model_to_string(CPUModel cpu_model)
+{
+    switch(cpu_model)
+    {
+        case CPUModel::A53:
+            return "A53";
+        case CPUModel::A55r0:
+            return "A55r0";
+        case CPUModel::A55r1:
+            return "A55r1";
+        case CPUModel::GENERIC:
+        default:
+            return "GENERIC";
+    }
+}
+
+/** Time a candidate configuration
+ *
+ * @param[in] runner Runner of the candidate configuration
+ *
+ * @return The duration of the fastest run in microseconds
+ */
+double time_candidate(const NEGEMMTuner::CandidateRunner &runner)
+{
+    // Warm up the caches and the pretransposed weights
+    runner();
+
+    double best = std::numeric_limits<double>::max();
+    for(unsigned int i = 0; i < num_timed_runs; ++i)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        runner();
+        const auto end = std::chrono::high_resolution_clock::now();
+        best           = std::min(best, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    return best;
+}
+} // namespace
+
+NEGEMMTuner::NEGEMMTuner(bool tune_new_gemms)
+    : _config_table(), _tune_new_gemms(tune_new_gemms)
+{
+}
+
+void NEGEMMTuner::set_tune_new_gemms(bool tune_new_gemms)
+{
+    _tune_new_gemms = tune_new_gemms;
+}
+
+bool NEGEMMTuner::tune_new_gemms() const
+{
+    return _tune_new_gemms;
+}
+
+void NEGEMMTuner::add_config_to_table(const std::string &gemm_id, const arm_gemm::GemmConfig &config)
+{
+    _config_table[gemm_id] = config;
+}
+
+void NEGEMMTuner::import_config_table(const std::unordered_map<std::string, arm_gemm::GemmConfig> &config_table)
+{
+    _config_table.clear();
+    _config_table = config_table;
+}
+
+const std::unordered_map<std::string, arm_gemm::GemmConfig> &NEGEMMTuner::config_table() const
+{
+    return _config_table;
+}
+
+arm_gemm::GemmConfig NEGEMMTuner::find_config(const std::string &gemm_id, unsigned int N, unsigned int K, const CandidateFactory &factory)
+{
+    auto p = _config_table.find(gemm_id);
+
+    if(p != _config_table.end())
+    {
+        return p->second;
+    }
+
+    if(!_tune_new_gemms)
+    {
+        return arm_gemm::GemmConfig();
+    }
+
+    // Find the fastest configuration and add it to the table
+    const arm_gemm::GemmConfig config = find_optimal_config(N, K, factory);
+    add_config_to_table(gemm_id, config);
+
+    return config;
+}
+
+std::string NEGEMMTuner::gemm_id(const std::string &data_type, unsigned int M, unsigned int N, unsigned int K, unsigned int batches, unsigned int multis,
+                                 unsigned int num_threads, bool pretranspose_hint, CPUModel cpu_model)
+{
+    std::stringstream ss;
+    ss << data_type << "_" << M << "x" << N << "x" << K << "_b" << batches << "_m" << multis << "_t" << num_threads << "_p" << pretranspose_hint << "_" << cpu_model_to_string(cpu_model);
+    return ss.str();
+}
+
+arm_gemm::GemmConfig NEGEMMTuner::find_optimal_config(unsigned int N, unsigned int K, const CandidateFactory &factory)
+{
+    std::vector<arm_gemm::GemmConfig> candidates;
+
+    // Non-blocked methods and the heuristics of the dispatcher
+    for(const auto &m : gemm_methods)
+    {
+        arm_gemm::GemmConfig config;
+        config.method = m.first;
+        candidates.push_back(config);
+    }
+
+    // Block sizes of the blocked method, 0 being the cache size based default
+    const std::array<unsigned int, 5> inner_block_sizes{ { 0, 64, 128, 256, 512 } };
+    const std::array<unsigned int, 6> outer_block_sizes{ { 0, 128, 256, 512, 1024, 2048 } };
+    for(const auto inner : inner_block_sizes)
+    {
+        for(const auto outer : outer_block_sizes)
+        {
+            // Blocks larger than the problem are equivalent to the problem size
+            if((inner == 0 && outer == 0) || inner >= K || outer >= N)
+            {
+                continue;
+            }
+
+            arm_gemm::GemmConfig config;
+            config.method           = arm_gemm::GemmMethod::GEMM_INTERLEAVED;
+            config.inner_block_size = inner;
+            config.outer_block_size = outer;
+            candidates.push_back(config);
+        }
+    }
+
+    // Keep the first (i.e. the most default) of equally fast configurations
+    arm_gemm::GemmConfig best_config;
+    double               best_time = std::numeric_limits<double>::max();
+    for(const auto &config : candidates)
+    {
+        const CandidateRunner runner = factory(config);
+        if(!runner)
+        {
+            continue;
+        }
+
+        const double time = time_candidate(runner);
+        if(time < best_time)
+        {
+            best_time   = time;
+            best_config = config;
+        }
+    }
+
+    return best_config;
+}
+
+void NEGEMMTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    while(!std::getline(fs, line).fail())
+    {
+        std::istringstream ss(line);
+        std::string        gemm_id;
+        std::string        method;
+        std::string        inner;
+        std::string        outer;
+        if(std::getline(ss, gemm_id, ';').fail() || std::getline(ss, method, ';').fail() || std::getline(ss, inner, ';').fail() || std::getline(ss, outer, ';').fail())
+        {
+            ARM_COMPUTE_ERROR("Malformed row '%s' in %s (Should be of the form 'gemm_id;method;inner_block_size;outer_block_size')", ss.str().c_str(), filename.c_str());
+        }
+
+        arm_gemm::GemmConfig config;
+        if(!method_from_string(method, config.method))
+        {
+            ARM_COMPUTE_ERROR("Unknown GEMM method '%s' in %s", method.c_str(), filename.c_str());
+        }
+        config.inner_block_size = support::cpp11::stoi(inner);
+        config.outer_block_size = support::cpp11::stoi(outer);
+        add_config_to_table(gemm_id, config);
+    }
+    fs.close();
+}
+
+void NEGEMMTuner::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for(const auto &gemm_data : _config_table)
+    {
+        fs << gemm_data.first << ";" << method_to_string(gemm_data.second.method) << ";" << gemm_data.second.inner_block_size << ";" << gemm_data.second.outer_block_size << std::endl;
+    }
+    fs.close();
+}
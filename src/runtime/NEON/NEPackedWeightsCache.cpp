@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEPackedWeightsCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* defined(__linux__) */
+
+using namespace arm_compute;
+
+namespace
+{
+/** File signature, followed by the format version */
+constexpr char cache_magic[8] = { 'A', 'C', 'L', 'P', 'W', 'C', '0', '1' };
+/** Alignment of the buffers within the file (required by the 32-bit assembly kernels) */
+constexpr uint64_t cache_alignment = 128;
+
+constexpr uint64_t fnv_offset_basis = 0xcbf29ce484222325ULL;
+constexpr uint64_t fnv_prime        = 0x100000001b3ULL;
+
+uint64_t hash_bytes(uint64_t h, const uint8_t *data, size_t size)
+{
+    // FNV-1a over 64-bit words, then over the remaining bytes
+    size_t i = 0;
+    for(; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, data + i, sizeof(uint64_t));
+        h = (h ^ word) * fnv_prime;
+    }
+    for(; i < size; ++i)
+    {
+        h = (h ^ data[i]) * fnv_prime;
+    }
+    return h;
+}
+
+uint64_t align_offset(uint64_t offset)
+{
+    return ((offset + cache_alignment - 1) / cache_alignment) * cache_alignment;
+}
+
+/** Bounds checked reader of the loaded file */
+class CacheReader
+{
+public:
+    CacheReader(const uint8_t *data, size_t size, const std::string &filename)
+        : _data(data), _size(size), _offset(0), _filename(filename)
+    {
+    }
+    const uint8_t *read(size_t size)
+    {
+        if(size > _size - _offset)
+        {
+            ARM_COMPUTE_ERROR("Truncated packed weights cache %s", _filename.c_str());
+        }
+        const uint8_t *ptr = _data + _offset;
+        _offset += size;
+        return ptr;
+    }
+    uint64_t read_u64()
+    {
+        uint64_t value = 0;
+        std::memcpy(&value, read(sizeof(uint64_t)), sizeof(uint64_t));
+        return value;
+    }
+
+private:
+    const uint8_t     *_data;
+    size_t             _size;
+    size_t             _offset;
+    const std::string &_filename;
+};
+} // namespace
+
+NEPackedWeightsCache::NEPackedWeightsCache()
+    : _entries(), _mapping(nullptr), _has_new_entries(false), _mtx()
+{
+}
+
+void NEPackedWeightsCache::load_from_file(const std::string &filename)
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    // The previous file stays mapped while functions use its buffers
+    _mapping.reset();
+
+    const uint8_t *data = nullptr;
+    size_t         size = 0;
+#if defined(__linux__)
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        ARM_COMPUTE_ERROR("Failed to stat '%s' or empty file", filename.c_str());
+    }
+    // Map the file read-only: the packed weights stay in the page cache and are shared between processes
+    void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(mapping == MAP_FAILED)
+    {
+        ARM_COMPUTE_ERROR("Failed to map '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    size     = st.st_size;
+    _mapping = std::shared_ptr<const void>(mapping, [size](const void *ptr)
+    {
+        munmap(const_cast<void *>(ptr), size);
+    });
+    data = static_cast<const uint8_t *>(mapping);
+#else  /* defined(__linux__) */
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    // Over-allocate so that the buffers can be aligned like in the file
+    fs.seekg(0, std::ios::end);
+    const size_t file_size = fs.tellg();
+    fs.seekg(0, std::ios::beg);
+    auto   file_data   = std::make_shared<std::vector<uint8_t>>(file_size + cache_alignment);
+    void  *aligned_ptr = file_data->data();
+    size_t space       = file_data->size();
+    aligned_ptr        = support::cpp11::align(cache_alignment, file_size, aligned_ptr, space);
+    fs.read(static_cast<char *>(aligned_ptr), file_size);
+    _mapping = std::shared_ptr<const void>(file_data, aligned_ptr);
+    data     = static_cast<const uint8_t *>(aligned_ptr);
+    size     = file_size;
+#endif /* defined(__linux__) */
+
+    CacheReader reader(data, size, filename);
+    if(std::memcmp(reader.read(sizeof(cache_magic)), cache_magic, sizeof(cache_magic)) != 0)
+    {
+        ARM_COMPUTE_ERROR("'%s' is not a packed weights cache", filename.c_str());
+    }
+
+    const uint64_t num_entries = reader.read_u64();
+    for(uint64_t i = 0; i < num_entries; ++i)
+    {
+        const uint64_t    key_size = reader.read_u64();
+        const std::string key(reinterpret_cast<const char *>(reader.read(key_size)), key_size);
+        const uint64_t    offset = reader.read_u64();
+        const uint64_t    length = reader.read_u64();
+        if(offset > size || length > size - offset)
+        {
+            ARM_COMPUTE_ERROR("Buffer out of the bounds of the packed weights cache %s", filename.c_str());
+        }
+        if(offset % cache_alignment != 0)
+        {
+            ARM_COMPUTE_ERROR("Misaligned buffer in the packed weights cache %s", filename.c_str());
+        }
+
+        // The buffers share the ownership of the mapping
+        _entries[key] = Entry{ std::shared_ptr<const void>(_mapping, data + offset), static_cast<size_t>(length) };
+    }
+    _has_new_entries = false;
+}
+
+void NEPackedWeightsCache::save_to_file(const std::string &filename) const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    // Hold the buffers alive while they are written
+    std::vector<std::pair<const std::string *, std::shared_ptr<const void>>> buffers;
+    for(const auto &entry : _entries)
+    {
+        std::shared_ptr<const void> data = entry.second.data.lock();
+        if(data != nullptr)
+        {
+            buffers.emplace_back(&entry.first, std::move(data));
+        }
+    }
+
+    // Work out where the buffers start
+    uint64_t offset = sizeof(cache_magic) + sizeof(uint64_t);
+    for(const auto &buffer : buffers)
+    {
+        offset += 3 * sizeof(uint64_t) + buffer.first->size();
+    }
+
+    const std::string tmp_filename = filename + ".tmp";
+    std::ofstream     fs;
+    fs.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    fs.open(tmp_filename, std::ios::out | std::ios::binary);
+
+    auto write_u64 = [&](uint64_t value)
+    {
+        fs.write(reinterpret_cast<const char *>(&value), sizeof(uint64_t));
+    };
+
+    // Header and index
+    fs.write(cache_magic, sizeof(cache_magic));
+    write_u64(buffers.size());
+    for(const auto &buffer : buffers)
+    {
+        offset = align_offset(offset);
+        write_u64(buffer.first->size());
+        fs.write(buffer.first->data(), buffer.first->size());
+        write_u64(offset);
+        write_u64(_entries.at(*buffer.first).size);
+        offset += _entries.at(*buffer.first).size;
+    }
+
+    // Buffers
+    const char padding[cache_alignment] = {};
+    for(const auto &buffer : buffers)
+    {
+        const uint64_t pos = static_cast<uint64_t>(fs.tellp());
+        fs.write(padding, align_offset(pos) - pos);
+        fs.write(static_cast<const char *>(buffer.second.get()), _entries.at(*buffer.first).size);
+    }
+    fs.close();
+
+    // Replace the file only once it is complete: the loaded file may still be mapped
+    if(std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+    {
+        ARM_COMPUTE_ERROR("Failed to rename '%s' (%s [%d])", tmp_filename.c_str(), strerror(errno), errno);
+    }
+}
+
+std::shared_ptr<const void> NEPackedWeightsCache::find(const std::string &key, size_t size) const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    const auto it = _entries.find(key);
+    return (it != _entries.end() && it->second.size == size) ? it->second.data.lock() : nullptr;
+}
+
+std::shared_ptr<const void> NEPackedWeightsCache::add(const std::string &key, std::shared_ptr<const void> data, size_t size)
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    // Keep the buffer of a function which packed the same weights concurrently, so that only one copy survives
+    Entry &entry = _entries[key];
+    if(entry.size == size)
+    {
+        std::shared_ptr<const void> existing = entry.data.lock();
+        if(existing != nullptr)
+        {
+            return existing;
+        }
+    }
+
+    entry            = Entry{ data, size };
+    _has_new_entries = true;
+    return data;
+}
+
+size_t NEPackedWeightsCache::num_entries() const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return std::count_if(_entries.begin(), _entries.end(), [](const std::pair<const std::string, Entry> &entry)
+    {
+        return !entry.second.data.expired();
+    });
+}
+
+bool NEPackedWeightsCache::has_new_entries() const
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _has_new_entries;
+}
+
+uint64_t NEPackedWeightsCache::hash(const ITensor &tensor)
+{
+    const size_t row_size = tensor.info()->dimension(0) * tensor.info()->element_size();
+
+    Window win;
+    win.use_tensor_dimensions(tensor.info()->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    uint64_t h = fnv_offset_basis;
+    Iterator it(&tensor, win);
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        h = hash_bytes(h, it.ptr(), row_size);
+    },
+    it);
+
+    return h;
+}
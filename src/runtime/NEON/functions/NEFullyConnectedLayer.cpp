@@ -131,12 +131,67 @@ void NEFullyConnectedLayerReshapeWeights::run()
 }
 
 NEFullyConnectedLayer::NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _im2col_kernel(), _reshape_weights_kernel(), _interleave4x4_kernel(), _mm_kernel(), _accumulate_biases_kernel(), _im2col_output(), _interleave4x4_output(),
-      _reshape_weights_output(), _are_weights_reshaped(false), _is_batched_fc_layer(false), _linearize_input(false), _accumulate_biases(false), _original_weights(nullptr)
+    : _asm_glue(), _memory_group(std::move(memory_manager)), _im2col_kernel(), _reshape_weights_kernel(), _interleave4x4_kernel(), _mm_kernel(), _accumulate_biases_kernel(), _activationlayer_function(),
+      _im2col_output(), _interleave4x4_output(), _reshape_weights_output(), _workspace(), _B_pretransposed(), _are_weights_reshaped(false), _is_batched_fc_layer(false), _linearize_input(false),
+      _accumulate_biases(false), _is_activationlayer_enabled(false), _original_weights(nullptr)
 {
 }
 
-void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights, bool are_weights_reshaped)
+void NEFullyConnectedLayer::configure_asm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights, int num_input_dimensions,
+                                          const ActivationLayerInfo &act_info)
+{
+    // The assembly GEMMs take the weights transposed, in their original layout: they get pretransposed on the first run
+    const ITensor *weights_to_use = weights;
+
+    if(transpose_weights)
+    {
+        weights_to_use = &_reshape_weights_output;
+
+        _reshape_weights_output.allocator()->init(weights->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_transposed_shape(*weights->info())));
+
+        // Transpose the weights
+        _reshape_weights_kernel.configure(weights, &_reshape_weights_output, true /* transpose_weights */, false /* is_batched_fc_layer */);
+    }
+    else
+    {
+        _are_weights_reshaped = true;
+    }
+
+    const ITensor *multiply_input = input;
+
+    if(_linearize_input)
+    {
+        _im2col_output.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_im2col_fc_shape(input->info(), num_input_dimensions)));
+
+        // Configure im2col kernel
+        _memory_group.manage(&_im2col_output);
+        _im2col_kernel.configure(input, &_im2col_output, Size2D(1, 1), PadStrideInfo(1, 1, 0, 0), false, true);
+
+        multiply_input = &_im2col_output;
+    }
+
+    // Biases and activation are added by the output stage of the GEMM
+    if(!setup_assembly_kernel(multiply_input, weights_to_use, output, 1.f, 0.f, true, _workspace, _B_pretransposed, _memory_group, _asm_glue, biases, act_info))
+    {
+        ARM_COMPUTE_ERROR("setup_assembly_kernel failed.");
+    }
+
+    _is_batched_fc_layer = false;
+    _accumulate_biases   = false;
+
+    if(transpose_weights)
+    {
+        _reshape_weights_output.allocator()->allocate();
+    }
+
+    if(_linearize_input)
+    {
+        _im2col_output.allocator()->allocate();
+    }
+}
+
+void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights, bool are_weights_reshaped,
+                                      const ActivationLayerInfo &act_info)
 {
     // With the Fully Connected layer we can have 4 different cases:
     //  1) Convolution layer -> Fully Connected layer without batches
@@ -157,7 +212,8 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
                                                                biases != nullptr ? biases->info() : nullptr,
                                                                output->info(),
                                                                transpose_weights,
-                                                               are_weights_reshaped));
+                                                               are_weights_reshaped,
+                                                               act_info));
 
     const int    num_batch_dimensions = std::max(0, static_cast<int>(output->info()->tensor_shape().num_dimensions()) - 1);
     const int    num_input_dimensions = input->info()->tensor_shape().num_dimensions() - num_batch_dimensions;
@@ -169,6 +225,20 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
     _accumulate_biases    = biases != nullptr;
     _is_batched_fc_layer  = num_batch_dimensions > 0;
 
+    if(input->info()->data_type() == DataType::F32 && !are_weights_reshaped)
+    {
+        // Activations which the assembly GEMMs can't apply are run in-place after them
+        _is_activationlayer_enabled = act_info.enabled() && !is_activation_supported_by_assembly(act_info);
+
+        configure_asm(input, weights, biases, output, transpose_weights, num_input_dimensions, _is_activationlayer_enabled ? ActivationLayerInfo() : act_info);
+
+        if(_is_activationlayer_enabled)
+        {
+            _activationlayer_function.configure(output, nullptr, act_info);
+        }
+        return;
+    }
+
     const size_t   interleave_width = 16 / input->info()->element_size();
     const ITensor *weights_to_use   = weights;
 
@@ -220,6 +290,12 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
         _accumulate_biases_kernel.configure(output, biases);
     }
 
+    _is_activationlayer_enabled = act_info.enabled();
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.configure(output, nullptr, act_info);
+    }
+
     // Allocate the transpose tensor if the are_weights_reshaped flag is false and once all the configure methods have been called
     if(!are_weights_reshaped && (transpose_weights || _is_batched_fc_layer))
     {
@@ -238,7 +314,8 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
     }
 }
 
-Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, bool transpose_weights, bool are_weights_reshaped)
+Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, bool transpose_weights, bool are_weights_reshaped,
+                                       const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QS8, DataType::QS16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
@@ -255,6 +332,39 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
     ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape().total_size_upper(num_input_dimensions) != output->tensor_shape().total_size_upper(1));
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
 
+    if(accumulate_biases)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->tensor_shape().x() != output->tensor_shape().x());
+    }
+
+    if(act_info.enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+    }
+
+    if(input->data_type() == DataType::F32 && !are_weights_reshaped)
+    {
+        // Assembly GEMMs: the weights are only transposed and the biases are added by the GEMM
+        std::unique_ptr<ITensorInfo> transposed_weights = weights->clone();
+        if(transpose_weights)
+        {
+            transposed_weights->set_is_resizable(true).reset_padding().set_tensor_shape(compute_transposed_shape(*weights));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayerReshapeWeights::validate(weights, transposed_weights.get(), true /* transpose_weights */, false /* is_batched_fc_layer */));
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON(transposed_weights->tensor_shape().x() != output->tensor_shape().x());
+        ARM_COMPUTE_RETURN_ERROR_ON(transposed_weights->tensor_shape().y() != linear_input_size);
+
+        if(linearize_input)
+        {
+            std::unique_ptr<ITensorInfo> im2col_output = input->clone();
+            im2col_output->set_is_resizable(true).reset_padding().set_tensor_shape(compute_im2col_fc_shape(input, num_input_dimensions));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate(input, im2col_output.get(), Size2D(1, 1), PadStrideInfo(1, 1, 0, 0), false, true));
+        }
+
+        return Status{};
+    }
+
     const size_t                 interleave_width       = 16 / input->element_size();
     const ITensorInfo           *weights_to_use         = weights;
     std::unique_ptr<ITensorInfo> reshape_weights_output = input->clone();
@@ -311,9 +421,6 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
 
     if(accumulate_biases)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
-        ARM_COMPUTE_RETURN_ERROR_ON(biases->tensor_shape().x() != output->tensor_shape().x());
-
         ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMMatrixAccumulateBiasesKernel::validate(output, biases));
     }
 
@@ -328,7 +435,12 @@ void NEFullyConnectedLayer::run()
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
         _are_weights_reshaped = true;
-        _reshape_weights_kernel.run();
+
+        // Weights already pretransposed in the weights cache don't need reshaping
+        if(_asm_glue._optimised_kernel == nullptr || !_asm_glue.import_pretransposed_B(_original_weights))
+        {
+            _reshape_weights_kernel.run();
+        }
 
         // Mark original weights tensor as unused
         _original_weights->mark_as_unused();
@@ -342,6 +454,25 @@ void NEFullyConnectedLayer::run()
         NEScheduler::get().schedule(&_im2col_kernel, Window::DimY);
     }
 
+    if(_asm_glue._optimised_kernel != nullptr)
+    {
+        _asm_glue.run();
+
+        // Release the transposed weights once they are pretransposed
+        if(!_reshape_weights_output.is_used())
+        {
+            _reshape_weights_output.allocator()->free();
+        }
+
+        if(_is_activationlayer_enabled)
+        {
+            _activationlayer_function.run();
+        }
+
+        _memory_group.release();
+        return;
+    }
+
     // Interleave input
     if(_is_batched_fc_layer)
     {
@@ -357,5 +488,10 @@ void NEFullyConnectedLayer::run()
         NEScheduler::get().schedule(&_accumulate_biases_kernel, Window::DimY);
     }
 
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.run();
+    }
+
     _memory_group.release();
 }
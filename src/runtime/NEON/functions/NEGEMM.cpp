@@ -153,21 +153,36 @@ void NEGEMM::run()
     {
         if(!_run_vector_matrix_multiplication)
         {
-            // Run interleave kernel
-            NEScheduler::get().schedule(&_interleave_kernel, Window::DimY);
+            // Interleave and transpose are independent: submit both before waiting for them
+            const IScheduler::Token interleave_token = NEScheduler::get().submit(&_interleave_kernel, Window::DimY);
+            IScheduler::Token       transpose_token{};
 
-            if(_is_first_run)
+            if(_is_first_run || !_reshape_b_only_on_first_run)
             {
                 // Run transpose kernel
-                NEScheduler::get().schedule(&_transpose_kernel, Window::DimY);
+                transpose_token = NEScheduler::get().submit(&_transpose_kernel, Window::DimY);
 
                 _is_first_run = false;
             }
-            else if(!_reshape_b_only_on_first_run)
+
+            // Both kernels must be complete before reporting an error: the transpose keeps writing to its output otherwise
+            try
             {
-                // Run transpose kernel
-                NEScheduler::get().schedule(&_transpose_kernel, Window::DimY);
+                NEScheduler::get().wait(interleave_token);
+            }
+            catch(...)
+            {
+                try
+                {
+                    NEScheduler::get().wait(transpose_token);
+                }
+                catch(...)
+                {
+                    // Only the first error is reported
+                }
+                throw;
             }
+            NEScheduler::get().wait(transpose_token);
         }
 
         NEScheduler::get().schedule(&_mm_kernel, _run_vector_matrix_multiplication ? Window::DimX : Window::DimY);
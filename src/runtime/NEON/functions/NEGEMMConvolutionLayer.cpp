@@ -206,8 +206,9 @@ Status validate_and_initialize_values(const ITensorInfo *input, const ITensorInf
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
     }
 
+    // The assembly GEMMs used for F32 add the biases in their output stage, other data types append them to the weights
     // If we have 1x1 convolution and data layout is NHWC we can disable im2col
-    append_bias          = (biases != nullptr) && (!is_quantized);
+    append_bias          = (biases != nullptr) && (!is_quantized) && (dt != DataType::F32);
     are_weights_reshaped = weights_info.are_reshaped();
     kernel_width         = (are_weights_reshaped) ? weights_info.kernel_size().first : weights->dimension(idx_width);
     kernel_height        = (are_weights_reshaped) ? weights_info.kernel_size().second : weights->dimension(idx_height);
@@ -221,21 +222,21 @@ Status validate_and_initialize_values(const ITensorInfo *input, const ITensorInf
     // Check if its a "fully connected" convolution
     is_fully_connected_convolution = ((conv_w == 1) && (conv_h == 1));
     is_interleaved                 = (!is_fully_connected_convolution && !is_quantized);
-    is_activationlayer_enabled     = act_info.enabled();
+    is_activationlayer_enabled     = act_info.enabled() && !(dt == DataType::F32 && is_activation_supported_by_assembly(act_info));
 
     return Status{};
 }
 } // namespace
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _asm_glue(), _memory_group(memory_manager), _input_im2col_kernel(), _input_interleave_kernel(), _reshape_weights(), _mm_kernel(), _mm_gemmlowp(memory_manager), _gemmlowp_output_stage(),
-      _output_col2im_kernel(), _activationlayer_function(), _add_bias_kernel(), _original_weights(nullptr), _input_im2col_reshaped(), _input_interleaved_reshaped(), _weights_reshaped(), _gemm_output(),
-      _tmp_output(), _workspace(), _B_pretransposed(), _data_layout(DataLayout::NCHW), _append_bias(false), _is_fully_connected_convolution(false), _are_weights_reshaped(false), _is_quantized(false),
+    : _asm_glue(), _memory_group(memory_manager), _input_im2col_kernel(), _input_interleave_kernel(), _reshape_weights(), _mm_kernel(), _mm_gemmlowp(memory_manager),
+      _output_col2im_kernel(), _activationlayer_function(), _add_bias_kernel(), _original_weights(nullptr), _original_biases(nullptr), _input_im2col_reshaped(), _input_interleaved_reshaped(), _weights_reshaped(), _gemm_output(),
+      _workspace(), _B_pretransposed(), _data_layout(DataLayout::NCHW), _append_bias(false), _is_fully_connected_convolution(false), _are_weights_reshaped(false), _is_quantized(false),
       _is_interleaved(false), _is_activationlayer_enabled(false), _skip_im2col(false)
 {
 }
 
-void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *weights, ITensor *output, bool is_interleaved, const GEMMReshapeInfo &reshape_info)
+void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool is_interleaved, const GEMMReshapeInfo &reshape_info)
 {
     if(_is_quantized)
     {
@@ -243,11 +244,18 @@ void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *w
         // Extract and negate input and weights offset
         const QuantizationInfo input_quantization_info   = input->info()->quantization_info();
         const QuantizationInfo weights_quantization_info = weights->info()->quantization_info();
+        const QuantizationInfo output_quantization_info  = output->info()->quantization_info();
+
+        // The results are requantized to the output's quantization by the GEMM
+        GEMMLowpOutputStageInfo output_stage;
+        float                   multiplier = input_quantization_info.scale * weights_quantization_info.scale / output_quantization_info.scale;
+        quantization::calculate_quantized_multiplier_less_than_one(multiplier, &output_stage.result_fixedpoint_multiplier, &output_stage.result_shift);
+        output_stage.result_offset_after_shift = output_quantization_info.offset;
 
         input->info()->set_quantization_info(QuantizationInfo(input_quantization_info.scale, -input_quantization_info.offset));
         weights->info()->set_quantization_info(QuantizationInfo(weights_quantization_info.scale, -weights_quantization_info.offset));
 
-        _mm_gemmlowp.configure(input, weights, output, GEMMInfo(false, false, true /* Reshape weights only for the first run*/));
+        _mm_gemmlowp.configure(input, weights, biases, output, output_stage, GEMMInfo(false, false, true /* Reshape weights only for the first run*/));
 
         // Revert back QuantizatioInfo as input and weights could be used in other convolution layers
         input->info()->set_quantization_info(input_quantization_info);
@@ -288,6 +296,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     ARM_COMPUTE_ERROR_THROW_ON(status);
 
     _original_weights                       = weights;
+    _original_biases                        = biases;
     const unsigned int fixed_point_position = input->info()->fixed_point_position();
     const ITensor     *biases_to_use        = (_append_bias) ? biases : nullptr;
 
@@ -300,7 +309,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
 
         // Create tensor to store the reshaped weights
         _weights_reshaped.allocator()->init(TensorInfo(reshaped_weights_shape, 1, dt, fixed_point_position));
-        _reshape_weights.configure(weights, biases, &_weights_reshaped, false /* 1xW transpose */);
+        _reshape_weights.configure(weights, biases_to_use, &_weights_reshaped, false /* 1xW transpose */);
         weights = &_weights_reshaped;
     }
     else
@@ -369,10 +378,10 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         TensorShape shape_gemm(_input_im2col_reshaped.info()->tensor_shape());
         shape_gemm.set(0, mat_weights_cols);
         shape_gemm.set(1, mat_input_rows);
-        const DataType gemm_data_type = _is_quantized ? DataType::S32 : dt;
-        // GEMM output should be S32 for acquiring raw integer accumulator without quantized postprocessing for quantized asymmetric input.
-        TensorInfo info_gemm(shape_gemm, 1, gemm_data_type, input->info()->fixed_point_position());
-        info_gemm.set_quantization_info(output->info()->quantization_info());
+        // For quantized asymmetric input the GEMM requantizes its results to the output's quantization
+        const QuantizationInfo output_quant_info = (output->info()->total_size() == 0) ? input->info()->quantization_info() : output->info()->quantization_info();
+        TensorInfo             info_gemm(shape_gemm, 1, dt, input->info()->fixed_point_position());
+        info_gemm.set_quantization_info(output_quant_info);
         _gemm_output.allocator()->init(info_gemm);
 
         // Configure im2col
@@ -387,7 +396,9 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     // Configure matrix multiply
     if(run_optimised)
     {
-        if(!setup_assembly_kernel(_skip_im2col ? input : &_input_im2col_reshaped, weights, is_nhwc ? output : &_gemm_output, 1.f, 0.f, true, _workspace, _B_pretransposed, _memory_group, _asm_glue))
+        // Biases and activation are applied by the output stage of the GEMM
+        if(!setup_assembly_kernel(_skip_im2col ? input : &_input_im2col_reshaped, weights, is_nhwc ? output : &_gemm_output, 1.f, 0.f, true, _workspace, _B_pretransposed, _memory_group, _asm_glue,
+                                  biases, _is_activationlayer_enabled ? ActivationLayerInfo() : act_info))
         {
             ARM_COMPUTE_ERROR("setup_assembly_kernel failed.");
         }
@@ -400,13 +411,13 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
             _input_interleave_kernel.configure(&_input_im2col_reshaped, &_input_interleaved_reshaped);
 
             // Configure GEMM
-            configure_mm(&_input_interleaved_reshaped, weights, &_gemm_output, _is_interleaved, GEMMReshapeInfo(_input_im2col_reshaped.info()->dimension(idx_height), 0 /* no transpose */,
+            configure_mm(&_input_interleaved_reshaped, weights, biases, &_gemm_output, _is_interleaved, GEMMReshapeInfo(_input_im2col_reshaped.info()->dimension(idx_height), 0 /* no transpose */,
                                                                                                                 _input_im2col_reshaped.info()->dimension(idx_width)));
             _input_interleaved_reshaped.allocator()->allocate();
         }
         else
         {
-            configure_mm(&_input_im2col_reshaped, weights, &_gemm_output, _is_interleaved);
+            configure_mm(&_input_im2col_reshaped, weights, biases, &_gemm_output, _is_interleaved);
         }
     }
 
@@ -414,28 +425,12 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     {
         _input_im2col_reshaped.allocator()->allocate();
 
-        // Configure output stage for quantized case
-        if(_is_quantized)
-        {
-            const QuantizationInfo output_quant_info = (output->info()->total_size() == 0) ? input->info()->quantization_info() : output->info()->quantization_info();
-
-            float multiplier = input->info()->quantization_info().scale * weights->info()->quantization_info().scale / output_quant_info.scale;
-            int   output_multiplier, output_shift;
-            quantization::calculate_quantized_multiplier_less_than_one(multiplier, &output_multiplier, &output_shift);
-            _memory_group.manage(&_tmp_output);
-            _gemmlowp_output_stage.configure(&_gemm_output, biases, &_tmp_output, output_multiplier, output_shift, output_quant_info.offset);
-        }
-
         // Configure Col2Im
         if(!is_nhwc)
         {
-            _output_col2im_kernel.configure(_is_quantized ? &_tmp_output : &_gemm_output, output, Size2D(conv_w, conv_h));
+            _output_col2im_kernel.configure(&_gemm_output, output, Size2D(conv_w, conv_h));
         }
 
-        if(_is_quantized)
-        {
-            _tmp_output.allocator()->allocate();
-        }
         _gemm_output.allocator()->allocate();
     }
 
@@ -527,7 +522,7 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
 
         // Create tensor to store the reshaped weights
         reshaped_weights->set_tensor_shape(get_reshaped_weights_shape_conv(weights, append_bias, is_fully_connected_convolution));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, biases, reshaped_weights.get(), !is_fully_connected_convolution /* 1xW transpose */));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, append_bias ? biases : nullptr, reshaped_weights.get(), !is_fully_connected_convolution /* 1xW transpose */));
     }
     else if(!is_quantized)
     {
@@ -574,7 +569,7 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG((output->dimension(idx_width) != conv_w) || (output->dimension(idx_height) != conv_h), "Output shape does not match the expected one");
 
-    if(act_info.enabled())
+    if(is_activationlayer_enabled)
     {
         ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
     }
@@ -590,7 +585,12 @@ void NEGEMMConvolutionLayer::run()
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
         _are_weights_reshaped = true;
-        _reshape_weights.run();
+
+        // Weights already pretransposed in the weights cache don't need reshaping
+        if(_asm_glue._optimised_kernel == nullptr || !_asm_glue.import_pretransposed_B(_original_weights, _append_bias ? _original_biases : nullptr))
+        {
+            _reshape_weights.run();
+        }
 
         // Mark original weights tensor as unused
         _original_weights->mark_as_unused();
@@ -602,7 +602,7 @@ void NEGEMMConvolutionLayer::run()
     {
         // Run input reshaping
         unsigned int _y_dim = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
-        NEScheduler::get().schedule(&_input_im2col_kernel, _y_dim);
+        NEScheduler::get().schedule(&_input_im2col_kernel, IScheduler::Hints(_y_dim, IScheduler::StrategyHint::DYNAMIC));
     }
 
     // Runs matrix multiply on reshaped matrices
@@ -639,12 +639,6 @@ void NEGEMMConvolutionLayer::run()
         NEScheduler::get().schedule(&_add_bias_kernel, Window::DimY);
     }
 
-    // Run output stage for quantized case
-    if(_is_quantized)
-    {
-        _gemmlowp_output_stage.run();
-    }
-
     // Reshape output matrix
     if(_data_layout == DataLayout::NCHW)
     {
@@ -42,11 +42,54 @@ using namespace arm_compute::misc::shape_calculator;
 
 NEGEMMLowpMatrixMultiplyCore::NEGEMMLowpMatrixMultiplyCore(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)), _asm_glue_unsigned(), _asm_glue_signed(), _mm_kernel(nullptr), _mtx_a_reshape_kernel(nullptr), _mtx_b_reshape_kernel(nullptr), _mtx_a_reduction_kernel(),
-      _mtx_b_reduction_kernel(), _offset_contribution_kernel(), _vector_sum_col(), _vector_sum_row(), _tmp_a(), _tmp_b(), _workspace(), _B_pretranspose(), _a_offset(0), _b_offset(0),
-      _run_vector_matrix_multiplication(false), _dot_product_path(false), _is_first_run(true), _reshape_b_only_on_first_run(false)
+      _mtx_b_reduction_kernel(), _offset_contribution_kernel(), _output_stage(), _vector_sum_col(), _vector_sum_row(), _tmp_a(), _tmp_b(), _mm_result_s32(), _workspace(), _B_pretranspose(), _a_offset(0),
+      _b_offset(0), _run_vector_matrix_multiplication(false), _dot_product_path(false), _is_first_run(true), _reshape_b_only_on_first_run(false), _fused_output_stage(false), _run_output_stage(false)
 {
 }
 
+void NEGEMMLowpMatrixMultiplyCore::configure_reductions(const ITensor *a, const ITensor *b)
+{
+    // Initialize matrix B reduction kernel only if _a_offset is not equal to 0
+    if(_a_offset != 0)
+    {
+        TensorInfo info_vector_sum_col(compute_reductionA_shape(*b->info()), 1, DataType::S32);
+
+        _vector_sum_col.allocator()->init(info_vector_sum_col);
+        if(!_reshape_b_only_on_first_run)
+        {
+            _memory_group.manage(&_vector_sum_col);
+        }
+
+        // Configure Matrix B reduction kernel
+        _mtx_b_reduction_kernel.configure(b, &_vector_sum_col, a->info()->dimension(0), false);
+    }
+
+    // Initialize Matrix A reduction kernel only if _b_offset is not equal to 0
+    if(_b_offset != 0)
+    {
+        TensorInfo info_vector_sum_row(compute_reductionB_shape(*a->info()), 1, DataType::S32);
+
+        _vector_sum_row.allocator()->init(info_vector_sum_row);
+        _memory_group.manage(&_vector_sum_row);
+
+        // Configure matrix A reduction kernel
+        _mtx_a_reduction_kernel.configure(a, &_vector_sum_row, a->info()->dimension(0), false);
+    }
+}
+
+void NEGEMMLowpMatrixMultiplyCore::allocate_reductions()
+{
+    if(_a_offset != 0)
+    {
+        _vector_sum_col.allocator()->allocate();
+    }
+
+    if(_b_offset != 0)
+    {
+        _vector_sum_row.allocator()->allocate();
+    }
+}
+
 void NEGEMMLowpMatrixMultiplyCore::configure(const ITensor *a, const ITensor *b, ITensor *output, const GEMMInfo &gemm_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, output);
@@ -126,32 +169,7 @@ void NEGEMMLowpMatrixMultiplyCore::configure(const ITensor *a, const ITensor *b,
         }
     }
 
-    // Initialize matrix B reduction kernel only if _a_offset is not equal to 0
-    if(_a_offset != 0)
-    {
-        TensorInfo info_vector_sum_col(compute_reductionA_shape(*b->info()), 1, DataType::S32);
-
-        _vector_sum_col.allocator()->init(info_vector_sum_col);
-        if(!_reshape_b_only_on_first_run)
-        {
-            _memory_group.manage(&_vector_sum_col);
-        }
-
-        // Configure Matrix B reduction kernel
-        _mtx_b_reduction_kernel.configure(b, &_vector_sum_col, a->info()->dimension(0), false);
-    }
-
-    // Initialize Matrix A reduction kernel only if _b_offset is not equal to 0
-    if(_b_offset != 0)
-    {
-        TensorInfo info_vector_sum_row(compute_reductionB_shape(*a->info()), 1, DataType::S32);
-
-        _vector_sum_row.allocator()->init(info_vector_sum_row);
-        _memory_group.manage(&_vector_sum_row);
-
-        // Configure matrix A reduction kernel
-        _mtx_a_reduction_kernel.configure(a, &_vector_sum_row, a->info()->dimension(0), false);
-    }
+    configure_reductions(a, b);
 
     // Configure offset contribution kernel
     _offset_contribution_kernel.configure(output, _a_offset == 0 ? nullptr : &_vector_sum_col, _b_offset == 0 ? nullptr : &_vector_sum_row, a->info()->dimension(0), _a_offset, _b_offset);
@@ -163,15 +181,53 @@ void NEGEMMLowpMatrixMultiplyCore::configure(const ITensor *a, const ITensor *b,
         _tmp_b.allocator()->allocate();
     }
 
-    if(_a_offset != 0)
-    {
-        _vector_sum_col.allocator()->allocate();
-    }
+    allocate_reductions();
+}
 
-    if(_b_offset != 0)
+void NEGEMMLowpMatrixMultiplyCore::configure(const ITensor *a, const ITensor *b, const ITensor *bias, ITensor *output, const GEMMLowpOutputStageInfo &output_stage, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMLowpMatrixMultiplyCore::validate(a->info(), b->info(), (bias != nullptr) ? bias->info() : nullptr, output->info(), output_stage, gemm_info));
+
+#ifdef __aarch64__
+    // Requantize in the merge stage of the assembly GEMM, so the S32 results are never written
+    _a_offset                    = a->info()->quantization_info().offset;
+    _b_offset                    = b->info()->quantization_info().offset;
+    _reshape_b_only_on_first_run = gemm_info.reshape_b_only_on_first_run();
+
+    arm_gemm::Requantize32 requantize;
+    requantize.a_offset          = _a_offset;
+    requantize.b_offset          = _b_offset;
+    requantize.result_offset     = output_stage.result_offset_after_shift;
+    requantize.result_multiplier = output_stage.result_fixedpoint_multiplier;
+    requantize.result_shift      = output_stage.result_shift;
+    requantize.minval            = (output_stage.min != output_stage.max) ? output_stage.min : 0;
+    requantize.maxval            = (output_stage.min != output_stage.max) ? output_stage.max : 255;
+
+    _fused_output_stage = setup_assembly_kernel(a, b, output, 1.f, 0.f, true, _workspace, _B_pretranspose, _memory_group, _asm_glue_unsigned, bias, ActivationLayerInfo(), &requantize);
+    if(_fused_output_stage)
     {
-        _vector_sum_row.allocator()->allocate();
+        _dot_product_path = true;
+
+        configure_reductions(a, b);
+        _asm_glue_unsigned._col_sums = (_a_offset != 0) ? &_vector_sum_col : nullptr;
+        _asm_glue_unsigned._row_sums = (_b_offset != 0) ? &_vector_sum_row : nullptr;
+        allocate_reductions();
+        return;
     }
+#endif /* __aarch64__ */
+
+    // Requantize the S32 results in a separate pass
+    _run_output_stage = true;
+
+    _mm_result_s32.allocator()->init(TensorInfo(output->info()->tensor_shape(), 1, DataType::S32));
+    _memory_group.manage(&_mm_result_s32);
+
+    configure(a, b, &_mm_result_s32, gemm_info);
+    _output_stage.configure(&_mm_result_s32, bias, output, output_stage.result_fixedpoint_multiplier, output_stage.result_shift, output_stage.result_offset_after_shift, output_stage.min,
+                            output_stage.max);
+
+    _mm_result_s32.allocator()->allocate();
 }
 
 Status NEGEMMLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *output, const GEMMInfo &gemm_info)
@@ -246,6 +302,19 @@ Status NEGEMMLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITenso
     return Status{};
 }
 
+Status NEGEMMLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *bias, const ITensorInfo *output, const GEMMLowpOutputStageInfo &output_stage,
+                                              const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::QASYMM8);
+
+    // The constraints are those of the separate passes the fused ones replace
+    const TensorInfo mm_result_s32_info(output->tensor_shape(), 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpMatrixMultiplyCore::validate(a, b, &mm_result_s32_info, gemm_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint::validate(&mm_result_s32_info, bias, output, output_stage.min, output_stage.max));
+
+    return Status{};
+}
+
 void NEGEMMLowpMatrixMultiplyCore::run()
 {
     _memory_group.acquire();
@@ -264,6 +333,19 @@ void NEGEMMLowpMatrixMultiplyCore::run()
         }
     }
 
+    // Run matrix A reduction kernel only if _b_offset is not equal to 0
+    if(_b_offset != 0)
+    {
+        NEScheduler::get().schedule(&_mtx_a_reduction_kernel, Window::DimX);
+    }
+
+    // Run matrix B reduction kernel only if _a_offset is not equal to 0
+    // The sums are computed before the GEMM as the fused output stage reads them
+    if(_a_offset != 0 && (_is_first_run || !_reshape_b_only_on_first_run))
+    {
+        NEScheduler::get().schedule(&_mtx_b_reduction_kernel, Window::DimX);
+    }
+
     if(_asm_glue_unsigned._optimised_kernel != nullptr)
     {
         _asm_glue_unsigned.run();
@@ -277,21 +359,17 @@ void NEGEMMLowpMatrixMultiplyCore::run()
         NEScheduler::get().schedule(_mm_kernel.get(), Window::DimY);
     }
 
-    // Run matrix A reduction kernel only if _b_offset is not equal to 0
-    if(_b_offset != 0)
+    if(!_fused_output_stage)
     {
-        NEScheduler::get().schedule(&_mtx_a_reduction_kernel, Window::DimX);
+        // Run offset contribution kernel
+        NEScheduler::get().schedule(&_offset_contribution_kernel, Window::DimY);
     }
 
-    // Run matrix B reduction kernel only if _a_offset is not equal to 0
-    if(_a_offset != 0 && (_is_first_run || !_reshape_b_only_on_first_run))
+    if(_run_output_stage)
     {
-        NEScheduler::get().schedule(&_mtx_b_reduction_kernel, Window::DimX);
+        _output_stage.run();
     }
 
-    // Run offset contribution kernel
-    NEScheduler::get().schedule(&_offset_contribution_kernel, Window::DimY);
-
     _memory_group.release();
 
     _is_first_run = false;
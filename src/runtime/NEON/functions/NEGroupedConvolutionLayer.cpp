@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGroupedConvolutionLayer.h"
+
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include <tuple>
+
+namespace arm_compute
+{
+namespace
+{
+TensorShape get_im2col_shape(const ITensorInfo *input, const ITensorInfo *weights, unsigned int conv_w, unsigned int conv_h)
+{
+    // The im2col matrix of the whole input: [kernel_x * kernel_y * IFM, conv_w * conv_h, 1, batches]
+    TensorShape shape_im2col(input->tensor_shape());
+    shape_im2col.set(0, weights->dimension(0) * weights->dimension(1) * input->dimension(2));
+    shape_im2col.set(1, conv_w * conv_h);
+    shape_im2col.set(2, 1);
+    return shape_im2col;
+}
+
+TensorShape get_gemm_output_shape(const ITensorInfo *input, const ITensorInfo *weights, unsigned int conv_w, unsigned int conv_h)
+{
+    // Same shape as the GEMM output of NEGEMMConvolutionLayer: [OFM, conv_w * conv_h, 1, batches]
+    TensorShape shape_gemm(input->tensor_shape());
+    shape_gemm.set(0, weights->dimension(3));
+    shape_gemm.set(1, conv_w * conv_h);
+    shape_gemm.set(2, 1);
+    return shape_gemm;
+}
+} // namespace
+
+void NEGroupedConvolutionLayer::GroupView::init(const ITensor *matrix, unsigned int num_groups, bool is_batched)
+{
+    ARM_COMPUTE_ERROR_ON(matrix->info()->dimension(0) % num_groups != 0);
+
+    const Strides     &strides     = matrix->info()->strides_in_bytes();
+    const unsigned int group_width = matrix->info()->dimension(0) / num_groups;
+
+    // Each group is a [group_width, rows(, batches)] matrix, the groups follow each other along the rows of the viewed matrix
+    TensorShape  shape(group_width, matrix->info()->dimension(1));
+    Strides      view_strides(strides[0], strides[1]);
+    const size_t group_dim = is_batched ? 3 : 2;
+    if(is_batched)
+    {
+        shape.set(2, matrix->info()->dimension(3));
+        view_strides.set(2, strides[3]);
+    }
+    shape.set(group_dim, num_groups);
+    view_strides.set(group_dim, group_width * strides[0]);
+
+    _matrix = matrix;
+    _info.init(shape, 1, matrix->info()->data_type(), view_strides, 0, matrix->info()->total_size());
+    _info.set_is_resizable(false);
+}
+
+ITensorInfo *NEGroupedConvolutionLayer::GroupView::info() const
+{
+    return &_info;
+}
+
+ITensorInfo *NEGroupedConvolutionLayer::GroupView::info()
+{
+    return &_info;
+}
+
+uint8_t *NEGroupedConvolutionLayer::GroupView::buffer() const
+{
+    // The first element of the view is the first element of the matrix
+    uint8_t *matrix_buffer = _matrix->buffer();
+    return (matrix_buffer != nullptr) ? matrix_buffer + _matrix->info()->offset_first_element_in_bytes() : nullptr;
+}
+
+NEGroupedConvolutionLayer::NEGroupedConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
+    : _asm_glue(), _memory_group(memory_manager), _input_im2col_kernel(), _reshape_weights(), _output_col2im_kernel(), _activationlayer_function(), _original_weights(nullptr),
+      _input_im2col_reshaped(), _weights_reshaped(), _gemm_output(), _workspace(), _B_pretransposed(), _input_im2col_view(), _weights_view(), _gemm_output_view(), _are_weights_reshaped(false),
+      _is_activationlayer_enabled(false)
+{
+}
+
+void NEGroupedConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int num_groups,
+                                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGroupedConvolutionLayer::validate(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info, num_groups, act_info));
+
+    const unsigned int kernel_width  = weights->info()->dimension(0);
+    const unsigned int kernel_height = weights->info()->dimension(1);
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), kernel_width, kernel_height, conv_info);
+
+    _original_weights           = weights;
+    _are_weights_reshaped       = false;
+    _is_activationlayer_enabled = !is_activation_supported_by_assembly(act_info);
+
+    // Reshape the weights into a [OFM, kernel_x * kernel_y * IFM / num_groups] matrix, the biases are added by the output stage of the GEMM
+    _weights_reshaped.allocator()->init(TensorInfo(TensorShape(weights->info()->dimension(3), kernel_width * kernel_height * weights->info()->dimension(2)), 1, input->info()->data_type()));
+    _reshape_weights.configure(weights, nullptr, &_weights_reshaped, false /* 1xW transpose */);
+
+    // The columns of group g of the im2col matrix are the ones of its IFM slice, in the same order as the rows of its reshaped weights
+    _input_im2col_reshaped.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(get_im2col_shape(input->info(), weights->info(), conv_w, conv_h)));
+    _memory_group.manage(&_input_im2col_reshaped);
+    _input_im2col_kernel.configure(input, &_input_im2col_reshaped, Size2D(kernel_width, kernel_height), conv_info, false);
+
+    // Every group writes its OFM slice of the GEMM output, which is reshaped at once
+    _gemm_output.allocator()->init(TensorInfo(get_gemm_output_shape(input->info(), weights->info(), conv_w, conv_h), 1, input->info()->data_type()));
+    _memory_group.manage(&_gemm_output);
+    _output_col2im_kernel.configure(&_gemm_output, output, Size2D(conv_w, conv_h));
+
+    // The strides of the matrices are final, run the groups as the multis of a single GEMM
+    _input_im2col_view.init(&_input_im2col_reshaped, num_groups, true);
+    _weights_view.init(&_weights_reshaped, num_groups, false);
+    _gemm_output_view.init(&_gemm_output, num_groups, true);
+
+    if(!setup_assembly_kernel(&_input_im2col_view, &_weights_view, &_gemm_output_view, 1.f, 0.f, true, _workspace, _B_pretransposed, _memory_group, _asm_glue,
+                              biases, _is_activationlayer_enabled ? ActivationLayerInfo() : act_info))
+    {
+        ARM_COMPUTE_ERROR("setup_assembly_kernel failed.");
+    }
+
+    _input_im2col_reshaped.allocator()->allocate();
+    _gemm_output.allocator()->allocate();
+    _weights_reshaped.allocator()->allocate();
+
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.configure(output, nullptr, act_info);
+    }
+}
+
+Status NEGroupedConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                           unsigned int num_groups, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_layout() != DataLayout::NCHW, "Only NCHW is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(2) * num_groups != input->dimension(2), "The IFM must be split evenly in the groups");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(3) % num_groups != 0, "The OFM must be split evenly in the groups");
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(3));
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+    }
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->dimension(0), input->dimension(1), weights->dimension(0), weights->dimension(1), conv_info);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((output->dimension(0) != conv_w) || (output->dimension(1) != conv_h), "Output shape does not match the expected one");
+
+    const TensorInfo im2col = input->clone()->set_tensor_shape(get_im2col_shape(input, weights, conv_w, conv_h));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate(input, &im2col, Size2D(weights->dimension(0), weights->dimension(1)), conv_info, false, false));
+
+    TensorInfo weights_reshaped = weights->clone()->set_tensor_shape(TensorShape(weights->dimension(3), weights->dimension(0) * weights->dimension(1) * weights->dimension(2)));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, nullptr, &weights_reshaped, false /* 1xW transpose */));
+
+    const TensorInfo gemm_output = input->clone()->set_tensor_shape(get_gemm_output_shape(input, weights, conv_w, conv_h));
+    ARM_COMPUTE_RETURN_ON_ERROR(NECol2ImKernel::validate(&gemm_output, output, Size2D(conv_w, conv_h)));
+
+    if(!is_activation_supported_by_assembly(act_info))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+    }
+
+    return Status{};
+}
+
+void NEGroupedConvolutionLayer::run()
+{
+    // Run weights reshaping (Runs once for every configure)
+    if(!_are_weights_reshaped)
+    {
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+        _are_weights_reshaped = true;
+
+        // Weights already pretransposed in the weights cache don't need reshaping
+        if(!_asm_glue.import_pretransposed_B(_original_weights))
+        {
+            _reshape_weights.run();
+        }
+
+        // Mark original weights tensor as unused
+        _original_weights->mark_as_unused();
+    }
+
+    _memory_group.acquire();
+
+    // Run input reshaping
+    NEScheduler::get().schedule(&_input_im2col_kernel, IScheduler::Hints(Window::DimY, IScheduler::StrategyHint::DYNAMIC));
+
+    _asm_glue.run();
+
+    // Release weights in case buffer is pretransposed
+    if(!_weights_view.is_used())
+    {
+        _weights_reshaped.allocator()->free();
+    }
+
+    // Reshape output matrix
+    NEScheduler::get().schedule(&_output_col2im_kernel, Window::DimY);
+
+    _memory_group.release();
+
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.run();
+    }
+}
+} // namespace arm_compute
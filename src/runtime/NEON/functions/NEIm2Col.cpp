@@ -48,5 +48,5 @@ Status NEIm2Col::validate(const ITensorInfo *input, const ITensorInfo *output, c
 
 void NEIm2Col::run()
 {
-    NEScheduler::get().schedule(&_kernel, _y_dim);
+    NEScheduler::get().schedule(&_kernel, IScheduler::Hints(_y_dim, IScheduler::StrategyHint::DYNAMIC));
 }
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEImplicitGEMMConvolutionLayer.h"
+
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include <tuple>
+
+namespace arm_compute
+{
+namespace
+{
+TensorShape get_gemm_output_shape(const ITensorInfo *input, const ITensorInfo *weights, unsigned int conv_w, unsigned int conv_h)
+{
+    // Same shape as the GEMM output of NEGEMMConvolutionLayer: [OFM, conv_w * conv_h, 1, batches]
+    TensorShape shape_gemm(input->tensor_shape());
+    shape_gemm.set(0, weights->dimension(3));
+    shape_gemm.set(1, conv_w * conv_h);
+    shape_gemm.set(2, 1);
+    return shape_gemm;
+}
+} // namespace
+
+NEImplicitGEMMConvolutionLayer::NEImplicitGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
+    : _asm_glue(), _memory_group(memory_manager), _reshape_weights(), _output_col2im_kernel(), _activationlayer_function(), _original_weights(nullptr), _weights_reshaped(), _gemm_output(),
+      _workspace(), _B_pretransposed(), _is_nchw(true), _are_weights_reshaped(false), _is_activationlayer_enabled(false)
+{
+}
+
+void NEImplicitGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                               const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEImplicitGEMMConvolutionLayer::validate(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info, weights_info,
+                                                                        dilation, act_info));
+
+    const DataLayout data_layout = input->info()->data_layout();
+    const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const int        idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+    const unsigned int kernel_width   = weights->info()->dimension(idx_width);
+    const unsigned int kernel_height  = weights->info()->dimension(idx_height);
+    const unsigned int input_channels = input->info()->dimension(idx_channel);
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(idx_width), input->info()->dimension(idx_height), kernel_width, kernel_height, conv_info);
+
+    _original_weights           = weights;
+    _is_nchw                    = data_layout == DataLayout::NCHW;
+    _are_weights_reshaped       = false;
+    _is_activationlayer_enabled = !is_activation_supported_by_assembly(act_info);
+
+    // Reshape the weights into a [OFM, kernel_x * kernel_y * IFM] matrix, the biases are added by the output stage of the GEMM
+    _weights_reshaped.allocator()->init(TensorInfo(TensorShape(weights->info()->dimension(3), kernel_width * kernel_height * input_channels), 1, input->info()->data_type()));
+    _reshape_weights.configure(weights, nullptr, &_weights_reshaped, false /* 1xW transpose */);
+
+    // The GEMM gathers the rows of the im2col matrix from the input, its strides are set on each run
+    arm_gemm::ConvolutionParameters convolution;
+    convolution.input_width    = input->info()->dimension(idx_width);
+    convolution.input_height   = input->info()->dimension(idx_height);
+    convolution.input_channels = input_channels;
+    convolution.kernel_width   = kernel_width;
+    convolution.kernel_height  = kernel_height;
+    convolution.output_width   = conv_w;
+    convolution.stride_x       = conv_info.stride().first;
+    convolution.stride_y       = conv_info.stride().second;
+    convolution.padding_left   = conv_info.pad_left();
+    convolution.padding_top    = conv_info.pad_top();
+
+    // The results are written straight to an NHWC output, NCHW needs them reshaped
+    ITensor *gemm_output = output;
+    if(_is_nchw)
+    {
+        _gemm_output.allocator()->init(TensorInfo(get_gemm_output_shape(input->info(), weights->info(), conv_w, conv_h), 1, input->info()->data_type()));
+        _memory_group.manage(&_gemm_output);
+        gemm_output = &_gemm_output;
+    }
+
+    if(!setup_assembly_kernel(input, &_weights_reshaped, gemm_output, 1.f, 0.f, true, _workspace, _B_pretransposed, _memory_group, _asm_glue,
+                              biases, _is_activationlayer_enabled ? ActivationLayerInfo() : act_info, nullptr, &convolution))
+    {
+        ARM_COMPUTE_ERROR("setup_assembly_kernel failed.");
+    }
+
+    if(_is_nchw)
+    {
+        _output_col2im_kernel.configure(&_gemm_output, output, Size2D(conv_w, conv_h));
+        _gemm_output.allocator()->allocate();
+    }
+
+    _weights_reshaped.allocator()->allocate();
+
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.configure(output, nullptr, act_info);
+    }
+}
+
+Status NEImplicitGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                                const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.are_reshaped(), "Reshaped weights are not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dilation != Size2D(1U, 1U), "Dilation is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
+
+    const DataLayout data_layout = input->data_layout();
+    const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const int        idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) != input->dimension(idx_channel));
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(3));
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+    }
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->dimension(idx_width), input->dimension(idx_height), weights->dimension(idx_width), weights->dimension(idx_height), conv_info);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((output->dimension(idx_width) != conv_w) || (output->dimension(idx_height) != conv_h), "Output shape does not match the expected one");
+    // Batches of a single output position are run as a batched GEMM, which can't gather its rows
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_w * conv_h == 1 && input->tensor_shape().total_size_upper(3) > 1, "Batches of single output positions are not supported");
+
+    TensorInfo weights_reshaped = weights->clone()->set_tensor_shape(TensorShape(weights->dimension(3), weights->dimension(idx_width) * weights->dimension(idx_height) * weights->dimension(idx_channel)));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, nullptr, &weights_reshaped, false /* 1xW transpose */));
+
+    if(data_layout == DataLayout::NCHW)
+    {
+        const TensorInfo gemm_output = input->clone()->set_tensor_shape(get_gemm_output_shape(input, weights, conv_w, conv_h));
+        ARM_COMPUTE_RETURN_ON_ERROR(NECol2ImKernel::validate(&gemm_output, output, Size2D(conv_w, conv_h)));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    }
+
+    if(!is_activation_supported_by_assembly(act_info))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+    }
+
+    return Status{};
+}
+
+void NEImplicitGEMMConvolutionLayer::run()
+{
+    // Run weights reshaping (Runs once for every configure)
+    if(!_are_weights_reshaped)
+    {
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+        _are_weights_reshaped = true;
+
+        // Weights already pretransposed in the weights cache don't need reshaping
+        if(!_asm_glue.import_pretransposed_B(_original_weights))
+        {
+            _reshape_weights.run();
+        }
+
+        // Mark original weights tensor as unused
+        _original_weights->mark_as_unused();
+    }
+
+    _memory_group.acquire();
+
+    _asm_glue.run();
+
+    // Release weights in case buffer is pretransposed
+    if(!_weights_reshaped.is_used())
+    {
+        _weights_reshaped.allocator()->free();
+    }
+
+    // Reshape output matrix
+    if(_is_nchw)
+    {
+        NEScheduler::get().schedule(&_output_col2im_kernel, Window::DimY);
+    }
+
+    _memory_group.release();
+
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.run();
+    }
+}
+} // namespace arm_compute
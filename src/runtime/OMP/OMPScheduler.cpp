@@ -56,10 +56,12 @@ void OMPScheduler::set_num_threads(unsigned int num_threads)
     _num_threads                 = (num_threads == 0) ? num_cores : num_threads;
 }
 
-void OMPScheduler::schedule(ICPPKernel *kernel, unsigned int split_dimension)
+void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 
+    const unsigned int split_dimension = hints.split_dimension();
+
     ThreadInfo info;
     info.cpu_info = &_cpu_info;
 
@@ -24,6 +24,7 @@
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
 #include "arm_compute/runtime/OffsetMemoryPool.h"
@@ -31,13 +32,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
+#include <numeric>
 #include <vector>
 
 using namespace arm_compute;
 
 OffsetLifetimeManager::OffsetLifetimeManager()
-    : _blob(0)
+    : _blob(0), _unpacked_blob(0)
 {
 }
 
@@ -47,35 +50,129 @@ std::unique_ptr<IMemoryPool> OffsetLifetimeManager::create_pool(IAllocator *allo
     return support::cpp14::make_unique<OffsetMemoryPool>(allocator, _blob);
 }
 
+std::unique_ptr<IMemoryPool> OffsetLifetimeManager::create_pool(MemoryArena *arena)
+{
+    ARM_COMPUTE_ERROR_ON(arena == nullptr);
+    return support::cpp14::make_unique<OffsetMemoryPool>(arena, _blob);
+}
+
 MappingType OffsetLifetimeManager::mapping_type() const
 {
     return MappingType::OFFSETS;
 }
 
+size_t OffsetLifetimeManager::planned_size() const
+{
+    return _blob;
+}
+
+size_t OffsetLifetimeManager::unpacked_size() const
+{
+    return _unpacked_blob;
+}
+
 void OffsetLifetimeManager::update_blobs_and_mappings()
 {
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
     ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
 
-    // Update blob size
-    size_t max_group_size = std::accumulate(std::begin(_free_blobs), std::end(_free_blobs), static_cast<size_t>(0), [](size_t s, const Blob & b)
+    // Each element starts on a cache line
+    auto aligned_size = [](size_t size)
+    {
+        return ((size + Allocator::cache_line_size - 1) / Allocator::cache_line_size) * Allocator::cache_line_size;
+    };
+
+    // Size of the blobs laid end to end, kept for reporting
+    const size_t unpacked_group_size = std::accumulate(std::begin(_free_blobs), std::end(_free_blobs), static_cast<size_t>(0), [&](size_t s, const Blob & b)
     {
-        return s + b.max_size;
+        return s + aligned_size(b.max_size);
     });
-    _blob = std::max(_blob, max_group_size);
+    _unpacked_blob = std::max(_unpacked_blob, unpacked_group_size);
 
+    // Greedy by size: place the largest elements first, each one in the tightest gap
+    // left by the already placed elements whose lifetimes overlap with its own
+    std::vector<const Element *> elements;
+    for(const auto &active_element : _active_elements)
+    {
+        elements.push_back(&active_element.second);
+    }
+    std::stable_sort(std::begin(elements), std::end(elements), [](const Element * a, const Element * b)
+    {
+        return (a->size != b->size) ? (a->size > b->size) : (a->start < b->start);
+    });
+
+    struct Placement
+    {
+        size_t         offset;
+        size_t         size;
+        const Element *element;
+    };
+    std::vector<Placement> placements; // Sorted by offset
+    size_t                 group_size = 0;
+
+    for(const Element *element : elements)
+    {
+        const size_t size = aligned_size(element->size);
+
+        // Find the best fitting gap between the placed elements alive at the same time
+        size_t best_offset = 0;
+        size_t best_gap    = std::numeric_limits<size_t>::max();
+        size_t prev_end    = 0;
+        bool   found       = false;
+        for(const auto &placement : placements)
+        {
+            const bool overlap = (placement.element->start < element->end) && (element->start < placement.element->end);
+            if(!overlap)
+            {
+                continue;
+            }
+            if(placement.offset > prev_end)
+            {
+                const size_t gap = placement.offset - prev_end;
+                if(gap >= size && gap < best_gap)
+                {
+                    best_offset = prev_end;
+                    best_gap    = gap;
+                    found       = true;
+                }
+            }
+            prev_end = std::max(prev_end, placement.offset + placement.size);
+        }
+        const size_t offset = found ? best_offset : prev_end;
+
+        auto it = std::upper_bound(std::begin(placements), std::end(placements), offset, [](size_t o, const Placement & p)
+        {
+            return o < p.offset;
+        });
+        placements.insert(it, Placement{ offset, size, element });
+        group_size = std::max(group_size, offset + size);
+    }
     // Calculate group mappings
     auto &group_mappings = _active_group->mappings();
-    size_t offset         = 0;
-    for(auto &free_blob : _free_blobs)
+    if(group_size <= unpacked_group_size)
+    {
+        for(const auto &placement : placements)
+        {
+            group_mappings[placement.element->handle] = placement.offset;
+        }
+        _blob = std::max(_blob, group_size);
+        _footprints.push_back(GroupFootprint{ _active_group, group_size });
+    }
+    else
     {
-        for(auto &bound_element_id : free_blob.bound_elements)
+        // Heuristic did worse than the blobs: lay them end to end
+        size_t offset = 0;
+        for(auto &free_blob : _free_blobs)
         {
-            ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
-            Element &bound_element               = _active_elements[bound_element_id];
-            group_mappings[bound_element.handle] = offset;
+            for(auto &bound_element_id : free_blob.bound_elements)
+            {
+                ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
+                Element &bound_element               = _active_elements[bound_element_id];
+                group_mappings[bound_element.handle] = offset;
+            }
+            offset += aligned_size(free_blob.max_size);
         }
-        offset += free_blob.max_size;
-        ARM_COMPUTE_ERROR_ON(offset > _blob);
+        _blob = std::max(_blob, unpacked_group_size);
+        _footprints.push_back(GroupFootprint{ _active_group, unpacked_group_size });
     }
 }
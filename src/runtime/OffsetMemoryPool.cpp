@@ -28,27 +28,51 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/MemoryArena.h"
 #include "arm_compute/runtime/Types.h"
 #include "support/ToolchainSupport.h"
 
 using namespace arm_compute;
 
 OffsetMemoryPool::OffsetMemoryPool(IAllocator *allocator, size_t blob_size)
-    : _allocator(allocator), _blob(), _blob_size(blob_size)
+    : _allocator(allocator), _arena(nullptr), _blob(), _blob_size(blob_size)
 {
     ARM_COMPUTE_ERROR_ON(!allocator);
     _blob = _allocator->allocate(_blob_size, 0);
 }
 
+OffsetMemoryPool::OffsetMemoryPool(MemoryArena *arena, size_t blob_size)
+    : _allocator(nullptr), _arena(arena), _blob(), _blob_size(blob_size)
+{
+    ARM_COMPUTE_ERROR_ON(!arena);
+}
+
 OffsetMemoryPool::~OffsetMemoryPool()
 {
-    ARM_COMPUTE_ERROR_ON(!_allocator);
-    _allocator->free(_blob);
+    if(_arena != nullptr)
+    {
+        if(_blob != nullptr)
+        {
+            _arena->release(_blob);
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR_ON(!_allocator);
+        _allocator->free(_blob);
+    }
     _blob = nullptr;
 }
 
 void OffsetMemoryPool::acquire(MemoryMappings &handles)
 {
+    // Lease the memory blob for the duration of the acquisition
+    if(_arena != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(_blob != nullptr, "Memory pool is already acquired!");
+        _blob = _arena->lease(_blob_size);
+    }
+
     ARM_COMPUTE_ERROR_ON(_blob == nullptr);
 
     // Set memory to handlers
@@ -66,6 +90,13 @@ void OffsetMemoryPool::release(MemoryMappings &handles)
         ARM_COMPUTE_ERROR_ON(handle.first == nullptr);
         *handle.first = nullptr;
     }
+
+    // Return the memory blob to the arena
+    if(_arena != nullptr && _blob != nullptr)
+    {
+        _arena->release(_blob);
+        _blob = nullptr;
+    }
 }
 
 MappingType OffsetMemoryPool::mapping_type() const
@@ -75,6 +106,10 @@ MappingType OffsetMemoryPool::mapping_type() const
 
 std::unique_ptr<IMemoryPool> OffsetMemoryPool::duplicate()
 {
+    if(_arena != nullptr)
+    {
+        return support::cpp14::make_unique<OffsetMemoryPool>(_arena, _blob_size);
+    }
     ARM_COMPUTE_ERROR_ON(!_allocator);
     return support::cpp14::make_unique<OffsetMemoryPool>(_allocator, _blob_size);
 }
\ No newline at end of file
@@ -32,7 +32,7 @@
 using namespace arm_compute;
 
 PoolManager::PoolManager()
-    : _free_pools(), _occupied_pools(), _sem(), _mtx()
+    : _free_pools(), _occupied_pools(), _sem(), _mtx(), _is_frozen(false)
 {
 }
 
@@ -40,6 +40,12 @@ IMemoryPool *PoolManager::lock_pool()
 {
     ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
 
+    // All the groups share the single pool
+    if(_is_frozen)
+    {
+        return _free_pools.front().get();
+    }
+
     _sem->wait();
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
     ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty(), "Empty pool must exist as semaphore has been signalled");
@@ -51,6 +57,11 @@ void PoolManager::unlock_pool(IMemoryPool *pool)
 {
     ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
 
+    if(_is_frozen)
+    {
+        return;
+    }
+
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
     auto it = std::find_if(std::begin(_occupied_pools), std::end(_occupied_pools), [pool](const std::unique_ptr<IMemoryPool> &pool_it)
     {
@@ -65,6 +76,7 @@ void PoolManager::register_pool(std::unique_ptr<IMemoryPool> pool)
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
     ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to register a new one!");
+    ARM_COMPUTE_ERROR_ON_MSG(_is_frozen, "Pool manager is frozen!");
 
     // Set pool
     _free_pools.push_front(std::move(pool));
@@ -78,4 +90,17 @@ size_t PoolManager::num_pools() const
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
 
     return _free_pools.size() + _occupied_pools.size();
+}
+
+void PoolManager::freeze()
+{
+    std::lock_guard<arm_compute::Mutex> lock(_mtx);
+    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.size() != 1 || !_occupied_pools.empty(), "Only a single free pool can be frozen!");
+
+    _is_frozen = true;
+}
+
+bool PoolManager::is_frozen() const
+{
+    return _is_frozen;
 }
\ No newline at end of file
@@ -46,6 +46,13 @@ Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::CPP;
 Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::ST;
 #endif /* ARM_COMPUTE_*_SCHEDULER */
 
+#if ARM_COMPUTE_CPP_SCHEDULER
+namespace
+{
+thread_local IScheduler *thread_local_scheduler = nullptr;
+} // namespace
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
 void Scheduler::set(Type t)
 {
     ARM_COMPUTE_ERROR_ON(!Scheduler::is_available(t));
@@ -93,8 +100,25 @@ Scheduler::Type Scheduler::get_type()
     return _scheduler_type;
 }
 
+void Scheduler::set_thread_local(IScheduler *scheduler)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    thread_local_scheduler = scheduler;
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(scheduler);
+    ARM_COMPUTE_ERROR_ON_MSG(scheduler != nullptr, "Recompile with cppthreads=1 to use thread local schedulers.");
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
 IScheduler &Scheduler::get()
 {
+#if ARM_COMPUTE_CPP_SCHEDULER
+    if(thread_local_scheduler != nullptr)
+    {
+        return *thread_local_scheduler;
+    }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
     switch(_scheduler_type)
     {
         case Type::ST:
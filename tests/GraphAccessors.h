@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_TEST_GRAPH_ACCESSORS_H__
+#define __ARM_COMPUTE_TEST_GRAPH_ACCESSORS_H__
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "tests/Globals.h"
+#include "tests/SimpleTensor.h"
+#include "tests/Utils.h"
+
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+/** Graph accessor filling an F32 tensor with uniformly distributed values
+ *
+ * The values only depend on the seed and on the shape of the tensor in NCHW, so that equivalent NCHW and NHWC tensors get the same values.
+ * The seed offset is incremented at each call: consecutive runs of a graph get different inputs.
+ */
+class UniformGraphAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] seed_offset Seed offset of the first call, added to the seed of the assets library.
+     * @param[in] low         Lower bound of the distribution.
+     * @param[in] high        Upper bound of the distribution.
+     */
+    UniformGraphAccessor(std::random_device::result_type seed_offset, float low = -1.f, float high = 1.f)
+        : _seed_offset(seed_offset), _low(low), _high(high)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        std::mt19937                          gen(library->seed() + _seed_offset++);
+        std::uniform_real_distribution<float> distribution(_low, _high);
+
+        const bool  is_nhwc = tensor.info()->data_layout() == DataLayout::NHWC;
+        TensorShape shape   = tensor.info()->tensor_shape();
+        if(is_nhwc)
+        {
+            permute(shape, PermutationVector(1U, 2U, 0U));
+        }
+
+        for(size_t element_idx = 0; element_idx < shape.total_size(); ++element_idx)
+        {
+            Coordinates id = index2coord(shape, element_idx);
+            if(is_nhwc)
+            {
+                permute(id, PermutationVector(2U, 0U, 1U));
+            }
+            *reinterpret_cast<float *>(tensor.ptr_to_element(id)) = distribution(gen);
+        }
+        return true;
+    }
+
+private:
+    std::random_device::result_type _seed_offset;
+    float                           _low;
+    float                           _high;
+};
+
+/** Graph accessor copying an F32 tensor to a SimpleTensor at each call */
+class SimpleTensorGraphAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] outputs Vector to append the copy of the tensor to at each call.
+     */
+    explicit SimpleTensorGraphAccessor(std::vector<SimpleTensor<float>> &outputs)
+        : _outputs(outputs)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        SimpleTensor<float> dst(tensor.info()->tensor_shape(), DataType::F32, 1, 0, QuantizationInfo(), tensor.info()->data_layout());
+        for(int element_idx = 0; element_idx < dst.num_elements(); ++element_idx)
+        {
+            dst[element_idx] = *reinterpret_cast<const float *>(tensor.ptr_to_element(index2coord(dst.shape(), element_idx)));
+        }
+        _outputs.push_back(std::move(dst));
+        return true;
+    }
+
+private:
+    std::vector<SimpleTensor<float>> &_outputs;
+};
+} // namespace test
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_TEST_GRAPH_ACCESSORS_H__ */
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/graph.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "support/ToolchainSupport.h"
+#include "tests/GraphAccessors.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// The global operator new/delete are replaced to count the allocations,
+// so these tests are built in a binary of their own rather than in the validation one.
+namespace
+{
+/** Heap allocations and deallocations made while counting */
+std::atomic<bool>   count_allocations{ false };
+std::atomic<size_t> num_allocations{ 0 };
+std::atomic<size_t> num_deallocations{ 0 };
+
+void *counted_allocate(size_t size)
+{
+    if(count_allocations.load(std::memory_order_relaxed))
+    {
+        ++num_allocations;
+    }
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void counted_free(void *ptr)
+{
+    if(ptr != nullptr && count_allocations.load(std::memory_order_relaxed))
+    {
+        ++num_deallocations;
+    }
+    std::free(ptr);
+}
+
+/** Counts the heap allocations of all threads during its lifetime
+ *
+ * @note The library allocates through operator new (See Allocator), which is replaced below to forward to malloc/free.
+ */
+class AllocationCounter final
+{
+public:
+    AllocationCounter()
+    {
+        num_allocations   = 0;
+        num_deallocations = 0;
+        count_allocations = true;
+    }
+    ~AllocationCounter()
+    {
+        count_allocations = false;
+    }
+    size_t allocations() const
+    {
+        return num_allocations;
+    }
+    size_t deallocations() const
+    {
+        return num_deallocations;
+    }
+};
+
+/** Kernel filling a buffer with a value */
+class FillKernel final : public arm_compute::ICPPKernel
+{
+public:
+    void configure(std::vector<int> *output, int value)
+    {
+        _output = output;
+        _value  = value;
+
+        arm_compute::Window win;
+        win.set(arm_compute::Window::DimX, arm_compute::Window::Dimension(0, output->size(), 1));
+        ICPPKernel::configure(win);
+    }
+    void run(const arm_compute::Window &window, const arm_compute::ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+        for(int x = window.x().start(); x < window.x().end(); ++x)
+        {
+            (*_output)[x] = _value;
+        }
+    }
+    const char *name() const override
+    {
+        return "FillKernel";
+    }
+
+private:
+    std::vector<int> *_output{ nullptr };
+    int               _value{ 0 };
+};
+} // namespace
+
+void *operator new(size_t size)
+{
+    void *ptr = counted_allocate(size);
+    if(ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return counted_allocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return counted_allocate(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    counted_free(ptr);
+}
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(Allocation)
+
+TEST_CASE(SubmitDoesNotAllocate, framework::DatasetMode::ALL)
+{
+    constexpr int num_kernels = 40;
+
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+
+    std::vector<std::vector<int>>  buffers(num_kernels, std::vector<int>(1024, 0));
+    std::vector<FillKernel>        kernels(num_kernels);
+    std::vector<IScheduler::Token> tokens(num_kernels);
+    for(int i = 0; i < num_kernels; ++i)
+    {
+        kernels[i].configure(&buffers[i], i + 1);
+    }
+
+    // More kernels than the scheduler keeps states for are in flight
+    size_t allocations   = 0;
+    size_t deallocations = 0;
+    {
+        AllocationCounter counter;
+        for(int i = 0; i < num_kernels; ++i)
+        {
+            tokens[i] = scheduler.submit(&kernels[i], Window::DimX);
+        }
+        for(int i = num_kernels - 1; i >= 0; --i)
+        {
+            scheduler.wait(tokens[i]);
+        }
+        allocations   = counter.allocations();
+        deallocations = counter.deallocations();
+    }
+    ARM_COMPUTE_EXPECT_EQUAL(allocations, 0U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(deallocations, 0U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(buffers.back().front() == num_kernels, framework::LogLevel::ERRORS);
+}
+
+DATA_TEST_CASE(FrozenGraphDoesNotAllocate, framework::DatasetMode::ALL, framework::dataset::make("NumThreads", { 1, 4 }), num_threads)
+{
+    using namespace arm_compute::graph;
+    using namespace arm_compute::graph::frontend;
+
+    Stream graph(0, "FrozenMemory");
+    graph << Target::NEON
+          << InputLayer(TensorDescriptor(TensorShape(16U, 16U, 3U), DataType::F32), support::cpp14::make_unique<UniformGraphAccessor>(0))
+          << ConvolutionLayer(3U, 3U, 8U, support::cpp14::make_unique<UniformGraphAccessor>(100), support::cpp14::make_unique<UniformGraphAccessor>(200), PadStrideInfo(1, 1, 1, 1))
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+          << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)))
+          << FullyConnectedLayer(10U, support::cpp14::make_unique<UniformGraphAccessor>(300), support::cpp14::make_unique<UniformGraphAccessor>(400))
+          << SoftmaxLayer()
+          << OutputLayer(nullptr);
+
+    GraphConfig config;
+    config.use_frozen_memory = true;
+    config.num_threads       = num_threads;
+    graph.finalize(Target::NEON, config);
+
+    // Warm up
+    graph.run();
+
+    // Stop counting before checking: the expectations allocate
+    size_t allocations   = 0;
+    size_t deallocations = 0;
+    {
+        AllocationCounter counter;
+        for(unsigned int i = 0; i < 10; ++i)
+        {
+            graph.run();
+        }
+        allocations   = counter.allocations();
+        deallocations = counter.deallocations();
+    }
+    ARM_COMPUTE_EXPECT_EQUAL(allocations, 0U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(deallocations, 0U, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
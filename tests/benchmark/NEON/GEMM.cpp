@@ -30,6 +30,7 @@
 #include "tests/benchmark/fixtures/GEMMFixture.h"
 #include "tests/datasets/GoogleNetGEMMDataset.h"
 #include "tests/datasets/MatrixMultiplyGEMMDataset.h"
+#include "tests/datasets/SmallMGEMMDataset.h"
 #include "tests/datasets/system_tests/googlenet/inceptionv1/GoogLeNetInceptionV1GEMMDataset.h"
 #include "tests/framework/Macros.h"
 #include "tests/framework/datasets/Datasets.h"
@@ -51,9 +52,11 @@ const auto data_types = framework::dataset::make("DataType",
     DataType::F32
 });
 const auto reshape_b_only_once = framework::dataset::make("ReshapeBOnlyOnce", { false, true });
+const auto block_densities     = framework::dataset::make("Density", { 1.f, 0.5f, 0.3f, 0.2f, 0.1f });
 } // namespace
 
-using NEGEMMFixture = GEMMFixture<Tensor, NEGEMM, Accessor>;
+using NEGEMMFixture            = GEMMFixture<Tensor, NEGEMM, Accessor>;
+using NEBlockSparseGEMMFixture = BlockSparseGEMMFixture<Tensor, NEGEMM, Accessor>;
 
 TEST_SUITE(NEON)
 
@@ -64,6 +67,13 @@ REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1GEMM, NEGEMMFixture, framewo
 REGISTER_FIXTURE_DATA_TEST_CASE(MatrixMultiplyGEMM, NEGEMMFixture, framework::DatasetMode::ALL, framework::dataset::combine(framework::dataset::combine(datasets::MatrixMultiplyGEMMDataset(),
                                 data_types),
                                 reshape_b_only_once));
+REGISTER_FIXTURE_DATA_TEST_CASE(SmallMGEMM, NEGEMMFixture, framework::DatasetMode::ALL, framework::dataset::combine(framework::dataset::combine(datasets::SmallMGEMMDataset(),
+                                data_types),
+                                reshape_b_only_once));
+REGISTER_FIXTURE_DATA_TEST_CASE(BlockSparseGEMM, NEBlockSparseGEMMFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(datasets::MatrixMultiplyGEMMDataset(),
+                                                                                        framework::dataset::make("DataType", DataType::F32)),
+                                                            block_densities));
 REGISTER_FIXTURE_DATA_TEST_CASE(GoogleNetGEMM, NEGEMMFixture, framework::DatasetMode::NIGHTLY, framework::dataset::combine(framework::dataset::combine(datasets::GoogleNetGEMMDataset(),
                                 data_types),
                                 reshape_b_only_once));
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+#if ARM_COMPUTE_OPENMP_SCHEDULER
+#include "arm_compute/runtime/OMP/OMPScheduler.h"
+#endif /* ARM_COMPUTE_OPENMP_SCHEDULER */
+#include "tests/benchmark/fixtures/SchedulerFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto strategies = framework::dataset::make("Strategy", { IScheduler::StrategyHint::STATIC, IScheduler::StrategyHint::DYNAMIC });
+} // namespace
+
+using NEUnbalancedSchedulerFixture         = UnbalancedSchedulerFixture<NEScheduler>;
+using SingleThreadSchedulerDispatchFixture = SchedulerDispatchFixture<SingleThreadScheduler>;
+#if ARM_COMPUTE_OPENMP_SCHEDULER
+using OMPSchedulerDispatchFixture = SchedulerDispatchFixture<OMPScheduler>;
+#endif /* ARM_COMPUTE_OPENMP_SCHEDULER */
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+/** Dispatch fixture which sets the spin budget of the C++11 scheduler */
+class CPPSchedulerSpinDispatchFixture : public SchedulerDispatchFixture<CPPScheduler>
+{
+public:
+    template <typename...>
+    void setup(unsigned int spin_budget)
+    {
+        _old_spin_budget = CPPScheduler::get().spin_budget();
+        CPPScheduler::get().set_spin_budget(spin_budget);
+        SchedulerDispatchFixture<CPPScheduler>::setup();
+    }
+
+    void teardown()
+    {
+        CPPScheduler::get().set_spin_budget(_old_spin_budget);
+    }
+
+private:
+    unsigned int _old_spin_budget{ 0 };
+};
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+TEST_SUITE(NEON)
+TEST_SUITE(Scheduler)
+
+REGISTER_FIXTURE_DATA_TEST_CASE(Unbalanced, NEUnbalancedSchedulerFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::make("Rows", { 64U, 256U, 1024U }), strategies));
+
+TEST_SUITE(Dispatch)
+REGISTER_FIXTURE_TEST_CASE(SingleThread, SingleThreadSchedulerDispatchFixture, framework::DatasetMode::ALL);
+#if ARM_COMPUTE_CPP_SCHEDULER
+REGISTER_FIXTURE_DATA_TEST_CASE(CPP, CPPSchedulerSpinDispatchFixture, framework::DatasetMode::ALL,
+                                framework::dataset::make("SpinBudget", { 0U, 1000U, 100000U }));
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+#if ARM_COMPUTE_OPENMP_SCHEDULER
+REGISTER_FIXTURE_TEST_CASE(OMP, OMPSchedulerDispatchFixture, framework::DatasetMode::ALL);
+#endif /* ARM_COMPUTE_OPENMP_SCHEDULER */
+TEST_SUITE_END()
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -30,6 +30,9 @@
 #include "tests/Utils.h"
 #include "tests/framework/Fixture.h"
 
+#include <algorithm>
+#include <random>
+
 namespace arm_compute
 {
 namespace test
@@ -81,6 +84,82 @@ public:
         dst.allocator()->free();
     }
 
+private:
+    TensorType a{};
+    TensorType b{};
+    TensorType c{};
+    TensorType dst{};
+    Function   gemm{};
+};
+
+/** Fixture measuring GEMMs whose B is pruned to a ratio of nonzero blocks */
+template <typename TensorType, typename Function, typename Accessor>
+class BlockSparseGEMMFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_c, TensorShape shape_dst, float alpha, float beta, DataType data_type, float density)
+    {
+        // Create tensors
+        a   = create_tensor<TensorType>(shape_a, data_type);
+        b   = create_tensor<TensorType>(shape_b, data_type);
+        c   = create_tensor<TensorType>(shape_c, data_type);
+        dst = create_tensor<TensorType>(shape_dst, data_type);
+
+        // Create and configure function: B is only reshaped on the first run, which is when it is found sparse or not
+        gemm.configure(&a, &b, &c, &dst, alpha, beta, GEMMInfo(false, false, true));
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        c.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Keep a ratio density of the blocks of 4 consecutive values of the rows of B, like the weights of a pruned layer
+        library->fill_tensor_uniform(Accessor(a), 0);
+        library->fill_tensor_uniform(Accessor(b), 1);
+        library->fill_tensor_uniform(Accessor(c), 2);
+
+        Accessor                    b_accessor(b);
+        std::mt19937                gen(library->seed());
+        std::bernoulli_distribution keep(density);
+        for(unsigned int y = 0; y < shape_b.y(); ++y)
+        {
+            for(unsigned int x = 0; x < shape_b.x(); x += 4)
+            {
+                if(!keep(gen))
+                {
+                    for(unsigned int i = x; i < std::min(x + 4, static_cast<unsigned int>(shape_b.x())); ++i)
+                    {
+                        *reinterpret_cast<float *>(b_accessor(Coordinates(i, y))) = 0.f;
+                    }
+                }
+            }
+        }
+
+        // Reshape B out of the measurements
+        gemm.run();
+    }
+
+    void run()
+    {
+        gemm.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        a.allocator()->free();
+        b.allocator()->free();
+        c.allocator()->free();
+        dst.allocator()->free();
+    }
+
 private:
     TensorType a{};
     TensorType b{};
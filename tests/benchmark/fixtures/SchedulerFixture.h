@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_SCHEDULERFIXTURE
+#define ARM_COMPUTE_TEST_SCHEDULERFIXTURE
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "tests/framework/Fixture.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Synthetic kernel whose rows don't all have the same cost
+ *
+ * The first rows of the window are much more expensive than the others, which emulates kernels
+ * with expensive border handling or threads running on cores with different performance.
+ */
+class UnbalancedKernel final : public ICPPKernel
+{
+public:
+    /** Initialise the kernel
+     *
+     * @param[in] num_rows        Number of rows in the window.
+     * @param[in] num_heavy_rows  Number of expensive rows at the beginning of the window.
+     * @param[in] row_cost        Number of operations performed for each cheap row.
+     * @param[in] heavy_row_ratio Cost ratio between an expensive and a cheap row.
+     */
+    void configure(unsigned int num_rows, unsigned int num_heavy_rows, unsigned int row_cost, unsigned int heavy_row_ratio)
+    {
+        _num_heavy_rows  = num_heavy_rows;
+        _row_cost        = row_cost;
+        _heavy_row_ratio = heavy_row_ratio;
+        _accumulators.assign(num_rows, 0.f);
+
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        win.set(Window::DimY, Window::Dimension(0, num_rows, 1));
+        ICPPKernel::configure(win);
+    }
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+        for(int y = window.y().start(); y < window.y().end(); y += window.y().step())
+        {
+            const unsigned int cost = (static_cast<unsigned int>(y) < _num_heavy_rows) ? _row_cost * _heavy_row_ratio : _row_cost;
+
+            float acc = _accumulators[y];
+            for(unsigned int i = 0; i < cost; ++i)
+            {
+                acc = acc * 0.999f + 1.f;
+            }
+            _accumulators[y] = acc;
+        }
+    }
+    const char *name() const override
+    {
+        return "UnbalancedKernel";
+    }
+
+private:
+    unsigned int       _num_heavy_rows{ 0 };
+    unsigned int       _row_cost{ 0 };
+    unsigned int       _heavy_row_ratio{ 1 };
+    std::vector<float> _accumulators{};
+};
+
+/** Kernel which does nothing, used to measure the dispatch overhead of the schedulers */
+class EmptyKernel final : public ICPPKernel
+{
+public:
+    /** Initialise the kernel
+     *
+     * @param[in] num_rows Number of rows in the window.
+     */
+    void configure(unsigned int num_rows)
+    {
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        win.set(Window::DimY, Window::Dimension(0, num_rows, 1));
+        ICPPKernel::configure(win);
+    }
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(window, info);
+    }
+    const char *name() const override
+    {
+        return "EmptyKernel";
+    }
+};
+
+/** Fixture that measures the cost of dispatching an empty kernel to the threads of a scheduler */
+template <typename Scheduler>
+class SchedulerDispatchFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup()
+    {
+        // One row per thread so that every thread of the pool gets woken up
+        kernel.configure(Scheduler::get().num_threads());
+    }
+
+    void run()
+    {
+        // Dispatch many kernels per iteration to get above the timer's resolution
+        for(unsigned int i = 0; i < num_dispatches; ++i)
+        {
+            Scheduler::get().schedule(&kernel, Window::DimY);
+        }
+    }
+
+    void sync()
+    {
+    }
+
+    /** Number of kernels dispatched by each run() */
+    static constexpr unsigned int num_dispatches = 100;
+
+private:
+    EmptyKernel kernel{};
+};
+
+/** Fixture that measures how a scheduler copes with an unbalanced workload */
+template <typename Scheduler>
+class UnbalancedSchedulerFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(unsigned int num_rows, IScheduler::StrategyHint strategy)
+    {
+        // An eighth of the rows are 16 times more expensive than the others
+        kernel.configure(num_rows, num_rows / 8, 256, 16);
+        hints.set_strategy(strategy);
+    }
+
+    void run()
+    {
+        Scheduler::get().schedule(&kernel, hints);
+    }
+
+    void sync()
+    {
+    }
+
+private:
+    UnbalancedKernel  kernel{};
+    IScheduler::Hints hints{ Window::DimY };
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SCHEDULERFIXTURE */
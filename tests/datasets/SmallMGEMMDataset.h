@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_SMALLM_GEMM_DATASET
+#define ARM_COMPUTE_TEST_SMALLM_GEMM_DATASET
+
+#include "tests/datasets/GEMMDataset.h"
+
+#include "utils/TypePrinter.h"
+
+#include "arm_compute/core/TensorShape.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace datasets
+{
+/** GEMMs with only a few rows, where the work has to be split along N to use all the cores. */
+class SmallMGEMMDataset final : public GEMMDataset
+{
+public:
+    SmallMGEMMDataset()
+    {
+        // Fully connected layers with a small batch
+        add_config(TensorShape(1024U, 4U), TensorShape(1000U, 1024U), TensorShape(1000U, 4U), TensorShape(1000U, 4U), 1.0f, 0.0f);
+        add_config(TensorShape(4096U, 4U), TensorShape(4096U, 4096U), TensorShape(4096U, 4U), TensorShape(4096U, 4U), 1.0f, 0.0f);
+        add_config(TensorShape(9216U, 8U), TensorShape(4096U, 9216U), TensorShape(4096U, 8U), TensorShape(4096U, 8U), 1.0f, 0.0f);
+        add_config(TensorShape(4096U, 8U), TensorShape(1000U, 4096U), TensorShape(1000U, 8U), TensorShape(1000U, 8U), 1.0f, 0.0f);
+        // MobileNet 1x1 convolutions on 7x7 inputs
+        add_config(TensorShape(512U, 49U), TensorShape(1024U, 512U), TensorShape(1024U, 49U), TensorShape(1024U, 49U), 1.0f, 0.0f);
+        add_config(TensorShape(1024U, 49U), TensorShape(1024U, 1024U), TensorShape(1024U, 49U), TensorShape(1024U, 49U), 1.0f, 0.0f);
+    }
+};
+} // namespace datasets
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SMALLM_GEMM_DATASET */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "GEMMProfiler.h"
+
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+namespace
+{
+const std::array<std::pair<arm_gemm::ProfilePhase, const char *>, NEGEMMProfiler::num_phases> phase_names =
+{
+    {
+        { arm_gemm::ProfilePhase::PrepareA, "prepare_A" },
+        { arm_gemm::ProfilePhase::PrepareB, "prepare_B" },
+        { arm_gemm::ProfilePhase::Kernel, "kernel" },
+        { arm_gemm::ProfilePhase::Merge, "merge" },
+    }
+};
+
+std::string gemm_name(const NEGEMMProfiler::GEMMMeasurement &gemm, unsigned int gemm_number)
+{
+    std::string name = gemm.layer.empty() ? "" : gemm.layer + "/";
+    name += "GEMM_" + support::cpp11::to_string(gemm.shape.M) + "x" + support::cpp11::to_string(gemm.shape.N) + "x" + support::cpp11::to_string(gemm.shape.K);
+    if(gemm.shape.batches * gemm.shape.multis > 1)
+    {
+        name += "x" + support::cpp11::to_string(gemm.shape.batches * gemm.shape.multis);
+    }
+    return name + " #" + support::cpp11::to_string(gemm_number);
+}
+} // namespace
+
+GEMMProfiler::GEMMProfiler(ScaleFactor scale_factor)
+    : _profiler(), _real_profiler(nullptr), _real_graph_function(nullptr), _scale_factor()
+{
+    switch(scale_factor)
+    {
+        case ScaleFactor::NONE:
+            _scale_factor = 1.f;
+            _unit         = "us";
+            break;
+        case ScaleFactor::TIME_MS:
+            _scale_factor = 1000.f;
+            _unit         = "ms";
+            break;
+        case ScaleFactor::TIME_S:
+            _scale_factor = 1000000.f;
+            _unit         = "s";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Invalid scale");
+    }
+}
+
+std::string GEMMProfiler::id() const
+{
+    return "GEMMProfiler";
+}
+
+void GEMMProfiler::test_start()
+{
+    // Name the GEMMs after the graph nodes running them
+    ARM_COMPUTE_ERROR_ON(_real_graph_function != nullptr);
+    _real_graph_function  = graph::TaskExecutor::get().execute_function;
+    auto task_interceptor = [this](graph::ExecutionTask & task)
+    {
+        _profiler.set_layer((task.node != nullptr) ? task.node->name() : "");
+        this->_real_graph_function(task);
+        _profiler.set_layer("");
+    };
+    graph::TaskExecutor::get().execute_function = task_interceptor;
+
+    _real_profiler = Scheduler::get().gemm_profiler();
+    Scheduler::get().set_gemm_profiler(&_profiler);
+}
+
+void GEMMProfiler::start()
+{
+    _profiler.clear();
+}
+
+void GEMMProfiler::test_stop()
+{
+    Scheduler::get().set_gemm_profiler(_real_profiler);
+    _real_profiler                              = nullptr;
+    graph::TaskExecutor::get().execute_function = _real_graph_function;
+    _real_graph_function                        = nullptr;
+}
+
+Instrument::MeasurementsMap GEMMProfiler::measurements() const
+{
+    MeasurementsMap measurements;
+    unsigned int    gemm_number = 0;
+    for(const auto &gemm : _profiler.measurements())
+    {
+        const std::string name = gemm_name(gemm, gemm_number++);
+        for(const auto &phase : phase_names)
+        {
+            measurements.emplace(name + " " + phase.second, Measurement(gemm.phase(phase.first).time_ns / (1000.f * _scale_factor), _unit));
+        }
+        measurements.emplace(name + " GFLOP/s", Measurement(gemm.gflops(), "GFLOP/s"));
+        measurements.emplace(name + " bytes", Measurement(gemm.bytes(), "B"));
+    }
+
+    return measurements;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_GEMM_PROFILER
+#define ARM_COMPUTE_TEST_GEMM_PROFILER
+
+#include "Instrument.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/NEON/NEGEMMProfiler.h"
+
+#include <functional>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Instrument creating measurements based on the phases recorded by the assembly GEMMs run through the scheduler
+ *
+ * For every GEMM run, in the order they ran, it reports the time spent preparing A, preparing B, in the kernel and merging
+ * the results (summed over the threads), the GFLOP/s achieved over the wall clock time of the run and the bytes moved.
+ * The measurements are prefixed with the name of the graph node running the GEMM, if any.
+ */
+class GEMMProfiler : public Instrument
+{
+public:
+    /** Construct a GEMM profiler.
+     *
+     * @param[in] scale_factor Measurement scale factor of the times.
+     */
+    GEMMProfiler(ScaleFactor scale_factor);
+
+    /** Prevent instances of this class from being copy constructed */
+    GEMMProfiler(const GEMMProfiler &) = delete;
+    /** Prevent instances of this class from being copied */
+    GEMMProfiler &operator=(const GEMMProfiler &) = delete;
+
+    std::string                 id() const override;
+    void                        test_start() override;
+    void                        start() override;
+    void                        test_stop() override;
+    Instrument::MeasurementsMap measurements() const override;
+
+private:
+    NEGEMMProfiler                               _profiler;
+    NEGEMMProfiler                              *_real_profiler;
+    std::function<decltype(graph::execute_task)> _real_graph_function;
+    float                                        _scale_factor;
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_GEMM_PROFILER */
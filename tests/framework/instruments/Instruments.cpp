@@ -62,6 +62,9 @@ InstrumentsDescription instrument_type_from_name(const std::string &name)
         { "opencl_memory_usage", std::pair<InstrumentType, ScaleFactor>(InstrumentType::OPENCL_MEMORY_USAGE, ScaleFactor::NONE) },
         { "opencl_memory_usage_k", std::pair<InstrumentType, ScaleFactor>(InstrumentType::OPENCL_MEMORY_USAGE, ScaleFactor::SCALE_1K) },
         { "opencl_memory_usage_m", std::pair<InstrumentType, ScaleFactor>(InstrumentType::OPENCL_MEMORY_USAGE, ScaleFactor::SCALE_1M) },
+        { "gemm_profiler", std::pair<InstrumentType, ScaleFactor>(InstrumentType::GEMM_PROFILER, ScaleFactor::NONE) },
+        { "gemm_profiler_ms", std::pair<InstrumentType, ScaleFactor>(InstrumentType::GEMM_PROFILER, ScaleFactor::TIME_MS) },
+        { "gemm_profiler_s", std::pair<InstrumentType, ScaleFactor>(InstrumentType::GEMM_PROFILER, ScaleFactor::TIME_S) },
     };
 
     try
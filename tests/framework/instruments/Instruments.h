@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_TEST_INSTRUMENTS
 #define ARM_COMPUTE_TEST_INSTRUMENTS
 
+#include "GEMMProfiler.h"
 #include "MaliCounter.h"
 #include "OpenCLMemoryUsage.h"
 #include "OpenCLTimer.h"
@@ -52,6 +53,7 @@ enum class InstrumentType : unsigned int
     OPENCL_TIMER            = 0x0400,
     SCHEDULER_TIMER         = 0x0500,
     OPENCL_MEMORY_USAGE     = 0x0600,
+    GEMM_PROFILER           = 0x0700,
 };
 
 using InstrumentsDescription = std::pair<InstrumentType, ScaleFactor>;
@@ -175,6 +177,22 @@ inline ::std::stringstream &operator<<(::std::stringstream &stream, InstrumentsD
                     throw std::invalid_argument("Unsupported instrument scale");
             }
             break;
+        case InstrumentType::GEMM_PROFILER:
+            switch(instrument.second)
+            {
+                case ScaleFactor::NONE:
+                    stream << "GEMM_PROFILER";
+                    break;
+                case ScaleFactor::TIME_MS:
+                    stream << "GEMM_PROFILER_MS";
+                    break;
+                case ScaleFactor::TIME_S:
+                    stream << "GEMM_PROFILER_S";
+                    break;
+                default:
+                    throw std::invalid_argument("Unsupported instrument scale");
+            }
+            break;
         case InstrumentType::ALL:
             stream << "ALL";
             break;
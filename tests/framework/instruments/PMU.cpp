@@ -55,6 +55,13 @@ PMU::PMU(uint64_t config)
     open(config);
 }
 
+PMU::PMU(uint32_t type, uint64_t config)
+    : PMU()
+{
+    _perf_config.type = type;
+    open(config);
+}
+
 PMU::~PMU()
 {
     close();
@@ -55,6 +55,16 @@ public:
      */
     explicit PMU(uint64_t config);
 
+    /** Create PMU with specified counter of the given type.
+     *
+     * Used for counters that are not generic hardware events, e.g.
+     * PERF_TYPE_HW_CACHE or PERF_TYPE_RAW.
+     *
+     * @param[in] type   Counter type.
+     * @param[in] config Counter identifier.
+     */
+    PMU(uint32_t type, uint64_t config);
+
     /** Default destructor. */
     ~PMU();
 
@@ -23,12 +23,63 @@
  */
 #include "PMUCounter.h"
 
+#include "support/ToolchainSupport.h"
+
 namespace arm_compute
 {
 namespace test
 {
 namespace framework
 {
+namespace
+{
+#if defined(__arm__) || defined(__aarch64__)
+// Armv8 PMU common event UNALIGNED_LDST_RETIRED
+constexpr uint64_t armv8_unaligned_ldst_retired = 0x0F;
+#endif /* defined(__arm__) || defined(__aarch64__) */
+
+long long read_optional_counter(const std::unique_ptr<PMU> &pmu)
+{
+    if(pmu == nullptr)
+    {
+        return 0;
+    }
+
+    try
+    {
+        return pmu->get_value<long long>();
+    }
+    catch(const std::runtime_error &)
+    {
+        return 0;
+    }
+}
+} // namespace
+
+void PMUCounter::create_optional_counters()
+{
+    try
+    {
+        _pmu_dtlb_misses = support::cpp14::make_unique<PMU>(PERF_TYPE_HW_CACHE,
+                                                            PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    }
+    catch(const std::runtime_error &)
+    {
+        _pmu_dtlb_misses = nullptr;
+    }
+
+#if defined(__arm__) || defined(__aarch64__)
+    try
+    {
+        _pmu_unaligned = support::cpp14::make_unique<PMU>(PERF_TYPE_RAW, armv8_unaligned_ldst_retired);
+    }
+    catch(const std::runtime_error &)
+    {
+        _pmu_unaligned = nullptr;
+    }
+#endif /* defined(__arm__) || defined(__aarch64__) */
+}
+
 std::string PMUCounter::id() const
 {
     return "PMU Counter";
@@ -38,6 +89,16 @@ void PMUCounter::start()
 {
     _pmu_cycles.reset();
     _pmu_instructions.reset();
+
+    if(_pmu_dtlb_misses != nullptr)
+    {
+        _pmu_dtlb_misses->reset();
+    }
+
+    if(_pmu_unaligned != nullptr)
+    {
+        _pmu_unaligned->reset();
+    }
 }
 
 void PMUCounter::stop()
@@ -59,15 +120,30 @@ void PMUCounter::stop()
     {
         _instructions = 0;
     }
+
+    _dtlb_misses = read_optional_counter(_pmu_dtlb_misses);
+    _unaligned   = read_optional_counter(_pmu_unaligned);
 }
 
 Instrument::MeasurementsMap PMUCounter::measurements() const
 {
-    return MeasurementsMap
+    MeasurementsMap measurements
     {
         { "CPU cycles", Measurement(_cycles / _scale_factor, _unit + "cycles") },
         { "CPU instructions", Measurement(_instructions / _scale_factor, _unit + "instructions") },
     };
+
+    if(_pmu_dtlb_misses != nullptr)
+    {
+        measurements.emplace("dTLB read misses", Measurement(_dtlb_misses / _scale_factor, _unit + "misses"));
+    }
+
+    if(_pmu_unaligned != nullptr)
+    {
+        measurements.emplace("Unaligned accesses", Measurement(_unaligned / _scale_factor, _unit + "accesses"));
+    }
+
+    return measurements;
 }
 } // namespace framework
 } // namespace test
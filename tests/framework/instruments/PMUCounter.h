@@ -27,13 +27,19 @@
 #include "Instrument.h"
 #include "PMU.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 namespace test
 {
 namespace framework
 {
-/** Implementation of an instrument to count CPU cycles. */
+/** Implementation of an instrument to count CPU cycles.
+ *
+ * Data TLB misses and unaligned accesses are additionally reported when the
+ * platform exposes the corresponding events.
+ */
 class PMUCounter : public Instrument
 {
 public:
@@ -60,6 +66,7 @@ public:
             default:
                 ARM_COMPUTE_ERROR("Invalid scale");
         }
+        create_optional_counters();
     };
 
     std::string     id() const override;
@@ -68,11 +75,18 @@ public:
     MeasurementsMap measurements() const override;
 
 private:
-    PMU       _pmu_cycles{ PERF_COUNT_HW_CPU_CYCLES };
-    PMU       _pmu_instructions{ PERF_COUNT_HW_INSTRUCTIONS };
-    long long _cycles{ 0 };
-    long long _instructions{ 0 };
-    int       _scale_factor{};
+    /** Open the counters that are not available on every platform. */
+    void create_optional_counters();
+
+    PMU                  _pmu_cycles{ PERF_COUNT_HW_CPU_CYCLES };
+    PMU                  _pmu_instructions{ PERF_COUNT_HW_INSTRUCTIONS };
+    std::unique_ptr<PMU> _pmu_dtlb_misses{ nullptr };
+    std::unique_ptr<PMU> _pmu_unaligned{ nullptr };
+    long long            _cycles{ 0 };
+    long long            _instructions{ 0 };
+    long long            _dtlb_misses{ 0 };
+    long long            _unaligned{ 0 };
+    int                  _scale_factor{};
 };
 } // namespace framework
 } // namespace test
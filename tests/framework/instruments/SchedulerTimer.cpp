@@ -46,6 +46,10 @@ public:
     Interceptor(std::list<SchedulerTimer::kernel_info> &kernels, IScheduler &real_scheduler, ScaleFactor scale_factor)
         : _kernels(kernels), _real_scheduler(real_scheduler), _timer(scale_factor), _prefix()
     {
+        // The functions query the assembly GEMM settings from the scheduler they run on
+        set_gemm_tuner(real_scheduler.gemm_tuner());
+        set_weights_cache(real_scheduler.weights_cache());
+        set_gemm_profiler(real_scheduler.gemm_profiler());
     }
 
     void set_num_threads(unsigned int num_threads) override
@@ -63,10 +67,10 @@ public:
         _prefix = std::move(prefix);
     }
 
-    void schedule(ICPPKernel *kernel, unsigned int split_dimension) override
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
     {
         _timer.start();
-        _real_scheduler.schedule(kernel, split_dimension);
+        _real_scheduler.schedule(kernel, hints);
         _timer.stop();
 
         SchedulerTimer::kernel_info info;
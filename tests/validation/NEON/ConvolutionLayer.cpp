@@ -24,6 +24,8 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGroupedConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEImplicitGEMMConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -71,6 +73,20 @@ const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f)
 });
+
+/** Grouped convolutions: the weights hold IFM / num_groups channels */
+const auto GroupedConvolutionLayerDataset = zip(zip(zip(zip(framework::dataset::make("InputShape", { TensorShape(8U, 8U, 8U), TensorShape(11U, 9U, 16U, 2U), TensorShape(9U, 9U, 6U), TensorShape(7U, 7U, 64U) }),
+                                                            framework::dataset::make("WeightsShape", { TensorShape(3U, 3U, 4U, 6U), TensorShape(3U, 3U, 4U, 8U), TensorShape(5U, 5U, 3U, 4U), TensorShape(1U, 1U, 2U, 64U) })),
+                                                        framework::dataset::make("OutputShape", { TensorShape(8U, 8U, 6U), TensorShape(6U, 5U, 8U, 2U), TensorShape(9U, 9U, 4U), TensorShape(7U, 7U, 64U) })),
+                                                    framework::dataset::make("PadStrideInfo", { PadStrideInfo(1, 1, 1, 1), PadStrideInfo(2, 2, 1, 1), PadStrideInfo(1, 1, 2, 2), PadStrideInfo(1, 1, 0, 0) })),
+                                                framework::dataset::make("NumGroups", { 2U, 4U, 2U, 32U }));
+/** Activations fused in the GEMM of the grouped convolutions or run after it */
+const auto GroupedActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)
+});
 } // namespace
 
 TEST_SUITE(NEON)
@@ -80,29 +96,34 @@ DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(zip(z
                                                                                            framework::dataset::make("InputInfo", { TensorInfo(TensorShape(18U, 18U, 32U), 1, DataType::F32, 0),
                                                                                                                     TensorInfo(TensorShape(23U, 27U, 32U, 4U), 1, DataType::F32, 0),
                                                                                                                     TensorInfo(TensorShape(3U, 3U, 2U, 1U), 1, DataType::F32, 0),
-                                                                                                                    TensorInfo(TensorShape(33U, 27U, 7U, 4U), 1, DataType::F32, 0)
+                                                                                                                    TensorInfo(TensorShape(33U, 27U, 7U, 4U), 1, DataType::F32, 0),
+                                                                                                                    TensorInfo(TensorShape(17U, 31U, 2U, 4U), 1, DataType::F32, 0)
                                                                                                                                  }),
                                                                                            framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 32U, 21U), 1, DataType::F32, 0),
                                                                                                                     TensorInfo(TensorShape(5U, 5U, 32U, 21U), 1, DataType::F32, 0),
                                                                                                                     TensorInfo(TensorShape(3U, 3U, 5U, 21U), 1, DataType::F32, 0),
-                                                                                                                    TensorInfo(TensorShape(5U, 5U, 7U, 16U), 1, DataType::F16, 0)
+                                                                                                                    TensorInfo(TensorShape(5U, 5U, 7U, 16U), 1, DataType::F16, 0),
+                                                                                                                    TensorInfo(TensorShape(5U, 5U, 2U, 19U), 1, DataType::F32, 0)
                                                                                                                                    })),
                                                                                        framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(16U, 16U, 21U), 1, DataType::F32, 0),
                                                                                                                 TensorInfo(TensorShape(19U, 23U, 21U, 4U), 1, DataType::F32, 0),
                                                                                                                 TensorInfo(TensorShape(11U, 25U, 21U), 1, DataType::F32, 0),
-                                                                                                                TensorInfo(TensorShape(11U, 12U, 16U, 4U), 1, DataType::F32, 0)
+                                                                                                                TensorInfo(TensorShape(11U, 12U, 16U, 4U), 1, DataType::F32, 0),
+                                                                                                                TensorInfo(TensorShape(15U, 15U, 19U, 4U), 1, DataType::F32, 0)
                                                                                                                               })),
                                                                                    framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 0, 0),
                                                                                                             PadStrideInfo(1, 1, 0, 0),
                                                                                                             PadStrideInfo(2, 1, 0, 0),
-                                                                                                            PadStrideInfo(3, 2, 1, 0)
+                                                                                                            PadStrideInfo(3, 2, 1, 0),
+                                                                                                            PadStrideInfo(1, 2, 1, 1)
                                                                                                                         })),
                                                                                framework::dataset::make("FastMath", { true,
                                                                                                                       true,
                                                                                                                       false,
+                                                                                                                      false,
                                                                                                                       false
                                                                                                                     })),
-                                                                           framework::dataset::make("Expected", { ConvolutionMethod::WINOGRAD, ConvolutionMethod::WINOGRAD, ConvolutionMethod::GEMM, ConvolutionMethod::GEMM })),
+                                                                           framework::dataset::make("Expected", { ConvolutionMethod::WINOGRAD, ConvolutionMethod::WINOGRAD, ConvolutionMethod::GEMM, ConvolutionMethod::GEMM, ConvolutionMethod::GEMM })),
                input_info, weights_info, output_info, conv_info, fast_math, expected)
 {
     ConvolutionMethod is_valid = NEConvolutionLayer::get_convolution_method(&input_info.clone()->set_is_resizable(true),
@@ -320,6 +341,51 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMConvolutionLayerQuantizedFixture<uint8_t>
 TEST_SUITE_END()
 TEST_SUITE_END()
 
+TEST_SUITE_END()
+
+TEST_SUITE(ImplicitGEMMConvolutionLayer)
+
+template <typename T>
+using NEImplicitGEMMConvolutionLayerFixture = ConvolutionValidationFixture<Tensor, Accessor, NEImplicitGEMMConvolutionLayer, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEImplicitGEMMConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(datasets::SmallConvolutionLayerDataset(),
+                                                                                                                          framework::dataset::make("ReshapeWeights", { true })),
+                                                                                                                          framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                          framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                                                                                                          ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEImplicitGEMMConvolutionLayerFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(combine(combine(datasets::LargeConvolutionLayerDataset(),
+                                                                                                                        framework::dataset::make("ReshapeWeights", { true })),
+                                                                                                                        framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                        framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                                                                                                        ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END()
+
+TEST_SUITE_END()
+
+TEST_SUITE(GroupedConvolutionLayer)
+
+template <typename T>
+using NEGroupedConvolutionLayerFixture = GroupedConvolutionValidationFixture<Tensor, Accessor, NEGroupedConvolutionLayer, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGroupedConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(GroupedConvolutionLayerDataset,
+                                                                                                                     framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                     GroupedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END()
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 } // namespace validation
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -47,6 +48,8 @@ constexpr RelativeTolerance<float> tolerance_f32(0.01f);
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 constexpr RelativeTolerance<float> tolerance_f16(0.01f);
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC*/
+/** Absolute tolerance for the float outputs close to 0, as the fused activations are tested on signed data */
+constexpr float abs_tolerance_f32(0.0001f);
 /** Tolerance for fixed point operations */
 constexpr AbsoluteTolerance<float> tolerance_fixed_point(1.f);
 
@@ -62,6 +65,16 @@ const auto CNNDataTypes = framework::dataset::make("DataType",
 });
 
 const auto FullyConnectedParameters = combine(framework::dataset::make("TransposeWeights", { false, true }), framework::dataset::make("ReshapeWeights", { false, true }));
+
+/** Activations fused in the output stage of the assembly GEMM, then run by an activation layer after the GEMM */
+const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.75f, 0.25f),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+});
 } // namespace
 
 TEST_SUITE(NEON)
@@ -163,6 +176,34 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(
 
 template <typename T>
 using NEFullyConnectedLayerFixture = FullyConnectedLayerValidationFixture<Tensor, Accessor, NEFullyConnectedLayer, T, true>;
+template <typename T>
+using NEFullyConnectedLayerFusedActivationFixture = FullyConnectedLayerValidationFusedActivationFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
+
+/** Fully connected layer with a fused activation, configured and run with a given number of threads
+ *
+ * The batches are fewer than the threads, so the assembly GEMM splits the columns of the output between the threads.
+ */
+template <typename T>
+class NEFullyConnectedLayerMultiThreadedFixture : public NEFullyConnectedLayerFusedActivationFixture<T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, DataType data_type, ActivationLayerInfo act_info, unsigned int num_threads)
+    {
+        const unsigned int default_num_threads = NEScheduler::get().num_threads();
+        NEScheduler::get().set_num_threads(num_threads);
+        try
+        {
+            NEFullyConnectedLayerFusedActivationFixture<T>::setup(input_shape, weights_shape, bias_shape, output_shape, data_type, act_info);
+        }
+        catch(...)
+        {
+            NEScheduler::get().set_num_threads(default_num_threads);
+            throw;
+        }
+        NEScheduler::get().set_num_threads(default_num_threads);
+    }
+};
 
 TEST_SUITE(Float)
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -197,6 +238,28 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEFullyConnectedLayerFixture<float>, framework:
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallWithActivation, NEFullyConnectedLayerFusedActivationFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallFullyConnectedLayerDataset(),
+                                                                                                                                     framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                             ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLargeWithActivation, NEFullyConnectedLayerFusedActivationFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(datasets::LargeFullyConnectedLayerDataset(),
+                                                                                                                                   framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                           ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallMultiThreaded, NEFullyConnectedLayerMultiThreadedFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallFullyConnectedLayerDataset(),
+                                                                                                                                     framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                             ActivationFunctionsDataset),
+                                                                                                                     framework::dataset::make("NumThreads", { 4U, 8U })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, 0.f, abs_tolerance_f32);
+}
 TEST_SUITE_END()
 TEST_SUITE_END()
 
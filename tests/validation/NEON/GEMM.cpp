@@ -24,6 +24,9 @@
 #include "arm_compute/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/AssemblyHelper.h"
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -40,6 +43,10 @@
 #include "tests/validation/fixtures/GEMMFixture.h"
 #include "tests/validation/fixtures/GEMMInterleave4x4Fixture.h"
 #include "tests/validation/fixtures/GEMMTranspose1xWFixture.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <vector>
 
 namespace arm_compute
 {
@@ -66,8 +73,166 @@ const auto CNNDataTypes = framework::dataset::make("DataType",
 const auto data_interleave = framework::dataset::make("M", 8, 12) * framework::dataset::make("N", 8, 12);
 const auto data_transpose  = framework::dataset::make("M", 8, 14) * framework::dataset::make("N", 7, 14);
 
+/** Ratios of nonzero blocks of the pruned B, sparse enough to be stored block sparse or not */
+const auto block_densities = framework::dataset::make("Density", { 0.1f, 0.3f, 1.f });
+
+/** Problems of the batched GEMM: M and N aren't multiples of the kernel's block, several batches and/or multis */
+const auto batched_gemm_shapes = zip(zip(zip(zip(framework::dataset::make("M", { 5U, 13U, 9U }),
+                                                 framework::dataset::make("N", { 7U, 29U, 12U })),
+                                             framework::dataset::make("K", { 3U, 17U, 33U })),
+                                         framework::dataset::make("Batches", { 4U, 3U, 1U })),
+                                     framework::dataset::make("Multis", { 1U, 2U, 5U }));
+
+/** Output stages of the batched GEMM: none, a bias, an activation or both */
+const auto batched_gemm_output_stages = combine(framework::dataset::make("Bias", { false, true }),
+                                                framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f),
+}));
+
+/** Problems of a single row block (M is below the height of the kernel's block) run by more threads than there are row blocks */
+const auto n_split_gemm_shapes = zip(zip(zip(zip(framework::dataset::make("M", { 1U, 3U, 5U }),
+                                                 framework::dataset::make("N", { 67U, 29U, 40U })),
+                                             framework::dataset::make("K", { 35U, 17U, 64U })),
+                                         framework::dataset::make("NumThreads", { 4U, 8U, 6U })),
+                                     framework::dataset::make("InnerBlockSize", { 8U, 0U, 16U }));
 } // namespace
 
+/** Fixture running an fp32 assembly GEMM forced to GemmMethod::GEMM_INTERLEAVED_BATCHED through its GemmConfig
+ *
+ * The work is split in as many windows as threads, run one after the other so that each thread's working space is used.
+ */
+class NEGEMMInterleavedBatchedFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(unsigned int M, unsigned int N, unsigned int K, unsigned int batches, unsigned int multis, float beta, bool pretranspose, bool has_bias, ActivationLayerInfo act_info)
+    {
+        const float alpha = 0.7f;
+
+        SimpleTensor<float> a{ TensorShape(K, M, batches, multis), DataType::F32 };
+        SimpleTensor<float> b{ TensorShape(N, K, multis), DataType::F32 };
+        SimpleTensor<float> c{ TensorShape(N, M, batches, multis), DataType::F32 };
+        SimpleTensor<float> bias{ TensorShape(N, multis), DataType::F32 };
+        library->fill_tensor_uniform(a, 0);
+        library->fill_tensor_uniform(b, 1);
+        library->fill_tensor_uniform(c, 2);
+        library->fill_tensor_uniform(bias, 3);
+
+        arm_gemm::GemmConfig config;
+        config.method = arm_gemm::GemmMethod::GEMM_INTERLEAVED_BATCHED;
+
+        _target    = compute_target(a, b, c, has_bias ? &bias : nullptr, M, N, K, batches, multis, alpha, beta, pretranspose, act_info, config, 3);
+        _reference = compute_reference(a, b, c, has_bias ? &bias : nullptr, M, N, K, batches, multis, alpha, beta, act_info);
+    }
+
+protected:
+    SimpleTensor<float> compute_target(const SimpleTensor<float> &a, const SimpleTensor<float> &b, const SimpleTensor<float> &c, const SimpleTensor<float> *bias,
+                                       unsigned int M, unsigned int N, unsigned int K, unsigned int batches, unsigned int multis, float alpha, float beta, bool pretranspose,
+                                       const ActivationLayerInfo &act_info, const arm_gemm::GemmConfig &config, unsigned int num_threads)
+    {
+        constexpr size_t alignment = 128;
+
+        auto gemm = arm_gemm::gemm<float, float>(NEScheduler::get().cpu_info(), M, N, K, batches, multis, false, false, alpha, beta, num_threads, pretranspose, &config);
+        ARM_COMPUTE_EXPECT(gemm != nullptr, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(gemm->B_is_pretransposed() == pretranspose, framework::LogLevel::ERRORS);
+
+        // The output is read back when beta isn't 0
+        SimpleTensor<float> dst = c;
+        gemm->set_arrays(a.data(), K, K * M, K * M * batches, b.data(), N, N * K, dst.data(), N, N * M, N * M * batches);
+        if(bias != nullptr || act_info.enabled())
+        {
+            gemm->set_output_stage((bias != nullptr) ? bias->data() : nullptr, N, to_assembly_activation(act_info));
+        }
+
+        std::vector<uint8_t> workspace(gemm->get_working_size() + alignment);
+        void                *workspace_ptr  = workspace.data();
+        size_t               workspace_size = workspace.size();
+        gemm->set_working_space(support::cpp11::align(alignment, gemm->get_working_size(), workspace_ptr, workspace_size));
+
+        std::vector<uint8_t> B_pretransposed(gemm->get_B_pretransposed_array_size() + alignment);
+        if(gemm->B_pretranspose_required())
+        {
+            void  *B_pretransposed_ptr  = B_pretransposed.data();
+            size_t B_pretransposed_size = B_pretransposed.size();
+            gemm->pretranspose_B_array(support::cpp11::align(alignment, gemm->get_B_pretransposed_array_size(), B_pretransposed_ptr, B_pretransposed_size), b.data(), N, N * K);
+        }
+
+        const unsigned int window_size = gemm->get_window_size();
+        for(unsigned int t = 0; t < num_threads; ++t)
+        {
+            gemm->execute((window_size * t) / num_threads, (window_size * (t + 1)) / num_threads, t);
+        }
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const SimpleTensor<float> &a, const SimpleTensor<float> &b, const SimpleTensor<float> &c, const SimpleTensor<float> *bias,
+                                          unsigned int M, unsigned int N, unsigned int K, unsigned int batches, unsigned int multis, float alpha, float beta,
+                                          const ActivationLayerInfo &act_info)
+    {
+        // The batches of a multi share its B, the bias of the multi is added to each row
+        SimpleTensor<float> dst{ c.shape(), DataType::F32 };
+        for(unsigned int multi = 0; multi < multis; ++multi)
+        {
+            for(unsigned int batch = 0; batch < batches; ++batch)
+            {
+                const unsigned int problem = multi * batches + batch;
+                for(unsigned int row = 0; row < M; ++row)
+                {
+                    for(unsigned int col = 0; col < N; ++col)
+                    {
+                        float acc = 0.f;
+                        for(unsigned int k = 0; k < K; ++k)
+                        {
+                            acc += a[(problem * M + row) * K + k] * b[(multi * K + k) * N + col];
+                        }
+                        const unsigned int idx = (problem * M + row) * N + col;
+                        dst[idx]               = alpha * acc + beta * c[idx] + ((bias != nullptr) ? (*bias)[multi * N + col] : 0.f);
+                    }
+                }
+            }
+        }
+
+        return act_info.enabled() ? reference::activation_layer(dst, act_info) : dst;
+    }
+
+    SimpleTensor<float> _target{};
+    SimpleTensor<float> _reference{};
+};
+
+/** Fixture running an fp32 assembly GEMM forced to GemmMethod::GEMM_INTERLEAVED with fewer row blocks than threads
+ *
+ * The columns of the output are then split between the threads as well, each window being run with its own thread ID.
+ */
+class NEGEMMInterleavedNSplitFixture : public NEGEMMInterleavedBatchedFixture
+{
+public:
+    template <typename...>
+    void setup(unsigned int M, unsigned int N, unsigned int K, unsigned int num_threads, unsigned int inner_block_size, float beta, bool pretranspose, bool has_bias, ActivationLayerInfo act_info)
+    {
+        const float alpha = 0.7f;
+
+        SimpleTensor<float> a{ TensorShape(K, M), DataType::F32 };
+        SimpleTensor<float> b{ TensorShape(N, K), DataType::F32 };
+        SimpleTensor<float> c{ TensorShape(N, M), DataType::F32 };
+        SimpleTensor<float> bias{ TensorShape(N), DataType::F32 };
+        library->fill_tensor_uniform(a, 0);
+        library->fill_tensor_uniform(b, 1);
+        library->fill_tensor_uniform(c, 2);
+        library->fill_tensor_uniform(bias, 3);
+
+        arm_gemm::GemmConfig config;
+        config.method           = arm_gemm::GemmMethod::GEMM_INTERLEAVED;
+        config.inner_block_size = inner_block_size;
+
+        _target    = compute_target(a, b, c, has_bias ? &bias : nullptr, M, N, K, 1, 1, alpha, beta, pretranspose, act_info, config, num_threads);
+        _reference = compute_reference(a, b, c, has_bias ? &bias : nullptr, M, N, K, 1, 1, alpha, beta, act_info);
+    }
+};
+
 TEST_SUITE(NEON)
 TEST_SUITE(GEMM)
 
@@ -174,6 +339,8 @@ DATA_TEST_CASE(Configuration, framework::DatasetMode::ALL, combine(framework::da
 
 template <typename T>
 using NEGEMMFixture = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T>;
+template <typename T>
+using NEGEMMBlockSparseFixture = GEMMBlockSparseValidationFixture<Tensor, Accessor, NEGEMM, T>;
 
 TEST_SUITE(Float)
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -203,6 +370,87 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<float>, framework::DatasetMode::N
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f);
 }
+TEST_SUITE(BlockSparse)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMBlockSparseFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallGEMMDataset(), framework::dataset::make("DataType",
+                                                                                                                     DataType::F32)),
+                                                                                                             block_densities))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMBlockSparseFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(datasets::LargeGEMMDataset(), framework::dataset::make("DataType",
+                                                                                                                   DataType::F32)),
+                                                                                                           block_densities))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
+TEST_SUITE_END() // BlockSparse
+
+TEST_SUITE(InterleavedBatched)
+FIXTURE_DATA_TEST_CASE(ForcedThroughConfig, NEGEMMInterleavedBatchedFixture, framework::DatasetMode::PRECOMMIT, combine(combine(combine(batched_gemm_shapes,
+                                                                                                                                        framework::dataset::make("Beta", { 0.f, 0.6f })),
+                                                                                                                                framework::dataset::make("Pretranspose", { false, true })),
+                                                                                                                        batched_gemm_output_stages))
+{
+    // Validate output
+    const IAccessor &target = _target;
+    validate(target, _reference, tolerance_f);
+}
+
+DATA_TEST_CASE(ForcedThroughTuner, framework::DatasetMode::ALL, framework::dataset::make("Pretranspose", { false, true }), pretranspose)
+{
+    constexpr unsigned int M       = 11;
+    constexpr unsigned int N       = 19;
+    constexpr unsigned int K       = 23;
+    constexpr unsigned int batches = 6;
+
+    // The tuner doesn't measure new GEMMs: the configuration in its table is used as is
+    arm_gemm::GemmConfig config;
+    config.method = arm_gemm::GemmMethod::GEMM_INTERLEAVED_BATCHED;
+    NEGEMMTuner tuner(false);
+    tuner.add_config_to_table(NEGEMMTuner::gemm_id("F32", M, N, K, batches, 1U, NEScheduler::get().num_threads(), pretranspose, NEScheduler::get().cpu_info().get_cpu_model()), config);
+    NEScheduler::get().set_gemm_tuner(&tuner);
+
+    Tensor a = create_tensor<Tensor>(TensorShape(K, M, batches), DataType::F32);
+    Tensor b = create_tensor<Tensor>(TensorShape(N, K), DataType::F32);
+    Tensor d = create_tensor<Tensor>(TensorShape(N, M, batches), DataType::F32);
+
+    NEGEMM gemm;
+    gemm.configure(&a, &b, nullptr, &d, 1.f, 0.f, GEMMInfo(false, false, pretranspose));
+    NEScheduler::get().set_gemm_tuner(nullptr);
+    ARM_COMPUTE_EXPECT(tuner.config_table().size() == 1, framework::LogLevel::ERRORS);
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    d.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b), 1);
+    gemm.run();
+
+    SimpleTensor<float> ref_a{ a.info()->tensor_shape(), DataType::F32 };
+    SimpleTensor<float> ref_b{ b.info()->tensor_shape(), DataType::F32 };
+    SimpleTensor<float> ref_c{ d.info()->tensor_shape(), DataType::F32 };
+    library->fill_tensor_uniform(ref_a, 0);
+    library->fill_tensor_uniform(ref_b, 1);
+    library->fill_tensor_value(ref_c, 0.f);
+
+    // Validate output
+    validate(Accessor(d), reference::gemm(ref_a, ref_b, ref_c, 1.f, 0.f), tolerance_f);
+}
+TEST_SUITE_END() // InterleavedBatched
+
+TEST_SUITE(InterleavedNSplit)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMInterleavedNSplitFixture, framework::DatasetMode::PRECOMMIT, combine(combine(combine(n_split_gemm_shapes,
+                                                                                                                            framework::dataset::make("Beta", { 0.f, 0.6f })),
+                                                                                                                    framework::dataset::make("Pretranspose", { false, true })),
+                                                                                                            batched_gemm_output_stages))
+{
+    // Validate output
+    const IAccessor &target = _target;
+    validate(target, _reference, tolerance_f);
+}
+TEST_SUITE_END() // InterleavedNSplit
 TEST_SUITE_END()
 TEST_SUITE_END()
 
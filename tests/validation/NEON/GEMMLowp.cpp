@@ -143,6 +143,26 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMLowpMatrixMultiplyCoreFixture, framework:
     validate(Accessor(_target), _reference);
 }
 
+TEST_SUITE(Requantized)
+using NEGEMMLowpMatrixMultiplyCoreRequantizedFixture = GEMMLowpMatrixMultiplyCoreRequantizedValidationFixture<Tensor, Accessor, NEGEMMLowpMatrixMultiplyCore>;
+
+const auto requantized_cases = framework::dataset::make("result_fixedpoint_multiplier", { 1073741824, 1717986918 }) * framework::dataset::make("result_shift", 10)
+                               * framework::dataset::make("result_offset_after_shift", { 2, 130 }) * zip(framework::dataset::make("min", { 0, 13 }), framework::dataset::make("max", { 0, 180 }))
+                               * framework::dataset::make("addBias", { false, true });
+
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMLowpMatrixMultiplyCoreRequantizedFixture, framework::DatasetMode::ALL, combine(datasets::SmallGEMMLowpDataset(), requantized_cases))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+
+FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMLowpMatrixMultiplyCoreRequantizedFixture, framework::DatasetMode::NIGHTLY, combine(datasets::LargeGEMMLowpDataset(), requantized_cases))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+TEST_SUITE_END() // Requantized
+
 TEST_SUITE_END() // MatrixMultiplyCore
 
 TEST_SUITE(OutputStage)
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/mutators/GraphMutators.h"
+#include "support/ToolchainSupport.h"
+#include "tests/GraphAccessors.h"
+#include "tests/SimpleTensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+
+namespace
+{
+constexpr unsigned int num_runs = 2;
+
+/** Tolerance for the difference between the folded and unfolded batch normalization */
+const RelativeTolerance<float> tolerance_f32(0.001f);
+constexpr float                abs_tolerance_f32(0.0001f);
+
+/** Adds a convolution or a depthwise convolution followed by a batch normalization to a graph
+ *
+ * @param[in, out] g         Graph to add the nodes to
+ * @param[in]      depthwise True to add a depthwise convolution
+ * @param[in]      has_bias  True if the convolution has a bias
+ *
+ * @return ID of the batch normalization node
+ */
+NodeID add_conv_batch_norm(Graph &g, bool depthwise, bool has_bias)
+{
+    const NodeParams params = { "", Target::NEON };
+
+    const NodeID input = GraphBuilder::add_input_node(g, params, TensorDescriptor(TensorShape(10U, 10U, 4U), DataType::F32), support::cpp14::make_unique<UniformGraphAccessor>(0));
+
+    ITensorAccessorUPtr bias_accessor = has_bias ? support::cpp14::make_unique<UniformGraphAccessor>(200) : nullptr;
+    const NodeID        conv          = depthwise ? GraphBuilder::add_depthwise_convolution_node(g, params, { input, 0 }, Size2D(3U, 3U), PadStrideInfo(1, 1, 1, 1), DepthwiseConvolutionMethod::DEFAULT,
+                                                                                                 support::cpp14::make_unique<UniformGraphAccessor>(100), std::move(bias_accessor)) :
+                                        GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(3U, 3U), 6U, PadStrideInfo(1, 1, 1, 1), 1, graph::ConvolutionMethod::DEFAULT, FastMathHint::DISABLED,
+                                                                           support::cpp14::make_unique<UniformGraphAccessor>(100), std::move(bias_accessor));
+
+    // The variance must be positive
+    return GraphBuilder::add_batch_normalization_node(g, params, { conv, 0 }, 0.001f,
+                                                      support::cpp14::make_unique<UniformGraphAccessor>(300),
+                                                      support::cpp14::make_unique<UniformGraphAccessor>(400, 0.5f, 2.f),
+                                                      support::cpp14::make_unique<UniformGraphAccessor>(500),
+                                                      support::cpp14::make_unique<UniformGraphAccessor>(600));
+}
+
+/** Counts the batch normalization nodes of a graph */
+size_t num_batch_norm_nodes(const Graph &g)
+{
+    return std::count_if(g.nodes().begin(), g.nodes().end(), [](const std::unique_ptr<INode> &node)
+    {
+        return node != nullptr && node->type() == NodeType::BatchNormalizationLayer;
+    });
+}
+
+/** Finalizes and runs a convolution followed by a batch normalization, the output of the batch normalization being the output of the graph
+ *
+ * @param[in] depthwise True to use a depthwise convolution
+ * @param[in] has_bias  True if the convolution has a bias
+ * @param[in] fold      True to fold the batch normalization into the convolution
+ *
+ * @return Outputs of the consecutive runs, starting with the first run made by the finalization
+ */
+std::vector<SimpleTensor<float>> run_conv_batch_norm_graph(bool depthwise, bool has_bias, bool fold)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    Graph        g(0, "ConvBatchNorm");
+    const NodeID bn = add_conv_batch_norm(g, depthwise, has_bias);
+    GraphBuilder::add_output_node(g, { "", Target::NEON }, { bn, 0 }, support::cpp14::make_unique<SimpleTensorGraphAccessor>(outputs));
+
+    // Same passes as the default pass manager, with or without the folding
+    PassManager pm;
+    if(fold)
+    {
+        pm.append(support::cpp14::make_unique<BatchNormalizationFoldingMutator>());
+    }
+    pm.append(support::cpp14::make_unique<DataLayoutMutator>());
+    pm.append(support::cpp14::make_unique<InPlaceOperationMutator>());
+    pm.append(support::cpp14::make_unique<NodeFusionMutator>());
+    pm.append(support::cpp14::make_unique<SplitLayerSubTensorMutator>());
+    pm.append(support::cpp14::make_unique<DepthConcatSubTensorMutator>());
+
+    GraphContext ctx;
+    ctx.set_config(GraphConfig());
+    GraphManager manager;
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+    ARM_COMPUTE_EXPECT_EQUAL(num_batch_norm_nodes(g), fold ? 0U : 1U, framework::LogLevel::ERRORS);
+
+    for(unsigned int i = 0; i < num_runs; ++i)
+    {
+        manager.execute_graph(g);
+    }
+
+    return outputs;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(BatchNormalizationFolding)
+
+DATA_TEST_CASE(FoldedIntoConvolution, framework::DatasetMode::ALL, combine(framework::dataset::make("Depthwise", { false, true }), framework::dataset::make("HasBias", { false, true })),
+               depthwise, has_bias)
+{
+    const std::vector<SimpleTensor<float>> reference = run_conv_batch_norm_graph(depthwise, has_bias, false);
+    const std::vector<SimpleTensor<float>> outputs   = run_conv_batch_norm_graph(depthwise, has_bias, true);
+
+    // The finalization makes a first run
+    ARM_COMPUTE_ASSERT(reference.size() == num_runs + 1);
+    ARM_COMPUTE_ASSERT(outputs.size() == reference.size());
+    for(unsigned int i = 0; i < outputs.size(); ++i)
+    {
+        const IAccessor &output = outputs[i];
+        validate(output, reference[i], tolerance_f32, 0.f, abs_tolerance_f32);
+    }
+}
+
+TEST_CASE(ChannelsMismatch, framework::DatasetMode::ALL)
+{
+    Graph        g(0, "ChannelsMismatch");
+    const NodeID bn = add_conv_batch_norm(g, false, true);
+
+    // Batch normalization parameters not matching the output channels of the convolution are left alone
+    INode *bn_node = g.node(bn);
+    bn_node->input(1)->desc().shape = TensorShape(7U);
+
+    INode           *conv_node        = bn_node->input_edge(0)->producer();
+    ITensorAccessor *weights_accessor = conv_node->input(1)->accessor();
+    ITensorAccessor *bias_accessor    = conv_node->input(2)->accessor();
+
+    BatchNormalizationFoldingMutator mutator;
+    mutator.mutate(g);
+
+    ARM_COMPUTE_EXPECT(g.node(bn) == bn_node, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(num_batch_norm_nodes(g), 1U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bn_node->input_edge(0)->producer() == conv_node, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(conv_node->input(1)->accessor() == weights_accessor, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(conv_node->input(2)->accessor() == bias_accessor, framework::LogLevel::ERRORS);
+    for(size_t i = 1; i < bn_node->num_inputs(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(bn_node->input(i) != nullptr && bn_node->input(i)->accessor() != nullptr, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // BatchNormalizationFolding
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
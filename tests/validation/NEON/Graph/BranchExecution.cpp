@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "tests/GraphAccessors.h"
+#include "tests/SimpleTensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+
+namespace
+{
+constexpr unsigned int num_runs = 3;
+
+/** Builds a graph with two independent branches, concatenated across depth, and runs it
+ *
+ * @param[in] config Graph configuration to finalize the graph with.
+ *
+ * @return Outputs of the consecutive runs, starting with the first run made by the finalization
+ */
+std::vector<SimpleTensor<float>> run_two_branch_graph(const GraphConfig &config)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    Stream graph(0, "TwoBranches");
+    graph << Target::NEON
+          << InputLayer(TensorDescriptor(TensorShape(12U, 12U, 4U), DataType::F32), support::cpp14::make_unique<UniformGraphAccessor>(0));
+
+    SubStream branch_a(graph);
+    branch_a << ConvolutionLayer(3U, 3U, 8U, support::cpp14::make_unique<UniformGraphAccessor>(100), support::cpp14::make_unique<UniformGraphAccessor>(200), PadStrideInfo(1, 1, 1, 1))
+             << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+
+    SubStream branch_b(graph);
+    branch_b << ConvolutionLayer(1U, 1U, 4U, support::cpp14::make_unique<UniformGraphAccessor>(300), support::cpp14::make_unique<UniformGraphAccessor>(400), PadStrideInfo(1, 1, 0, 0))
+             << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 3, PadStrideInfo(1, 1, 1, 1)));
+
+    graph << BranchLayer(BranchMergeMethod::DEPTH_CONCATENATE, std::move(branch_a), std::move(branch_b))
+          << OutputLayer(support::cpp14::make_unique<SimpleTensorGraphAccessor>(outputs));
+
+    graph.finalize(Target::NEON, config);
+    for(unsigned int i = 0; i < num_runs; ++i)
+    {
+        graph.run();
+    }
+
+    return outputs;
+}
+
+/** Builds a graph with two independent Winograd convolutions, added together, and runs it
+ *
+ * The Winograd convolutions run a GEMM which doesn't pretranspose its B matrix: its threads wait for each other,
+ * so it deadlocks if it runs with fewer threads than it was configured for.
+ *
+ * @param[in] config Graph configuration to finalize the graph with.
+ *
+ * @return Outputs of the consecutive runs, starting with the first run made by the finalization
+ */
+std::vector<SimpleTensor<float>> run_two_winograd_branch_graph(const GraphConfig &config)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    Stream graph(0, "TwoWinogradBranches");
+    graph << Target::NEON
+          << InputLayer(TensorDescriptor(TensorShape(16U, 16U, 8U), DataType::F32), support::cpp14::make_unique<UniformGraphAccessor>(0));
+
+    SubStream branch_a(graph);
+    branch_a << graph::ConvolutionMethod::WINOGRAD
+             << ConvolutionLayer(3U, 3U, 16U, support::cpp14::make_unique<UniformGraphAccessor>(100), support::cpp14::make_unique<UniformGraphAccessor>(200), PadStrideInfo(1, 1, 1, 1));
+
+    SubStream branch_b(graph);
+    branch_b << graph::ConvolutionMethod::WINOGRAD
+             << ConvolutionLayer(3U, 3U, 16U, support::cpp14::make_unique<UniformGraphAccessor>(300), support::cpp14::make_unique<UniformGraphAccessor>(400), PadStrideInfo(1, 1, 1, 1));
+
+    graph << BranchLayer(BranchMergeMethod::ADD, std::move(branch_a), std::move(branch_b))
+          << OutputLayer(support::cpp14::make_unique<SimpleTensorGraphAccessor>(outputs));
+
+    graph.finalize(Target::NEON, config);
+    for(unsigned int i = 0; i < num_runs; ++i)
+    {
+        graph.run();
+    }
+
+    return outputs;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(BranchExecution)
+
+TEST_CASE(TwoIndependentBranches, framework::DatasetMode::ALL)
+{
+    GraphConfig sequential_config;
+    sequential_config.num_threads = 2;
+    const std::vector<SimpleTensor<float>> reference = run_two_branch_graph(sequential_config);
+
+    GraphConfig concurrent_config;
+    concurrent_config.num_threads             = 2;
+    concurrent_config.max_concurrent_branches = 2;
+    const std::vector<SimpleTensor<float>> outputs = run_two_branch_graph(concurrent_config);
+
+    // The finalization makes a first run
+    ARM_COMPUTE_ASSERT(reference.size() == num_runs + 1);
+    ARM_COMPUTE_ASSERT(outputs.size() == reference.size());
+    for(unsigned int i = 0; i < outputs.size(); ++i)
+    {
+        const IAccessor &output = outputs[i];
+        validate(output, reference[i]);
+    }
+}
+
+TEST_CASE(BranchesRunWithTheThreadsTheyAreConfiguredFor, framework::DatasetMode::ALL)
+{
+    GraphConfig sequential_config;
+    sequential_config.num_threads = 4;
+    const std::vector<SimpleTensor<float>> reference = run_two_winograd_branch_graph(sequential_config);
+
+    // Each branch runs on two threads: its nodes must not be configured for the four threads of the graph
+    GraphConfig concurrent_config;
+    concurrent_config.num_threads             = 4;
+    concurrent_config.max_concurrent_branches = 2;
+    const std::vector<SimpleTensor<float>> outputs = run_two_winograd_branch_graph(concurrent_config);
+
+    ARM_COMPUTE_ASSERT(reference.size() == num_runs + 1);
+    ARM_COMPUTE_ASSERT(outputs.size() == reference.size());
+    for(unsigned int i = 0; i < outputs.size(); ++i)
+    {
+        const IAccessor &output = outputs[i];
+        validate(output, reference[i]);
+    }
+}
+
+TEST_SUITE_END() // BranchExecution
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/mutators/GraphMutators.h"
+#include "support/ToolchainSupport.h"
+#include "tests/GraphAccessors.h"
+#include "tests/SimpleTensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <array>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+
+namespace
+{
+constexpr unsigned int num_runs    = 2;
+constexpr size_t       num_outputs = 3;
+
+/** Finalizes and runs an NCHW graph with two branches reading the graph input
+ *
+ * The first branch is a 1x1 convolution, a 3x3 depthwise convolution, whose output is also a graph output, and a pooling layer.
+ * The second branch is a 3x3 depthwise convolution.
+ *
+ * @param[in] switch_layout True to run the DataLayoutMutator
+ *
+ * @return Outputs of the consecutive runs of each graph output, starting with the first run made by the finalization
+ */
+std::array<std::vector<SimpleTensor<float>>, num_outputs> run_two_branch_graph(bool switch_layout)
+{
+    std::array<std::vector<SimpleTensor<float>>, num_outputs> outputs;
+
+    const NodeParams params = { "", Target::NEON };
+
+    Graph        g(0, "DataLayout");
+    const NodeID input = GraphBuilder::add_input_node(g, params, TensorDescriptor(TensorShape(12U, 12U, 8U), DataType::F32), support::cpp14::make_unique<UniformGraphAccessor>(0));
+
+    const NodeID conv = GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(1U, 1U), 8U, PadStrideInfo(1, 1, 0, 0), 1, graph::ConvolutionMethod::DEFAULT, FastMathHint::DISABLED,
+                                                           support::cpp14::make_unique<UniformGraphAccessor>(100), support::cpp14::make_unique<UniformGraphAccessor>(200));
+    const NodeID dwc0 = GraphBuilder::add_depthwise_convolution_node(g, params, { conv, 0 }, Size2D(3U, 3U), PadStrideInfo(1, 1, 1, 1), DepthwiseConvolutionMethod::DEFAULT,
+                                                                     support::cpp14::make_unique<UniformGraphAccessor>(300), support::cpp14::make_unique<UniformGraphAccessor>(400));
+    const NodeID pool = GraphBuilder::add_pooling_node(g, params, { dwc0, 0 }, PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)));
+    GraphBuilder::add_output_node(g, params, { pool, 0 }, support::cpp14::make_unique<SimpleTensorGraphAccessor>(outputs[0]));
+    GraphBuilder::add_output_node(g, params, { dwc0, 0 }, support::cpp14::make_unique<SimpleTensorGraphAccessor>(outputs[1]));
+
+    const NodeID dwc1 = GraphBuilder::add_depthwise_convolution_node(g, params, { input, 0 }, Size2D(3U, 3U), PadStrideInfo(2, 2, 1, 1), DepthwiseConvolutionMethod::DEFAULT,
+                                                                     support::cpp14::make_unique<UniformGraphAccessor>(500), support::cpp14::make_unique<UniformGraphAccessor>(600));
+    GraphBuilder::add_output_node(g, params, { dwc1, 0 }, support::cpp14::make_unique<SimpleTensorGraphAccessor>(outputs[2]));
+
+    // Same passes as the default pass manager, with or without the switch to NHWC
+    PassManager pm;
+    pm.append(support::cpp14::make_unique<BatchNormalizationFoldingMutator>());
+    if(switch_layout)
+    {
+        pm.append(support::cpp14::make_unique<DataLayoutMutator>());
+    }
+    pm.append(support::cpp14::make_unique<InPlaceOperationMutator>());
+    pm.append(support::cpp14::make_unique<NodeFusionMutator>());
+    pm.append(support::cpp14::make_unique<SplitLayerSubTensorMutator>());
+    pm.append(support::cpp14::make_unique<DepthConcatSubTensorMutator>());
+
+    GraphContext ctx;
+    ctx.set_config(GraphConfig());
+    GraphManager manager;
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+
+    if(switch_layout)
+    {
+        // Both branches run in NHWC and share the permutation of the graph input
+        ARM_COMPUTE_EXPECT(g.node(conv)->output(0)->desc().layout == DataLayout::NHWC, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(g.node(dwc1)->output(0)->desc().layout == DataLayout::NHWC, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT_EQUAL(g.node(input)->output_edges().size(), 1U, framework::LogLevel::ERRORS);
+
+        // The graph outputs are permuted back to NCHW
+        for(auto &node : g.nodes())
+        {
+            if(node != nullptr && node->type() == NodeType::Output)
+            {
+                ARM_COMPUTE_EXPECT(node->input(0)->desc().layout == DataLayout::NCHW, framework::LogLevel::ERRORS);
+                ARM_COMPUTE_EXPECT(node->input_edge(0)->producer()->type() == NodeType::PermuteLayer, framework::LogLevel::ERRORS);
+            }
+        }
+    }
+
+    for(unsigned int i = 0; i < num_runs; ++i)
+    {
+        manager.execute_graph(g);
+    }
+
+    return outputs;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(DataLayoutMutator)
+
+TEST_CASE(SwitchToNHWC, framework::DatasetMode::ALL)
+{
+    const std::array<std::vector<SimpleTensor<float>>, num_outputs> reference = run_two_branch_graph(false);
+    const std::array<std::vector<SimpleTensor<float>>, num_outputs> outputs   = run_two_branch_graph(true);
+
+    // The finalization makes a first run
+    for(size_t o = 0; o < num_outputs; ++o)
+    {
+        ARM_COMPUTE_ASSERT(reference[o].size() == num_runs + 1);
+        ARM_COMPUTE_ASSERT(outputs[o].size() == reference[o].size());
+        for(unsigned int i = 0; i < outputs[o].size(); ++i)
+        {
+            ARM_COMPUTE_EXPECT(outputs[o][i].data_layout() == DataLayout::NCHW, framework::LogLevel::ERRORS);
+            const IAccessor &output = outputs[o][i];
+            validate(output, reference[o][i]);
+        }
+    }
+}
+
+TEST_SUITE_END() // DataLayoutMutator
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
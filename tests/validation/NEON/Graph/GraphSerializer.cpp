@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/graph.h"
+#include "arm_compute/runtime/Memory.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+#include "tests/GraphAccessors.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::utils::cast;
+
+namespace
+{
+/** Builds a graph with a convolution, a batch normalization, two pooling layers, a depth concatenation, a permutation and a fully connected layer
+ *
+ * The constants are filled by seeded accessors: two graphs built by this function hold the same data.
+ *
+ * @param[in, out] g Graph to add the nodes to
+ */
+void build_graph(Graph &g)
+{
+    const NodeID input = GraphBuilder::add_input_node(g, { "input", Target::NEON }, TensorDescriptor(TensorShape(8U, 8U, 3U), DataType::F32));
+    const NodeID conv  = GraphBuilder::add_convolution_node(g, { "conv", Target::NEON }, { input, 0 }, Size2D(3U, 3U), 4U, PadStrideInfo(1, 1, 1, 1), 1, graph::ConvolutionMethod::GEMM,
+                                                            FastMathHint::DISABLED, support::cpp14::make_unique<UniformGraphAccessor>(100), support::cpp14::make_unique<UniformGraphAccessor>(200));
+    polymorphic_downcast<ConvolutionLayerNode *>(g.node(conv))->set_fused_activation(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f));
+
+    const NodeID bn = GraphBuilder::add_batch_normalization_node(g, { "bn", Target::NEON }, { conv, 0 }, 0.001f,
+                                                                 support::cpp14::make_unique<UniformGraphAccessor>(300),
+                                                                 support::cpp14::make_unique<UniformGraphAccessor>(400, 0.5f, 2.f),
+                                                                 support::cpp14::make_unique<UniformGraphAccessor>(500),
+                                                                 support::cpp14::make_unique<UniformGraphAccessor>(600));
+
+    const NodeID max_pool = GraphBuilder::add_pooling_node(g, { "max_pool", Target::NEON }, { bn, 0 }, PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)));
+    const NodeID avg_pool = GraphBuilder::add_pooling_node(g, { "avg_pool", Target::NEON }, { bn, 0 },
+                                                           PoolingLayerInfo(PoolingType::AVG, Size2D(3U, 3U), PadStrideInfo(2, 2, 1, 1, DimensionRoundingType::FLOOR), true));
+    const NodeID concat = GraphBuilder::add_depth_concatenate_node(g, { "concat", Target::NEON }, { { max_pool, 0 }, { avg_pool, 0 } });
+
+    const NodeID permute = g.add_node<PermuteLayerNode>(PermutationVector(2U, 0U, 1U), DataLayout::NHWC);
+    g.node(permute)->set_common_node_parameters({ "permute", Target::NEON });
+    g.add_connection(concat, 0, permute, 0);
+
+    const NodeID fc = GraphBuilder::add_fully_connected_layer(g, { "fc", Target::NEON }, { permute, 0 }, 10U,
+                                                              support::cpp14::make_unique<UniformGraphAccessor>(700), support::cpp14::make_unique<UniformGraphAccessor>(800));
+    GraphBuilder::add_output_node(g, { "output", Target::NEON }, { fc, 0 });
+}
+
+bool descriptors_equal(const TensorDescriptor &a, const TensorDescriptor &b)
+{
+    return a.shape == b.shape && a.data_type == b.data_type && a.layout == b.layout && a.quant_info.scale == b.quant_info.scale && a.quant_info.offset == b.quant_info.offset;
+}
+
+bool pad_stride_infos_equal(const PadStrideInfo &a, const PadStrideInfo &b)
+{
+    return a.stride() == b.stride() && a.pad_left() == b.pad_left() && a.pad_right() == b.pad_right() && a.pad_top() == b.pad_top() && a.pad_bottom() == b.pad_bottom() && a.round() == b.round();
+}
+
+bool activation_infos_equal(const ActivationLayerInfo &a, const ActivationLayerInfo &b)
+{
+    return a.enabled() == b.enabled() && (!a.enabled() || (a.activation() == b.activation() && a.a() == b.a() && a.b() == b.b()));
+}
+
+/** Checks if the type specific parameters of two nodes of the same type match */
+bool parameters_equal(INode &a, INode &b)
+{
+    switch(a.type())
+    {
+        case NodeType::BatchNormalizationLayer:
+        {
+            auto *bn_a = polymorphic_downcast<BatchNormalizationLayerNode *>(&a);
+            auto *bn_b = polymorphic_downcast<BatchNormalizationLayerNode *>(&b);
+            return bn_a->epsilon() == bn_b->epsilon() && activation_infos_equal(bn_a->fused_activation(), bn_b->fused_activation());
+        }
+        case NodeType::ConvolutionLayer:
+        {
+            auto *conv_a = polymorphic_downcast<ConvolutionLayerNode *>(&a);
+            auto *conv_b = polymorphic_downcast<ConvolutionLayerNode *>(&b);
+            return pad_stride_infos_equal(conv_a->convolution_info(), conv_b->convolution_info()) && conv_a->num_groups() == conv_b->num_groups()
+                   && conv_a->convolution_method() == conv_b->convolution_method() && conv_a->fast_math_hint() == conv_b->fast_math_hint()
+                   && activation_infos_equal(conv_a->fused_activation(), conv_b->fused_activation());
+        }
+        case NodeType::FullyConnectedLayer:
+            return activation_infos_equal(polymorphic_downcast<FullyConnectedLayerNode *>(&a)->fused_activation(), polymorphic_downcast<FullyConnectedLayerNode *>(&b)->fused_activation());
+        case NodeType::PermuteLayer:
+        {
+            const PermutationVector &perm_a = polymorphic_downcast<PermuteLayerNode *>(&a)->permutation_vector();
+            const PermutationVector &perm_b = polymorphic_downcast<PermuteLayerNode *>(&b)->permutation_vector();
+            return perm_a == perm_b;
+        }
+        case NodeType::PoolingLayer:
+        {
+            const PoolingLayerInfo info_a = polymorphic_downcast<PoolingLayerNode *>(&a)->pooling_info();
+            const PoolingLayerInfo info_b = polymorphic_downcast<PoolingLayerNode *>(&b)->pooling_info();
+            return info_a.pool_type() == info_b.pool_type() && info_a.is_global_pooling() == info_b.is_global_pooling() && info_a.pool_size().width == info_b.pool_size().width
+                   && info_a.pool_size().height == info_b.pool_size().height && pad_stride_infos_equal(info_a.pad_stride_info(), info_b.pad_stride_info())
+                   && info_a.exclude_padding() == info_b.exclude_padding();
+        }
+        default:
+            return true;
+    }
+}
+
+/** Checks if two nodes have the same type, name, connections, output descriptors and parameters */
+bool nodes_equal(INode &a, INode &b)
+{
+    if(a.type() != b.type() || a.name() != b.name() || a.num_inputs() != b.num_inputs() || a.num_outputs() != b.num_outputs())
+    {
+        return false;
+    }
+    for(size_t idx = 0; idx < a.num_inputs(); ++idx)
+    {
+        const Edge *edge_a = a.input_edge(idx);
+        const Edge *edge_b = b.input_edge(idx);
+        if((edge_a == nullptr) != (edge_b == nullptr)
+           || (edge_a != nullptr && (edge_a->producer_id() != edge_b->producer_id() || edge_a->producer_idx() != edge_b->producer_idx())))
+        {
+            return false;
+        }
+    }
+    for(size_t idx = 0; idx < a.num_outputs(); ++idx)
+    {
+        if(!descriptors_equal(a.output(idx)->desc(), b.output(idx)->desc()))
+        {
+            return false;
+        }
+    }
+    return parameters_equal(a, b);
+}
+
+/** Checks if the elements of a tensor match densely packed data */
+bool tensor_equals_data(const ITensor &tensor, const std::vector<uint8_t> &data)
+{
+    const TensorShape &shape        = tensor.info()->tensor_shape();
+    const size_t       element_size = tensor.info()->element_size();
+    for(size_t element_idx = 0; element_idx < shape.total_size(); ++element_idx)
+    {
+        if(std::memcmp(tensor.ptr_to_element(index2coord(shape, element_idx)), data.data() + element_idx * element_size, element_size) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Checks if deserializing a file throws once 4 bytes are rewritten
+ *
+ * @param[in] file   Content of a graph file
+ * @param[in] offset Offset of the bytes to rewrite
+ * @param[in] value  Value to write
+ *
+ * @return True if the deserialization threw an error
+ */
+bool deserialize_throws(std::vector<char> file, size_t offset, uint32_t value)
+{
+    const std::string filename = "acl_graph_corrupted_test.bin";
+    std::memcpy(file.data() + offset, &value, sizeof(value));
+    std::ofstream(filename, std::ios::out | std::ios::binary).write(file.data(), file.size());
+
+    bool thrown = false;
+    try
+    {
+        Graph g(0, "Corrupted");
+        GraphSerializer::deserialize(g, filename, Target::NEON);
+    }
+    catch(const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    std::remove(filename.c_str());
+    return thrown;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(GraphSerializer)
+
+TEST_CASE(RoundTrip, framework::DatasetMode::ALL)
+{
+    const std::string filename = "acl_graph_test.bin";
+
+    Graph g(0, "Serialized");
+    build_graph(g);
+    GraphSerializer::serialize(g, filename);
+
+    Graph deserialized(1, "Deserialized");
+    GraphSerializer::deserialize(deserialized, filename, Target::NEON);
+    std::remove(filename.c_str());
+
+    // The accessors of the serialized graph have been called: read the expected data from a new graph
+    Graph expected(2, "Expected");
+    build_graph(expected);
+
+    ARM_COMPUTE_ASSERT(deserialized.nodes().size() == expected.nodes().size());
+    for(size_t nid = 0; nid < expected.nodes().size(); ++nid)
+    {
+        INode *node = expected.node(nid);
+        ARM_COMPUTE_ASSERT(node != nullptr && deserialized.node(nid) != nullptr);
+        ARM_COMPUTE_EXPECT(nodes_equal(*node, *deserialized.node(nid)), framework::LogLevel::ERRORS);
+
+        if(node->type() != NodeType::Const)
+        {
+            continue;
+        }
+
+        const TensorDescriptor &desc = node->output(0)->desc();
+        TensorInfo              info(desc.shape, 1, desc.data_type);
+        info.set_data_layout(desc.layout);
+
+        arm_compute::Tensor expected_tensor;
+        expected_tensor.allocator()->init(info);
+        expected_tensor.allocator()->allocate();
+        node->output(0)->accessor()->access_tensor(expected_tensor);
+        const std::vector<uint8_t> data(expected_tensor.buffer(), expected_tensor.buffer() + info.total_size());
+
+        ITensorAccessor *accessor = deserialized.node(nid)->output(0)->accessor();
+        ARM_COMPUTE_ASSERT(accessor != nullptr);
+
+        // Tensors without padding are backed by the mapping of the file
+        std::shared_ptr<IMemoryRegion> memory = accessor->importable_memory(info);
+        ARM_COMPUTE_ASSERT(memory != nullptr);
+        arm_compute::Tensor imported;
+        imported.allocator()->init(info);
+        ARM_COMPUTE_ASSERT(bool(imported.allocator()->import_memory(Memory(memory))));
+        ARM_COMPUTE_EXPECT(accessor->access_tensor(imported), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(imported.buffer() == memory->buffer(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(tensor_equals_data(imported, data), framework::LogLevel::ERRORS);
+
+        // The data is copied to padded tensors
+        TensorInfo padded_info(info);
+        padded_info.extend_padding(PaddingSize(1, 2, 1, 2));
+        ARM_COMPUTE_EXPECT(accessor->importable_memory(padded_info) == nullptr, framework::LogLevel::ERRORS);
+        arm_compute::Tensor padded;
+        padded.allocator()->init(padded_info);
+        padded.allocator()->allocate();
+        ARM_COMPUTE_EXPECT(accessor->access_tensor(padded), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(tensor_equals_data(padded, data), framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(CorruptedFile, framework::DatasetMode::ALL)
+{
+    const std::string filename = "acl_graph_test.bin";
+
+    Graph        g(0, "Serialized");
+    const NodeID input = GraphBuilder::add_input_node(g, { "input", Target::NEON }, TensorDescriptor(TensorShape(4U), DataType::F32));
+    GraphBuilder::add_output_node(g, { "graph_output", Target::NEON }, { input, 0 });
+    GraphSerializer::serialize(g, filename);
+
+    std::ifstream           fs(filename, std::ios::in | std::ios::binary);
+    const std::vector<char> file((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+    fs.close();
+    std::remove(filename.c_str());
+
+    // The record of the output node is its type, its name, its number of inputs, the index of its producer and the output index of the producer
+    const std::string name        = "graph_output";
+    const size_t      name_offset = std::distance(file.begin(), std::search(file.begin(), file.end(), name.begin(), name.end()));
+    ARM_COMPUTE_ASSERT(name_offset < file.size());
+    const size_t type_offset  = name_offset - 2 * sizeof(uint32_t);
+    const size_t index_offset = name_offset + name.size() + 2 * sizeof(uint32_t);
+
+    // Unmodified version, type and input index
+    uint32_t version = 0;
+    uint32_t type    = 0;
+    std::memcpy(&version, file.data() + 8, sizeof(version));
+    std::memcpy(&type, file.data() + type_offset, sizeof(type));
+    ARM_COMPUTE_EXPECT(!deserialize_throws(file, 8, version), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!deserialize_throws(file, type_offset, type), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!deserialize_throws(file, index_offset, 0), framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT(deserialize_throws(file, 8, version + 1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(deserialize_throws(file, type_offset, 1000), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(deserialize_throws(file, index_offset, 1), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // GraphSerializer
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
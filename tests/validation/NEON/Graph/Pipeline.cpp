@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "tests/GraphAccessors.h"
+#include "tests/SimpleTensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+
+namespace
+{
+constexpr unsigned int num_requests = 6;
+
+/** Builds a chain of layers and runs it on consecutive requests
+ *
+ * @param[in] config   Graph configuration to finalize the graph with.
+ * @param[in] num_runs (Optional) Number of runs of @ref num_requests requests.
+ *
+ * @return Outputs of the requests, starting with the first run made by the finalization
+ */
+std::vector<SimpleTensor<float>> run_chain_graph(const GraphConfig &config, unsigned int num_runs = 1)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    Stream graph(0, "Chain");
+    graph << Target::NEON
+          << InputLayer(TensorDescriptor(TensorShape(16U, 16U, 3U), DataType::F32), support::cpp14::make_unique<UniformGraphAccessor>(0))
+          << ConvolutionLayer(3U, 3U, 8U, support::cpp14::make_unique<UniformGraphAccessor>(100), support::cpp14::make_unique<UniformGraphAccessor>(200), PadStrideInfo(1, 1, 1, 1))
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+          << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 2, PadStrideInfo(2, 2, 0, 0)))
+          << ConvolutionLayer(3U, 3U, 8U, support::cpp14::make_unique<UniformGraphAccessor>(300), support::cpp14::make_unique<UniformGraphAccessor>(400), PadStrideInfo(1, 1, 1, 1))
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 1.f))
+          << FullyConnectedLayer(10U, support::cpp14::make_unique<UniformGraphAccessor>(500), support::cpp14::make_unique<UniformGraphAccessor>(600))
+          << SoftmaxLayer()
+          << OutputLayer(support::cpp14::make_unique<SimpleTensorGraphAccessor>(outputs));
+
+    graph.finalize(Target::NEON, config);
+    for(unsigned int i = 0; i < num_runs; ++i)
+    {
+        graph.run(num_requests);
+    }
+
+    // The occupancy is only reported for pipelined graphs
+    const size_t expected_num_stages = (config.num_pipeline_stages > 1) ? config.num_pipeline_stages : 0;
+    ARM_COMPUTE_EXPECT(graph.pipeline_stage_occupancy().size() == expected_num_stages, framework::LogLevel::ERRORS);
+
+    return outputs;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(Pipeline)
+
+TEST_CASE(TwoStages, framework::DatasetMode::ALL)
+{
+    GraphConfig sequential_config;
+    sequential_config.num_threads = 2;
+    const std::vector<SimpleTensor<float>> reference = run_chain_graph(sequential_config);
+
+    GraphConfig pipelined_config;
+    pipelined_config.num_threads         = 2;
+    pipelined_config.num_pipeline_stages = 2;
+    const std::vector<SimpleTensor<float>> outputs = run_chain_graph(pipelined_config);
+
+    // The outputs of the overlapping requests must be delivered in order
+    ARM_COMPUTE_ASSERT(reference.size() == num_requests + 1);
+    ARM_COMPUTE_ASSERT(outputs.size() == reference.size());
+    for(unsigned int i = 0; i < outputs.size(); ++i)
+    {
+        const IAccessor &output = outputs[i];
+        validate(output, reference[i]);
+    }
+}
+
+TEST_CASE(ThreeStagesOverSeveralRuns, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_runs = 3;
+
+    GraphConfig sequential_config;
+    sequential_config.num_threads = 3;
+    const std::vector<SimpleTensor<float>> reference = run_chain_graph(sequential_config, num_runs);
+
+    // The stage threads wait for the next run, and the buffers crossing the stages are reused from one run to the next
+    GraphConfig pipelined_config;
+    pipelined_config.num_threads         = 3;
+    pipelined_config.num_pipeline_stages = 3;
+    const std::vector<SimpleTensor<float>> outputs = run_chain_graph(pipelined_config, num_runs);
+
+    ARM_COMPUTE_ASSERT(reference.size() == num_runs * num_requests + 1);
+    ARM_COMPUTE_ASSERT(outputs.size() == reference.size());
+    for(unsigned int i = 0; i < outputs.size(); ++i)
+    {
+        const IAccessor &output = outputs[i];
+        validate(output, reference[i]);
+    }
+}
+
+TEST_SUITE_END() // Pipeline
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
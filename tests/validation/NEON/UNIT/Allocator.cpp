@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Allocator.h"
+
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+bool is_aligned(const void *ptr, size_t alignment)
+{
+    return (reinterpret_cast<uintptr_t>(ptr) % alignment) == 0;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(Allocator)
+
+TEST_CASE(Alignment, framework::DatasetMode::ALL)
+{
+    Allocator allocator{};
+
+    // Allocations are aligned to at least a cache line
+    for(size_t alignment : { 0, 16, 64, 128, 4096 })
+    {
+        for(size_t size : { 1, 17, 1000, 65536 })
+        {
+            void *ptr = allocator.allocate(size, alignment);
+            ARM_COMPUTE_EXPECT(ptr != nullptr, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(is_aligned(ptr, std::max(alignment, Allocator::cache_line_size)), framework::LogLevel::ERRORS);
+            std::memset(ptr, 0, size);
+            allocator.free(ptr);
+        }
+    }
+
+    // Self-managed regions
+    auto region = allocator.make_region(1000, 256);
+    ARM_COMPUTE_EXPECT(region->buffer() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_aligned(region->buffer(), 256), framework::LogLevel::ERRORS);
+
+    // Unmanaged tensors
+    Tensor tensor = create_tensor<Tensor>(TensorShape(27U, 11U, 3U), DataType::F32, 1);
+    tensor.allocator()->allocate();
+    ARM_COMPUTE_EXPECT(is_aligned(tensor.buffer(), Allocator::cache_line_size), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(HugePages, framework::DatasetMode::ALL)
+{
+    const size_t size = 3 * Allocator::huge_page_size + 100;
+
+    for(auto huge_pages : { HugePagePolicy::NONE, HugePagePolicy::TRANSPARENT, HugePagePolicy::EXPLICIT })
+    {
+        Allocator allocator(huge_pages);
+        ARM_COMPUTE_EXPECT(allocator.huge_pages() == huge_pages, framework::LogLevel::ERRORS);
+
+        // Small allocations use regular pages, large ones might fall back to them if no huge page is available
+        void *small_ptr = allocator.allocate(1024, 0);
+        void *large_ptr = allocator.allocate(size, 0);
+        ARM_COMPUTE_EXPECT(small_ptr != nullptr && large_ptr != nullptr, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(is_aligned(small_ptr, Allocator::cache_line_size), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(is_aligned(large_ptr, (huge_pages == HugePagePolicy::NONE) ? Allocator::cache_line_size : Allocator::huge_page_size), framework::LogLevel::ERRORS);
+        std::memset(large_ptr, 1, size);
+
+        // Memory allocated with a previous policy can be freed
+        allocator.set_huge_pages(HugePagePolicy::NONE);
+        allocator.free(small_ptr);
+        allocator.free(large_ptr);
+    }
+}
+
+TEST_CASE(GraphContextHugePages, framework::DatasetMode::ALL)
+{
+    graph::GraphConfig config;
+    config.use_huge_pages = true;
+
+    // The policy applies to an allocator of the context, the one of the backend is shared with the other graphs
+    graph::GraphContext huge_pages_ctx;
+    huge_pages_ctx.set_config(config);
+    graph::setup_default_graph_context(huge_pages_ctx);
+
+    graph::GraphContext ctx;
+    graph::setup_default_graph_context(ctx);
+
+    const auto *allocator         = dynamic_cast<Allocator *>(huge_pages_ctx.memory_management_ctx(graph::Target::NEON)->allocator.get());
+    const auto *backend_allocator = dynamic_cast<Allocator *>(graph::backends::BackendRegistry::get().find_backend(graph::Target::NEON)->backend_allocator());
+    ARM_COMPUTE_EXPECT(allocator != nullptr && allocator->huge_pages() == HugePagePolicy::TRANSPARENT, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(backend_allocator != nullptr && backend_allocator->huge_pages() == HugePagePolicy::NONE, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(ctx.memory_management_ctx(graph::Target::NEON)->allocator == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
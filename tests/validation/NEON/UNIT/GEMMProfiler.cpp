@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMProfiler.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GEMMProfiler)
+
+/** Validates that the phases of the assembly GEMMs are recorded while a profiler is set */
+TEST_CASE(RecordGEMMRuns, framework::DatasetMode::ALL)
+{
+    const unsigned int M = 32U;
+    const unsigned int N = 40U;
+    const unsigned int K = 48U;
+
+    NEGEMMProfiler profiler;
+    NEScheduler::get().set_gemm_profiler(&profiler);
+    profiler.set_layer("layer");
+
+    // Create tensors
+    Tensor a = create_tensor<Tensor>(TensorShape(K, M), DataType::F32);
+    Tensor b = create_tensor<Tensor>(TensorShape(N, K), DataType::F32);
+    Tensor d = create_tensor<Tensor>(TensorShape(N, M), DataType::F32);
+
+    NEGEMM gemm;
+    gemm.configure(&a, &b, nullptr, &d, 1.f, 0.f);
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    d.allocator()->allocate();
+
+    gemm.run();
+    const size_t num_runs = profiler.measurements().size();
+    gemm.run();
+
+    // Only the assembly GEMMs get profiled, once per run
+    ARM_COMPUTE_EXPECT(num_runs <= 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(profiler.measurements().size() == 2 * num_runs, framework::LogLevel::ERRORS);
+
+    for(const auto &run : profiler.measurements())
+    {
+        const NEGEMMProfiler::PhaseMeasurement &kernel = run.phase(arm_gemm::ProfilePhase::Kernel);
+        ARM_COMPUTE_EXPECT(run.layer == "layer", framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(run.shape.M == M && run.shape.N == N && run.shape.K == K, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(kernel.events > 0, framework::LogLevel::ERRORS);
+        // The kernels may compute padded blocks
+        ARM_COMPUTE_EXPECT(kernel.units >= static_cast<uint64_t>(M) * N * K, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(run.time_ns > 0, framework::LogLevel::ERRORS);
+    }
+
+    // Nothing is recorded once the profiler is unset
+    NEScheduler::get().set_gemm_profiler(nullptr);
+    profiler.clear();
+    gemm.run();
+    ARM_COMPUTE_EXPECT(profiler.measurements().empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "support/ToolchainSupport.h"
+#include "tests/GraphAccessors.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <cctype>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+
+namespace
+{
+/** Minimal JSON syntax checker */
+class JsonChecker
+{
+public:
+    /** Checks that a string holds exactly one JSON value
+     *
+     * @param[in] json String to check
+     *
+     * @return True if the string is valid JSON
+     */
+    static bool is_valid(const std::string &json)
+    {
+        JsonChecker checker(json);
+        return checker.value() && checker.skip_spaces() == json.size();
+    }
+
+private:
+    explicit JsonChecker(const std::string &json)
+        : _json(json), _pos(0)
+    {
+    }
+    size_t skip_spaces()
+    {
+        while(_pos < _json.size() && std::isspace(static_cast<unsigned char>(_json[_pos])))
+        {
+            ++_pos;
+        }
+        return _pos;
+    }
+    bool consume(char c)
+    {
+        skip_spaces();
+        if(_pos < _json.size() && _json[_pos] == c)
+        {
+            ++_pos;
+            return true;
+        }
+        return false;
+    }
+    bool string()
+    {
+        if(!consume('"'))
+        {
+            return false;
+        }
+        for(; _pos < _json.size() && _json[_pos] != '"'; ++_pos)
+        {
+            if(_json[_pos] == '\\')
+            {
+                ++_pos;
+            }
+        }
+        return consume('"');
+    }
+    bool number()
+    {
+        const size_t start = _pos;
+        while(_pos < _json.size() && (std::isdigit(static_cast<unsigned char>(_json[_pos])) || std::strchr("+-.eE", _json[_pos]) != nullptr))
+        {
+            ++_pos;
+        }
+        return _pos > start;
+    }
+    bool literal(const char *word)
+    {
+        const size_t length = std::strlen(word);
+        if(_json.compare(_pos, length, word) == 0)
+        {
+            _pos += length;
+            return true;
+        }
+        return false;
+    }
+    template <typename F>
+    bool list(char open, char close, F &&element)
+    {
+        if(!consume(open))
+        {
+            return false;
+        }
+        if(consume(close))
+        {
+            return true;
+        }
+        do
+        {
+            if(!element())
+            {
+                return false;
+            }
+        }
+        while(consume(','));
+        return consume(close);
+    }
+    bool value()
+    {
+        skip_spaces();
+        if(_pos >= _json.size())
+        {
+            return false;
+        }
+        switch(_json[_pos])
+        {
+            case '{':
+                return list('{', '}', [this]()
+                {
+                    return string() && consume(':') && value();
+                });
+            case '[':
+                return list('[', ']', [this]()
+                {
+                    return value();
+                });
+            case '"':
+                return string();
+            default:
+                return literal("null") || literal("true") || literal("false") || number();
+        }
+    }
+
+    const std::string &_json;
+    size_t             _pos;
+};
+
+/** Checks if two ranges [start0, end0] and [start1, end1] overlap */
+bool overlap(size_t start0, size_t end0, size_t start1, size_t end1)
+{
+    return start0 <= end1 && start1 <= end0;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphMemoryPlan)
+
+TEST_CASE(TransitionBuffers, framework::DatasetMode::ALL)
+{
+    const NodeParams params = { "", Target::NEON };
+
+    // Residual block: the output of the first convolution is live while the next two layers run
+    Graph        g(0, "MemoryPlan");
+    const NodeID input = GraphBuilder::add_input_node(g, params, TensorDescriptor(TensorShape(16U, 16U, 4U), DataType::F32), support::cpp14::make_unique<UniformGraphAccessor>(0));
+    const NodeID conv0 = GraphBuilder::add_convolution_node(g, params, { input, 0 }, Size2D(3U, 3U), 8U, PadStrideInfo(1, 1, 1, 1), 1, graph::ConvolutionMethod::DEFAULT, FastMathHint::DISABLED,
+                                                            support::cpp14::make_unique<UniformGraphAccessor>(100), support::cpp14::make_unique<UniformGraphAccessor>(200));
+    const NodeID act   = GraphBuilder::add_activation_node(g, params, { conv0, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH));
+    const NodeID conv1 = GraphBuilder::add_convolution_node(g, params, { act, 0 }, Size2D(1U, 1U), 8U, PadStrideInfo(1, 1, 0, 0), 1, graph::ConvolutionMethod::DEFAULT, FastMathHint::DISABLED,
+                                                            support::cpp14::make_unique<UniformGraphAccessor>(300), support::cpp14::make_unique<UniformGraphAccessor>(400));
+    const NodeID add   = GraphBuilder::add_elementwise_node(g, params, { conv0, 0 }, { conv1, 0 }, EltwiseOperation::ADD);
+    const NodeID pool  = GraphBuilder::add_pooling_node(g, params, { add, 0 }, PoolingLayerInfo(PoolingType::AVG, 2, PadStrideInfo(2, 2, 0, 0)));
+    GraphBuilder::add_output_node(g, params, { pool, 0 });
+
+    GraphContext ctx;
+    ctx.set_config(GraphConfig());
+    GraphManager manager;
+    PassManager  pm = create_default_pass_manager(Target::NEON);
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+
+    const MemoryPlan &plan = manager.memory_plan(g);
+    ARM_COMPUTE_ASSERT(!plan.transitions.empty());
+
+    // The buffers live at the same time must not share memory
+    for(size_t i = 0; i < plan.transitions.size(); ++i)
+    {
+        const TransitionMemoryPlan &a = plan.transitions[i];
+        ARM_COMPUTE_EXPECT(a.start <= a.end && a.end < plan.steps.size(), framework::LogLevel::ERRORS);
+        for(size_t j = i + 1; j < plan.transitions.size(); ++j)
+        {
+            const TransitionMemoryPlan &b = plan.transitions[j];
+            if(a.mapping_type != b.mapping_type || !overlap(a.start, a.end, b.start, b.end))
+            {
+                continue;
+            }
+            const bool is_shared = (a.mapping_type == MappingType::OFFSETS) ? overlap(a.mapping, a.mapping + a.size - 1, b.mapping, b.mapping + b.size - 1) : (a.mapping == b.mapping);
+            ARM_COMPUTE_EXPECT(!is_shared, framework::LogLevel::ERRORS);
+        }
+    }
+
+    // The peak footprint is the size of the pool of the transition memory manager
+    MemoryManagerContext *mm_ctx = ctx.memory_management_ctx(Target::NEON);
+    ARM_COMPUTE_ASSERT(mm_ctx != nullptr && mm_ctx->cross_mm != nullptr);
+    auto *lifetime_mgr = dynamic_cast<OffsetLifetimeManager *>(mm_ctx->cross_mm->lifetime_manager());
+    ARM_COMPUTE_ASSERT(lifetime_mgr != nullptr);
+    ARM_COMPUTE_EXPECT_EQUAL(plan.transition_peak, lifetime_mgr->planned_size(), framework::LogLevel::ERRORS);
+    for(const auto &transition : plan.transitions)
+    {
+        ARM_COMPUTE_EXPECT(transition.mapping + transition.size <= plan.transition_peak, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(plan.peak_step_size <= plan.transition_peak, framework::LogLevel::ERRORS);
+
+    // The printed plan is valid JSON
+    std::stringstream     json;
+    JsonMemoryPlanPrinter printer(plan);
+    printer.print(g, json);
+    ARM_COMPUTE_EXPECT(JsonChecker::is_valid(json.str()), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // GraphMemoryPlan
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -23,9 +23,11 @@
  */
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/MemoryArena.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
 #include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "support/ToolchainSupport.h"
@@ -88,6 +90,152 @@ TEST_CASE(BlobMemoryManagerSimpleWithinFunctionLevel, framework::DatasetMode::AL
     norm_layer_2.run();
 }
 
+TEST_CASE(OffsetLifetimeManagerPacksDisjointLifetimes, framework::DatasetMode::ALL)
+{
+    Allocator allocator{};
+    auto      lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
+    auto      mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, std::make_shared<PoolManager>());
+    MemoryGroup group(mm);
+
+    const TensorShape small_shape(16U, 4U);
+    const TensorShape large_shape(64U, 64U, 4U);
+    Tensor            d = create_tensor<Tensor>(small_shape, DataType::F32, 1);
+    Tensor            a = create_tensor<Tensor>(large_shape, DataType::F32, 1);
+    Tensor            b = create_tensor<Tensor>(small_shape, DataType::F32, 1);
+    Tensor            c = create_tensor<Tensor>(large_shape, DataType::F32, 1);
+
+    // a and c are never alive at the same time, but c reuses the blob freed by b
+    group.manage(&d);
+    group.manage(&a);
+    group.manage(&b);
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    group.manage(&c);
+    c.allocator()->allocate();
+    d.allocator()->allocate();
+
+    mm->set_allocator(&allocator);
+    mm->finalize();
+
+    // a and c share the same offset
+    const size_t large_size = large_shape.total_size() * sizeof(float);
+    ARM_COMPUTE_EXPECT(lifetime_mgr->planned_size() < lifetime_mgr->unpacked_size(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lifetime_mgr->planned_size() < 2 * large_size, framework::LogLevel::ERRORS);
+
+    // Tensors alive at the same time don't overlap
+    group.acquire();
+    auto disjoint = [](const Tensor & t0, const Tensor & t1)
+    {
+        const uint8_t *p0 = t0.buffer();
+        const uint8_t *p1 = t1.buffer();
+        return (p0 + t0.info()->total_size() <= p1) || (p1 + t1.info()->total_size() <= p0);
+    };
+    ARM_COMPUTE_EXPECT(disjoint(d, a) && disjoint(d, b) && disjoint(d, c) && disjoint(a, b), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(a.buffer() == c.buffer(), framework::LogLevel::ERRORS);
+    group.release();
+}
+
+TEST_CASE(ArenaSharedAcrossMemoryManagers, framework::DatasetMode::ALL)
+{
+    Allocator   allocator{};
+    MemoryArena arena(&allocator);
+    auto        mm_small = std::make_shared<MemoryManagerOnDemand>(std::make_shared<BlobLifetimeManager>(), std::make_shared<PoolManager>());
+    auto        mm_large = std::make_shared<MemoryManagerOnDemand>(std::make_shared<OffsetLifetimeManager>(), std::make_shared<PoolManager>());
+
+    // Create tensors
+    const TensorShape small_shape(27U, 11U, 3U);
+    const TensorShape large_shape(64U, 32U, 16U);
+    Tensor            src_small = create_tensor<Tensor>(small_shape, DataType::F32, 1);
+    Tensor            dst_small = create_tensor<Tensor>(small_shape, DataType::F32, 1);
+    Tensor            src_large = create_tensor<Tensor>(large_shape, DataType::F32, 1);
+    Tensor            dst_large = create_tensor<Tensor>(large_shape, DataType::F32, 1);
+
+    // Create and configure functions
+    NENormalizationLayer norm_layer_small(mm_small);
+    NENormalizationLayer norm_layer_large(mm_large);
+    norm_layer_small.configure(&src_small, &dst_small, NormalizationLayerInfo(NormType::CROSS_MAP, 3));
+    norm_layer_large.configure(&src_large, &dst_large, NormalizationLayerInfo(NormType::CROSS_MAP, 3));
+
+    // Allocate tensors
+    src_small.allocator()->allocate();
+    dst_small.allocator()->allocate();
+    src_large.allocator()->allocate();
+    dst_large.allocator()->allocate();
+
+    // Finalize memory managers on the same arena
+    mm_small->set_arena(&arena);
+    mm_large->set_arena(&arena);
+    mm_small->finalize();
+    mm_large->finalize();
+
+    // Pools lease memory only while acquired
+    ARM_COMPUTE_EXPECT(arena.num_slabs() == 0, framework::LogLevel::ERRORS);
+
+    // Fill tensors
+    arm_compute::test::library->fill_tensor_uniform(Accessor(src_small), 0);
+    arm_compute::test::library->fill_tensor_uniform(Accessor(src_large), 1);
+
+    // Compute functions one after the other
+    norm_layer_small.run();
+    norm_layer_large.run();
+    norm_layer_small.run();
+
+    // A single slab, as large as the largest requirement, backs both managers
+    ARM_COMPUTE_EXPECT(arena.num_leases() == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arena.num_slabs() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arena.resident_size() >= large_shape.total_size() * sizeof(float), framework::LogLevel::ERRORS);
+
+    // Idle slabs can be released
+    arena.trim();
+    ARM_COMPUTE_EXPECT(arena.resident_size() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FrozenPoolManagerKeepsGroupsBound, framework::DatasetMode::ALL)
+{
+    Allocator allocator{};
+    auto      lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
+    auto      pool_mgr     = std::make_shared<PoolManager>();
+    auto      mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+
+    // Manage tensors of two groups
+    MemoryGroup group_a(mm);
+    MemoryGroup group_b(mm);
+    Tensor      tensor_a = create_tensor<Tensor>(TensorShape(27U, 11U, 3U), DataType::F32, 1);
+    Tensor      tensor_b = create_tensor<Tensor>(TensorShape(64U, 32U, 16U), DataType::F32, 1);
+    group_a.manage(&tensor_a);
+    group_b.manage(&tensor_b);
+    tensor_a.allocator()->allocate();
+    tensor_b.allocator()->allocate();
+
+    // Finalize memory manager and freeze its single pool
+    mm->set_allocator(&allocator);
+    mm->set_num_pools(1);
+    mm->finalize();
+    pool_mgr->freeze();
+    ARM_COMPUTE_EXPECT(pool_mgr->is_frozen(), framework::LogLevel::ERRORS);
+
+    // First acquisition binds the groups to the pool
+    group_a.acquire();
+    group_a.release();
+    group_b.acquire();
+    group_b.release();
+    uint8_t *const buffer_a = tensor_a.buffer();
+    uint8_t *const buffer_b = tensor_b.buffer();
+    ARM_COMPUTE_EXPECT(buffer_a != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(buffer_b != nullptr, framework::LogLevel::ERRORS);
+
+    // Later acquisitions keep the same backing memory
+    for(unsigned int i = 0; i < 3; ++i)
+    {
+        group_a.acquire();
+        group_b.acquire();
+        ARM_COMPUTE_EXPECT(tensor_a.buffer() == buffer_a, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(tensor_b.buffer() == buffer_b, framework::LogLevel::ERRORS);
+        group_b.release();
+        group_a.release();
+    }
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/NEON/NEPackedWeightsCache.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Checks if loading a cache file throws once an entry's offset and length are rewritten
+ *
+ * @param[in] file   Content of a cache file holding an entry named "buffer"
+ * @param[in] offset Offset to write in the entry
+ * @param[in] length Length to write in the entry
+ *
+ * @return True if the load threw an error
+ */
+bool load_throws(std::vector<char> file, uint64_t offset, uint64_t length)
+{
+    const std::string filename = "acl_packed_weights_corrupted_test.bin";
+    const std::string key      = "buffer";
+
+    // The offset and the length follow the key in the index
+    auto entry = std::search(file.begin(), file.end(), key.begin(), key.end()) + key.size();
+    std::memcpy(&*entry, &offset, sizeof(offset));
+    std::memcpy(&*entry + sizeof(offset), &length, sizeof(length));
+    std::ofstream(filename, std::ios::out | std::ios::binary).write(file.data(), file.size());
+
+    bool thrown = false;
+    try
+    {
+        NEPackedWeightsCache cache;
+        cache.load_from_file(filename);
+    }
+    catch(const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    std::remove(filename.c_str());
+    return thrown;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(PackedWeightsCache)
+
+TEST_CASE(SaveAndMap, framework::DatasetMode::ALL)
+{
+    const std::string filename = "acl_packed_weights_test.bin";
+
+    auto buffer_0 = std::make_shared<std::vector<uint8_t>>(1000);
+    auto buffer_1 = std::make_shared<std::vector<uint8_t>>(333);
+    for(size_t i = 0; i < buffer_0->size(); ++i)
+    {
+        (*buffer_0)[i] = static_cast<uint8_t>(i * 7);
+    }
+    for(size_t i = 0; i < buffer_1->size(); ++i)
+    {
+        (*buffer_1)[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    // Record buffers and save them
+    NEPackedWeightsCache cache;
+    cache.add("buffer_0", std::shared_ptr<const void>(buffer_0, buffer_0->data()), buffer_0->size());
+    cache.add("buffer_1", std::shared_ptr<const void>(buffer_1, buffer_1->data()), buffer_1->size());
+    ARM_COMPUTE_EXPECT(cache.has_new_entries(), framework::LogLevel::ERRORS);
+    cache.save_to_file(filename);
+
+    // Map them in a new cache
+    NEPackedWeightsCache mapped_cache;
+    mapped_cache.load_from_file(filename);
+    std::remove(filename.c_str());
+
+    ARM_COMPUTE_EXPECT(mapped_cache.num_entries() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!mapped_cache.has_new_entries(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mapped_cache.find("buffer_0", buffer_1->size()) == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mapped_cache.find("buffer_2", buffer_1->size()) == nullptr, framework::LogLevel::ERRORS);
+
+    std::shared_ptr<const void> data_0 = mapped_cache.find("buffer_0", buffer_0->size());
+    std::shared_ptr<const void> data_1 = mapped_cache.find("buffer_1", buffer_1->size());
+    ARM_COMPUTE_ASSERT(data_0 != nullptr && data_1 != nullptr);
+    ARM_COMPUTE_EXPECT(std::memcmp(data_0.get(), buffer_0->data(), buffer_0->size()) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::memcmp(data_1.get(), buffer_1->data(), buffer_1->size()) == 0, framework::LogLevel::ERRORS);
+
+    // Buffers are aligned for the assembly kernels
+    ARM_COMPUTE_EXPECT((reinterpret_cast<uintptr_t>(data_0.get()) % 128) == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((reinterpret_cast<uintptr_t>(data_1.get()) % 128) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ForgetReleasedBuffers, framework::DatasetMode::ALL)
+{
+    NEPackedWeightsCache cache;
+    auto                 buffer = std::make_shared<std::vector<uint8_t>>(64);
+    auto                 other  = std::make_shared<std::vector<uint8_t>>(64);
+
+    std::shared_ptr<const void> data = cache.add("buffer", std::shared_ptr<const void>(buffer, buffer->data()), buffer->size());
+    ARM_COMPUTE_EXPECT(data.get() == buffer->data(), framework::LogLevel::ERRORS);
+
+    // The buffer recorded first is kept while it is alive
+    ARM_COMPUTE_EXPECT(cache.add("buffer", std::shared_ptr<const void>(other, other->data()), other->size()).get() == buffer->data(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.num_entries() == 1, framework::LogLevel::ERRORS);
+
+    // The cache doesn't own the buffers
+    data.reset();
+    buffer.reset();
+    ARM_COMPUTE_EXPECT(cache.num_entries() == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.find("buffer", 64) == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectCorruptedEntries, framework::DatasetMode::ALL)
+{
+    const std::string filename = "acl_packed_weights_test.bin";
+
+    auto                 buffer = std::make_shared<std::vector<uint8_t>>(1000);
+    NEPackedWeightsCache cache;
+    cache.add("buffer", std::shared_ptr<const void>(buffer, buffer->data()), buffer->size());
+    cache.save_to_file(filename);
+
+    std::ifstream     fs(filename, std::ios::in | std::ios::binary);
+    std::vector<char> file((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+    fs.close();
+    std::remove(filename.c_str());
+    ARM_COMPUTE_ASSERT(file.size() > buffer->size());
+
+    // The saved entry starts at the first aligned offset after the index
+    const uint64_t offset = file.size() - buffer->size();
+    ARM_COMPUTE_ASSERT(offset % 128 == 0);
+    ARM_COMPUTE_EXPECT(!load_throws(file, offset, buffer->size()), framework::LogLevel::ERRORS);
+
+    // Out of bounds
+    ARM_COMPUTE_EXPECT(load_throws(file, offset, buffer->size() + 1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(load_throws(file, file.size() + 128, 0), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(load_throws(file, offset, UINT64_MAX), framework::LogLevel::ERRORS);
+
+    // Misaligned
+    ARM_COMPUTE_EXPECT(load_throws(file, offset + 1, buffer->size() - 1), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(HashIgnoresPadding, framework::DatasetMode::ALL)
+{
+    const TensorShape shape(17U, 5U, 3U);
+    Tensor            tensor        = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor            padded_tensor = create_tensor<Tensor>(shape, DataType::F32);
+    padded_tensor.info()->extend_padding(PaddingSize(1, 3, 2, 4));
+    tensor.allocator()->allocate();
+    padded_tensor.allocator()->allocate();
+
+    library->fill_tensor_uniform(Accessor(tensor), 0);
+    library->fill_tensor_uniform(Accessor(padded_tensor), 0);
+    ARM_COMPUTE_EXPECT(NEPackedWeightsCache::hash(tensor) == NEPackedWeightsCache::hash(padded_tensor), framework::LogLevel::ERRORS);
+
+    library->fill_tensor_uniform(Accessor(padded_tensor), 1);
+    ARM_COMPUTE_EXPECT(NEPackedWeightsCache::hash(tensor) != NEPackedWeightsCache::hash(padded_tensor), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(GEMMUsesMappedWeights, framework::DatasetMode::ALL)
+{
+    const std::string filename = "acl_packed_weights_test.bin";
+    const GEMMInfo    gemm_info(false, false, true /* reshape_b_only_on_first_run */);
+
+    Tensor a     = create_tensor<Tensor>(TensorShape(64U, 32U), DataType::F32);
+    Tensor b     = create_tensor<Tensor>(TensorShape(48U, 64U), DataType::F32);
+    Tensor dst_0 = create_tensor<Tensor>(TensorShape(48U, 32U), DataType::F32);
+    Tensor dst_1 = create_tensor<Tensor>(TensorShape(48U, 32U), DataType::F32);
+
+    // Pack the weights of a first GEMM
+    NEPackedWeightsCache cache;
+    NEScheduler::get().set_weights_cache(&cache);
+    NEGEMM gemm_0;
+    gemm_0.configure(&a, &b, nullptr, &dst_0, 1.f, 0.f, gemm_info);
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    dst_0.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b), 1);
+    gemm_0.run();
+
+    // Only the assembly GEMMs pack their weights
+    if(cache.has_new_entries())
+    {
+        cache.save_to_file(filename);
+
+        // Run a second GEMM on the mapped weights
+        NEPackedWeightsCache mapped_cache;
+        mapped_cache.load_from_file(filename);
+        NEScheduler::get().set_weights_cache(&mapped_cache);
+        NEGEMM gemm_1;
+        gemm_1.configure(&a, &b, nullptr, &dst_1, 1.f, 0.f, gemm_info);
+        dst_1.allocator()->allocate();
+        gemm_1.run();
+        std::remove(filename.c_str());
+
+        ARM_COMPUTE_EXPECT(!mapped_cache.has_new_entries(), framework::LogLevel::ERRORS);
+
+        // Same weights: same results
+        Accessor dst_0_accessor(dst_0);
+        Accessor dst_1_accessor(dst_1);
+        bool     is_equal = true;
+        for(size_t y = 0; y < dst_0_accessor.shape().y(); ++y)
+        {
+            for(size_t x = 0; x < dst_0_accessor.shape().x(); ++x)
+            {
+                const Coordinates coord(x, y);
+                is_equal &= *reinterpret_cast<const float *>(dst_0_accessor(coord)) == *reinterpret_cast<const float *>(dst_1_accessor(coord));
+            }
+        }
+        ARM_COMPUTE_EXPECT(is_equal, framework::LogLevel::ERRORS);
+    }
+
+    // Clear cache
+    NEScheduler::get().set_weights_cache(nullptr);
+}
+
+TEST_CASE(GEMMsShareWeights, framework::DatasetMode::ALL)
+{
+    const GEMMInfo gemm_info(false, false, true /* reshape_b_only_on_first_run */);
+
+    Tensor a     = create_tensor<Tensor>(TensorShape(64U, 32U), DataType::F32);
+    Tensor b_0   = create_tensor<Tensor>(TensorShape(48U, 64U), DataType::F32);
+    Tensor b_1   = create_tensor<Tensor>(TensorShape(48U, 64U), DataType::F32);
+    Tensor dst_0 = create_tensor<Tensor>(TensorShape(48U, 32U), DataType::F32);
+    Tensor dst_1 = create_tensor<Tensor>(TensorShape(48U, 32U), DataType::F32);
+
+    NEPackedWeightsCache cache;
+    NEScheduler::get().set_weights_cache(&cache);
+
+    // Two instances of the same GEMM, with their own copy of the weights
+    NEGEMM gemm_1;
+    {
+        NEGEMM gemm_0;
+        gemm_0.configure(&a, &b_0, nullptr, &dst_0, 1.f, 0.f, gemm_info);
+        gemm_1.configure(&a, &b_1, nullptr, &dst_1, 1.f, 0.f, gemm_info);
+        a.allocator()->allocate();
+        b_0.allocator()->allocate();
+        b_1.allocator()->allocate();
+        dst_0.allocator()->allocate();
+        dst_1.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(a), 0);
+        library->fill_tensor_uniform(Accessor(b_0), 1);
+        library->fill_tensor_uniform(Accessor(b_1), 1);
+        gemm_0.run();
+        gemm_1.run();
+
+        // A single packed copy is shared by both GEMMs (only the assembly GEMMs pack their weights)
+        ARM_COMPUTE_EXPECT(cache.num_entries() <= 1, framework::LogLevel::ERRORS);
+    }
+
+    // The shared copy outlives the first GEMM
+    std::memset(dst_1.buffer(), 0, dst_1.info()->total_size());
+    gemm_1.run();
+
+    Accessor dst_0_accessor(dst_0);
+    Accessor dst_1_accessor(dst_1);
+    bool     is_equal = true;
+    for(size_t y = 0; y < dst_0_accessor.shape().y(); ++y)
+    {
+        for(size_t x = 0; x < dst_0_accessor.shape().x(); ++x)
+        {
+            const Coordinates coord(x, y);
+            is_equal &= *reinterpret_cast<const float *>(dst_0_accessor(coord)) == *reinterpret_cast<const float *>(dst_1_accessor(coord));
+        }
+    }
+    ARM_COMPUTE_EXPECT(is_equal, framework::LogLevel::ERRORS);
+
+    // Clear cache
+    NEScheduler::get().set_weights_cache(nullptr);
+}
+
+TEST_CASE(GraphContextKeepsSchedulerCache, framework::DatasetMode::ALL)
+{
+    graph::GraphConfig config;
+    config.share_packed_weights = true;
+
+    // The cache of the backend is only installed while the nodes of the graphs sharing their weights are configured
+    graph::GraphContext ctx;
+    ctx.set_config(config);
+    graph::setup_default_graph_context(ctx);
+    ARM_COMPUTE_EXPECT(NEScheduler::get().weights_cache() == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
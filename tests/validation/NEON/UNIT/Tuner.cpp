@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEGEMMTuner.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <cstdio>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(Tuner)
+
+/** Validates that the GEMM tuner table survives a save and load */
+TEST_CASE(GEMMTunerSaveAndLoad, framework::DatasetMode::ALL)
+{
+    const std::string filename = "acl_gemm_tuner_test.csv";
+    const std::string gemm_id  = NEGEMMTuner::gemm_id("F32", 64U, 128U, 256U, 1U, 1U, 4U, true, CPUModel::A53);
+
+    arm_gemm::GemmConfig config;
+    config.method           = arm_gemm::GemmMethod::GEMM_INTERLEAVED;
+    config.inner_block_size = 128U;
+    config.outer_block_size = 64U;
+
+    // Save a table with a single entry
+    NEGEMMTuner tuner;
+    tuner.add_config_to_table(gemm_id, config);
+    tuner.save_to_file(filename);
+
+    // Load it in a new tuner
+    NEGEMMTuner loaded_tuner;
+    loaded_tuner.load_from_file(filename);
+    std::remove(filename.c_str());
+
+    ARM_COMPUTE_EXPECT(loaded_tuner.config_table().size() == 1, framework::LogLevel::ERRORS);
+    const auto it = loaded_tuner.config_table().find(gemm_id);
+    ARM_COMPUTE_ASSERT(it != loaded_tuner.config_table().end());
+    ARM_COMPUTE_EXPECT(it->second.method == config.method, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(it->second.inner_block_size == config.inner_block_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(it->second.outer_block_size == config.outer_block_size, framework::LogLevel::ERRORS);
+}
+
+/** Validates that a GEMM is tuned once per configuration */
+TEST_CASE(GEMMTunerTunesNewGEMMs, framework::DatasetMode::ALL)
+{
+    NEGEMMTuner tuner;
+    NEScheduler::get().set_gemm_tuner(&tuner);
+
+    // Create tensors
+    Tensor a = create_tensor<Tensor>(TensorShape(48U, 32U), DataType::F32);
+    Tensor b = create_tensor<Tensor>(TensorShape(40U, 48U), DataType::F32);
+    Tensor d = create_tensor<Tensor>(TensorShape(40U, 32U), DataType::F32);
+
+    // Configure the same GEMM twice
+    NEGEMM gemm_0;
+    NEGEMM gemm_1;
+    gemm_0.configure(&a, &b, nullptr, &d, 1.f, 0.f);
+    const size_t num_tuned_gemms = tuner.config_table().size();
+    gemm_1.configure(&a, &b, nullptr, &d, 1.f, 0.f);
+
+    // Only the assembly GEMMs get tuned
+    ARM_COMPUTE_EXPECT(num_tuned_gemms <= 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.config_table().size() == num_tuned_gemms, framework::LogLevel::ERRORS);
+
+    // Clear tuner
+    NEScheduler::get().set_gemm_tuner(nullptr);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Kernel filling a buffer with a value, optionally throwing when reaching a given element */
+class FillKernel final : public ICPPKernel
+{
+public:
+    void configure(std::vector<int> *output, int value, int throw_at = -1)
+    {
+        _output   = output;
+        _value    = value;
+        _throw_at = throw_at;
+
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, output->size(), 1));
+        ICPPKernel::configure(win);
+    }
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+        for(int x = window.x().start(); x < window.x().end(); ++x)
+        {
+            if(x == _throw_at)
+            {
+                throw std::runtime_error("FillKernel failure");
+            }
+            (*_output)[x] = _value;
+        }
+    }
+    const char *name() const override
+    {
+        return "FillKernel";
+    }
+
+private:
+    std::vector<int> *_output{ nullptr };
+    int               _value{ 0 };
+    int               _throw_at{ -1 };
+};
+
+bool is_filled(const std::vector<int> &buffer, int value)
+{
+    return std::all_of(buffer.begin(), buffer.end(), [&](int v)
+    {
+        return v == value;
+    });
+}
+
+constexpr unsigned int num_threads = 4;
+constexpr size_t       buffer_size = 1024;
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(CPPScheduler)
+
+/** Validates that independent kernels submitted back to back both complete */
+TEST_CASE(SubmitIndependentKernels, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+
+    // Submit the kernels many times to give the threads a chance to race with the submissions
+    for(int i = 1; i <= 100; ++i)
+    {
+        std::vector<int> buffer_0(buffer_size, 0);
+        std::vector<int> buffer_1(buffer_size, 0);
+        FillKernel       kernel_0;
+        FillKernel       kernel_1;
+        kernel_0.configure(&buffer_0, i);
+        kernel_1.configure(&buffer_1, -i);
+
+        const IScheduler::Token token_0 = scheduler.submit(&kernel_0, Window::DimX);
+        const IScheduler::Token token_1 = scheduler.submit(&kernel_1, Window::DimX);
+        scheduler.wait(token_1);
+        scheduler.wait(token_0);
+
+        ARM_COMPUTE_EXPECT(token_0.is_complete() && token_1.is_complete(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(is_filled(buffer_0, i), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(is_filled(buffer_1, -i), framework::LogLevel::ERRORS);
+    }
+}
+
+/** Validates that barrier waits for all the submitted kernels */
+TEST_CASE(Barrier, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+
+    std::vector<int> buffer_0(buffer_size, 0);
+    std::vector<int> buffer_1(buffer_size, 0);
+    FillKernel       kernel_0;
+    FillKernel       kernel_1;
+    kernel_0.configure(&buffer_0, 1);
+    kernel_1.configure(&buffer_1, 2);
+
+    const IScheduler::Token token_0 = scheduler.submit(&kernel_0, Window::DimX);
+    const IScheduler::Token token_1 = scheduler.submit(&kernel_1, Window::DimX);
+    scheduler.barrier();
+
+    ARM_COMPUTE_EXPECT(token_0.is_complete() && token_1.is_complete(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_filled(buffer_0, 1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_filled(buffer_1, 2), framework::LogLevel::ERRORS);
+}
+
+/** Validates that more kernels than the scheduler keeps states for can be in flight */
+TEST_CASE(SubmitManyKernels, framework::DatasetMode::ALL)
+{
+    constexpr int num_kernels = 50;
+
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+
+    std::vector<std::vector<int>>  buffers(num_kernels, std::vector<int>(buffer_size, 0));
+    std::vector<FillKernel>        kernels(num_kernels);
+    std::vector<IScheduler::Token> tokens;
+    for(int i = 0; i < num_kernels; ++i)
+    {
+        kernels[i].configure(&buffers[i], i + 1);
+        tokens.push_back(scheduler.submit(&kernels[i], Window::DimX));
+    }
+
+    // Wait in reverse order: the states of the first kernels have been reused by the last ones
+    for(int i = num_kernels - 1; i >= 0; --i)
+    {
+        scheduler.wait(tokens[i]);
+        ARM_COMPUTE_EXPECT(tokens[i].is_complete(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(is_filled(buffers[i], i + 1), framework::LogLevel::ERRORS);
+    }
+}
+
+/** Validates that an exception thrown by a submitted kernel is reported by wait, and only for that kernel */
+TEST_CASE(SubmitThrowingKernel, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+
+    std::vector<int> buffer_0(buffer_size, 0);
+    std::vector<int> buffer_1(buffer_size, 0);
+    FillKernel       throwing_kernel;
+    FillKernel       kernel;
+    throwing_kernel.configure(&buffer_0, 1, buffer_size / 2);
+    kernel.configure(&buffer_1, 2);
+
+    const IScheduler::Token throwing_token = scheduler.submit(&throwing_kernel, Window::DimX);
+    const IScheduler::Token token          = scheduler.submit(&kernel, Window::DimX);
+
+    bool thrown = false;
+    try
+    {
+        scheduler.wait(throwing_token);
+    }
+    catch(const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    ARM_COMPUTE_EXPECT(thrown, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(throwing_token.is_complete(), framework::LogLevel::ERRORS);
+
+    // The other kernel isn't affected
+    scheduler.wait(token);
+    ARM_COMPUTE_EXPECT(is_filled(buffer_1, 2), framework::LogLevel::ERRORS);
+
+    // The error doesn't leak into the following synchronous kernels
+    std::vector<int> buffer_2(buffer_size, 0);
+    FillKernel       sync_kernel;
+    sync_kernel.configure(&buffer_2, 3);
+    scheduler.schedule(&sync_kernel, Window::DimX);
+    ARM_COMPUTE_EXPECT(is_filled(buffer_2, 3), framework::LogLevel::ERRORS);
+}
+
+/** Validates that schedule waits for all the threads before reporting the exception of the last window, which the calling thread runs */
+TEST_CASE(ScheduleThrowingKernel, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+
+    for(auto strategy : { IScheduler::StrategyHint::STATIC, IScheduler::StrategyHint::DYNAMIC })
+    {
+        std::vector<int> buffer(buffer_size, 0);
+        FillKernel       throwing_kernel;
+        throwing_kernel.configure(&buffer, 1, buffer_size - 1);
+
+        bool thrown = false;
+        try
+        {
+            scheduler.schedule(&throwing_kernel, IScheduler::Hints(Window::DimX, strategy));
+        }
+        catch(const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        ARM_COMPUTE_EXPECT(thrown, framework::LogLevel::ERRORS);
+
+        // The other windows are done by the time the exception is reported
+        ARM_COMPUTE_EXPECT(std::all_of(buffer.begin(), buffer.end() - 1, [](int v)
+        {
+            return v == 1;
+        }),
+        framework::LogLevel::ERRORS);
+
+        // The threads can be sent the following kernels
+        std::vector<int> buffer_1(buffer_size, 0);
+        FillKernel       kernel;
+        kernel.configure(&buffer_1, 2);
+        scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX, strategy));
+        ARM_COMPUTE_EXPECT(is_filled(buffer_1, 2), framework::LogLevel::ERRORS);
+    }
+}
+
+/** Validates that schedule completes the kernels submitted before it even if they weren't waited for */
+TEST_CASE(ScheduleAfterSubmit, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+
+    std::vector<int> buffer_0(buffer_size, 0);
+    std::vector<int> buffer_1(buffer_size, 0);
+    FillKernel       async_kernel;
+    FillKernel       sync_kernel;
+    async_kernel.configure(&buffer_0, 1);
+    sync_kernel.configure(&buffer_1, 2);
+
+    const IScheduler::Token token = scheduler.submit(&async_kernel, Window::DimX);
+    scheduler.schedule(&sync_kernel, Window::DimX);
+
+    ARM_COMPUTE_EXPECT(token.is_complete(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_filled(buffer_0, 1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_filled(buffer_1, 2), framework::LogLevel::ERRORS);
+
+    // Waiting for an already completed kernel returns straight away
+    scheduler.wait(token);
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
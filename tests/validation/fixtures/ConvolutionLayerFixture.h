@@ -38,6 +38,7 @@
 #include "tests/validation/reference/Permute.h"
 #include "tests/validation/reference/Utils.h"
 
+#include <algorithm>
 #include <random>
 
 namespace arm_compute
@@ -221,6 +222,117 @@ public:
                                                                                               quantization_info, act_info);
     }
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GroupedConvolutionValidationFixture : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape output_shape, PadStrideInfo info, unsigned int num_groups, DataType data_type, ActivationLayerInfo act_info)
+    {
+        this->_data_type      = data_type;
+        this->_bias_data_type = data_type;
+        this->_data_layout    = DataLayout::NCHW;
+
+        const TensorShape bias_shape(weights_shape[3]);
+
+        this->_target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, num_groups, act_info);
+        this->_reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape, info, num_groups, act_info);
+    }
+
+protected:
+    TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, const PadStrideInfo &info,
+                              unsigned int num_groups, const ActivationLayerInfo &act_info)
+    {
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, this->_data_type, 1);
+        TensorType weights = create_tensor<TensorType>(weights_shape, this->_data_type, 1);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, this->_bias_data_type, 1);
+        TensorType dst     = create_tensor<TensorType>(output_shape, this->_data_type, 1);
+
+        // Create and configure function
+        FunctionType conv;
+        conv.configure(&src, &weights, &bias, &dst, info, num_groups, act_info);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        this->fill(AccessorType(src), 0);
+        this->fill(AccessorType(weights), 1);
+        this->fill(AccessorType(bias), 2);
+
+        // Compute function
+        conv.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, const PadStrideInfo &info,
+                                      unsigned int num_groups, const ActivationLayerInfo &act_info)
+    {
+        // Create reference
+        SimpleTensor<T> src{ input_shape, this->_data_type, 1 };
+        SimpleTensor<T> weights{ weights_shape, this->_data_type, 1 };
+        SimpleTensor<T> bias{ bias_shape, this->_bias_data_type, 1 };
+        SimpleTensor<T> dst{ output_shape, this->_data_type, 1 };
+
+        // Fill reference
+        this->fill(src, 0);
+        this->fill(weights, 1);
+        this->fill(bias, 2);
+
+        // Convolve each group on its slice of the channels, the batches being the outermost dimension of both the input and the output
+        const unsigned int batches      = input_shape.total_size_upper(3);
+        const unsigned int src_channels = input_shape[2] / num_groups;
+        const unsigned int dst_channels = output_shape[2] / num_groups;
+        const size_t       src_plane    = input_shape[0] * input_shape[1];
+        const size_t       dst_plane    = output_shape[0] * output_shape[1];
+
+        TensorShape group_input_shape(input_shape);
+        group_input_shape.set(2, src_channels);
+        TensorShape group_weights_shape(weights_shape);
+        group_weights_shape.set(3, dst_channels);
+        TensorShape group_output_shape(output_shape);
+        group_output_shape.set(2, dst_channels);
+
+        for(unsigned int g = 0; g < num_groups; ++g)
+        {
+            SimpleTensor<T> group_src{ group_input_shape, this->_data_type, 1 };
+            SimpleTensor<T> group_weights{ group_weights_shape, this->_data_type, 1 };
+            SimpleTensor<T> group_bias{ TensorShape(dst_channels), this->_bias_data_type, 1 };
+
+            for(unsigned int b = 0; b < batches; ++b)
+            {
+                std::copy_n(src.data() + (b * input_shape[2] + g * src_channels) * src_plane, src_channels * src_plane, group_src.data() + b * src_channels * src_plane);
+            }
+            std::copy_n(weights.data() + g * group_weights.num_elements(), group_weights.num_elements(), group_weights.data());
+            std::copy_n(bias.data() + g * dst_channels, dst_channels, group_bias.data());
+
+            const SimpleTensor<T> group_dst = reference::convolution_layer<T>(group_src, group_weights, group_bias, group_output_shape, info);
+
+            for(unsigned int b = 0; b < batches; ++b)
+            {
+                std::copy_n(group_dst.data() + b * dst_channels * dst_plane, dst_channels * dst_plane, dst.data() + (b * output_shape[2] + g * dst_channels) * dst_plane);
+            }
+        }
+
+        return (act_info.enabled()) ? reference::activation_layer<T>(dst, act_info) : dst;
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -34,6 +34,7 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Fixture.h"
 #include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
 #include "tests/validation/reference/FullyConnectedLayer.h"
 #include "tests/validation/reference/Utils.h"
 
@@ -258,6 +259,86 @@ public:
                                                                                                                       0, quantization_info);
     }
 };
+
+/** Fully connected layer with a fused activation, its weights are transposed and reshaped by the function */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FullyConnectedLayerValidationFusedActivationFixture : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, true>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, DataType data_type, ActivationLayerInfo act_info)
+    {
+        this->_data_type      = data_type;
+        this->_bias_data_type = data_type;
+
+        this->_target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, act_info);
+        this->_reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape, act_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        // Signed values, so that the activations aren't the identity
+        std::uniform_real_distribution<> distribution(-1.f, 1.f);
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, const ActivationLayerInfo &act_info)
+    {
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, this->_data_type, 1);
+        TensorType weights = create_tensor<TensorType>(weights_shape, this->_data_type, 1);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, this->_bias_data_type, 1);
+        TensorType dst     = create_tensor<TensorType>(output_shape, this->_data_type, 1);
+
+        // Create and configure function
+        FunctionType fc;
+        fc.configure(&src, &weights, &bias, &dst, true, false, act_info);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(weights), 1);
+        fill(AccessorType(bias), 2);
+
+        // Compute function
+        fc.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape,
+                                      const ActivationLayerInfo &act_info)
+    {
+        // Create reference
+        SimpleTensor<T> src{ input_shape, this->_data_type, 1 };
+        SimpleTensor<T> weights{ weights_shape, this->_data_type, 1 };
+        SimpleTensor<T> bias{ bias_shape, this->_bias_data_type, 1 };
+
+        // Fill reference
+        fill(src, 0);
+        fill(weights, 1);
+        fill(bias, 2);
+
+        return reference::activation_layer<T>(reference::fully_connected_layer<T>(src, weights, bias, output_shape), act_info);
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
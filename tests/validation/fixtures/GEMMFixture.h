@@ -146,6 +146,118 @@ public:
         GEMMValidationFixedPointFixture<TensorType, AccessorType, FunctionType, T>::setup(shape_a, shape_b, shape_c, output_shape, alpha, beta, data_type, 0);
     }
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GEMMBlockSparseValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_c, TensorShape output_shape, float alpha, float beta, DataType data_type, float density)
+    {
+        _density = density;
+
+        _target    = compute_target(shape_a, shape_b, shape_c, output_shape, alpha, beta, data_type);
+        _reference = compute_reference(shape_a, shape_b, shape_c, output_shape, alpha, beta, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    // Prune B like the weights of a pruned layer: keep a ratio _density of the blocks of 4 consecutive values of its rows, zero the others
+    template <typename U>
+    void prune(U &&tensor)
+    {
+        std::mt19937                gen(library->seed());
+        std::bernoulli_distribution keep(_density);
+
+        const TensorShape &shape = tensor.shape();
+        for(unsigned int z = 0; z < shape.z(); ++z)
+        {
+            for(unsigned int y = 0; y < shape.y(); ++y)
+            {
+                for(unsigned int x = 0; x < shape.x(); x += 4)
+                {
+                    if(keep(gen))
+                    {
+                        continue;
+                    }
+
+                    for(unsigned int i = x; i < std::min(x + 4, static_cast<unsigned int>(shape.x())); ++i)
+                    {
+                        *reinterpret_cast<T *>(tensor(Coordinates(i, y, z))) = T(0);
+                    }
+                }
+            }
+        }
+    }
+
+    TensorType compute_target(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &shape_c, const TensorShape &output_shape, float alpha, float beta,
+                              DataType data_type)
+    {
+        // Create tensors
+        TensorType a   = create_tensor<TensorType>(shape_a, data_type, 1);
+        TensorType b   = create_tensor<TensorType>(shape_b, data_type, 1);
+        TensorType c   = create_tensor<TensorType>(shape_c, data_type, 1);
+        TensorType dst = create_tensor<TensorType>(output_shape, data_type, 1);
+
+        // Create and configure function: B is only reshaped on the first run, when it is found sparse or not
+        FunctionType gemm;
+        gemm.configure(&a, &b, &c, &dst, alpha, beta, GEMMInfo(false, false, true));
+
+        ARM_COMPUTE_EXPECT(a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(c.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        c.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!a.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!b.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!c.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+        prune(AccessorType(b));
+        fill(AccessorType(c), 2);
+
+        // Compute GEMM function
+        gemm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &shape_c, const TensorShape &output_shape, float alpha, float beta,
+                                      DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> a{ shape_a, data_type, 1 };
+        SimpleTensor<T> b{ shape_b, data_type, 1 };
+        SimpleTensor<T> c{ shape_c, data_type, 1 };
+
+        // Fill reference
+        fill(a, 0);
+        fill(b, 1);
+        prune(b);
+        fill(c, 2);
+
+        return reference::gemm<T>(a, b, c, alpha, beta);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    float           _density{};
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
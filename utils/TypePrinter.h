@@ -33,6 +33,7 @@
 #include "arm_compute/core/Strides.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IScheduler.h"
 
 #include "tests/Types.h"
 
@@ -1365,6 +1366,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const ConvolutionMethod &c
         case ConvolutionMethod::WINOGRAD:
             os << "WINOGRAD";
             break;
+        case ConvolutionMethod::IMPLICIT_GEMM:
+            os << "IMPLICIT_GEMM";
+            break;
         default:
             ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
     }
@@ -1547,5 +1551,42 @@ inline std::string to_string(const WinogradInfo &type)
     str << type;
     return str.str();
 }
+
+/** Formatted output of the IScheduler::StrategyHint type.
+ *
+ * @param[out] os       Output stream.
+ * @param[in]  strategy Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const IScheduler::StrategyHint &strategy)
+{
+    switch(strategy)
+    {
+        case IScheduler::StrategyHint::STATIC:
+            os << "STATIC";
+            break;
+        case IScheduler::StrategyHint::DYNAMIC:
+            os << "DYNAMIC";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
+/** Formatted output of the IScheduler::StrategyHint type.
+ *
+ * @param[in] strategy Type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const IScheduler::StrategyHint &strategy)
+{
+    std::stringstream str;
+    str << strategy;
+    return str.str();
+}
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_TEST_TYPE_PRINTER_H__ */